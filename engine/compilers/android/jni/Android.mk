@@ -188,6 +188,9 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/core/RenderProxy.cc \
 					../../../source/2d/core/SpriteBase.cc \
 					../../../source/2d/core/SpriteBatch.cc \
+					../../../source/2d/core/SpriteBatchChunk.cc \
+					../../../source/2d/core/SpriteBatchTransforms.cc \
+					../../../source/2d/core/BatchRenderStream.cc \
 					../../../source/2d/core/SpriteBatchItem.cc \
 					../../../source/2d/core/SpriteBatchQuery.cc \
 					../../../source/2d/core/Utility.cc \
@@ -211,6 +214,9 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/scene/ContactFilter.cc \
 					../../../source/2d/scene/DebugDraw.cc \
 					../../../source/2d/scene/Scene.cc \
+					../../../source/io/resource/packArchive.cc \
+					../../../source/console/scriptImage.cc \
+					../../../source/2d/scene/ScenePrefab.cc \
 					../../../source/2d/scene/SceneRenderFactories.cpp \
 					../../../source/2d/scene/SceneRenderQueue.cpp \
 					../../../source/2d/scene/WorldQuery.cc \
@@ -219,6 +225,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/assets/assetBase.cc \
 					../../../source/assets/assetFieldTypes.cc \
 					../../../source/assets/assetManager.cc \
+					../../../source/assets/assetScanCache.cc \
 					../../../source/assets/assetQuery.cc \
 					../../../source/assets/assetTagsManifest.cc \
 					../../../source/assets/declaredAssets.cc \
@@ -400,6 +407,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/persistence/taml/tamlCustom.cc \
 					../../../source/persistence/taml/tamlWriteNode.cc \
 					../../../source/persistence/taml/xml/tamlXmlParser.cc \
+					../../../source/persistence/taml/xml/tamlXmlDocument.cc \
 					../../../source/persistence/taml/xml/tamlXmlReader.cc \
 					../../../source/persistence/taml/xml/tamlXmlWriter.cc \
 					../../../source/persistence/tinyXML/tinystr.cpp \
@@ -411,7 +419,10 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/audio/audioDataBlock.cc \
 					../../../source/audio/audio_ScriptBinding.cc \
 					../../../source/audio/audioStreamSourceFactory.cc \
-					../../../source/audio/wavStreamSource.cc \
+					../../../source/audio/wavStreamDecoder.cc \
+					../../../source/audio/bufferedStreamSource.cc \
+					../../../source/audio/audioStreamThread.cc \
+					../../../source/audio/audioRingBuffer.cc \
 					../../../source/component/dynamicConsoleMethodComponent.cpp \
 					../../../source/component/simComponent.cpp \
 					../../../source/component/behaviors/behaviorComponent.cpp \
@@ -466,6 +477,8 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/platform/menus/popupMenu.cc \
 					../../../source/platform/nativeDialogs/msgBox.cpp \
 					../../../source/platform/Tickable.cc \
+					../../../source/game/frameScheduler.cc \
+					../../../source/platform/threads/workerPool.cc \
 					../../../source/platformAndroid/AndroidAlerts.cpp \
 					../../../source/platformAndroid/AndroidAudio.cpp \
 					../../../source/platformAndroid/AndroidConsole.cpp \
@@ -573,7 +586,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 #					../../../source/testing/unitTesting.cc
  
 ifeq ($(APP_OPTIM),debug)
-	LOCAL_CFLAGS := -DENABLE_CONSOLE_MSGS -D__ANDROID__ -DTORQUE_DEBUG -DTORQUE_OS_ANDROID -DGL_GLEXT_PROTOTYPES -O0 -fsigned-char   
+	LOCAL_CFLAGS := -DENABLE_CONSOLE_MSGS -D__ANDROID__ -DTORQUE_DEBUG -DTORQUE_ALLOW_JOURNALING -DTORQUE_OS_ANDROID -DGL_GLEXT_PROTOTYPES -O0 -fsigned-char   
 else
 	LOCAL_CFLAGS := -DENABLE_CONSOLE_MSGS -D__ANDROID__ -DTORQUE_OS_ANDROID -DGL_GLEXT_PROTOTYPES -O3 -fsigned-char   
 endif				   
@@ -468,6 +468,34 @@ void ParticleAsset::moveEmitter( S32 fromIndex, S32 toIndex )
    mEmitters.erase( fromItr );
 }
 
+//-----------------------------------------------------------------------------
+
+U32 ParticleAsset::getBakedFieldMemory( void ) const
+{
+    // Fetch the asset fields.
+    U32 bakedMemory = mParticleFields.getBakedMemory();
+
+    // Add the emitter fields.
+    for( typeEmitterVector::const_iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+        bakedMemory += (*emitterItr)->getParticleFields().getBakedMemory();
+
+    return bakedMemory;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAsset::getBakedFieldError( void ) const
+{
+    // Fetch the asset fields.
+    F32 bakedError = mParticleFields.getBakedError();
+
+    // Add the emitter fields.
+    for( typeEmitterVector::const_iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+        bakedError = getMax( bakedError, (*emitterItr)->getParticleFields().getBakedError() );
+
+    return bakedError;
+}
+
 //------------------------------------------------------------------------------
 
 void ParticleAsset::onTamlCustomWrite( TamlCustomNodes& customNodes )
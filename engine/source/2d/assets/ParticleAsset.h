@@ -115,6 +115,9 @@ public:
     ParticleAssetEmitter* findEmitter( const char* pEmitterName ) const;
     void moveEmitter( S32 fromIndex, S32 toIndex );
 
+    U32 getBakedFieldMemory( void ) const;
+    F32 getBakedFieldError( void ) const;
+
     virtual U32 getTamlChildCount( void ) const
     {
         return (U32)mEmitters.size();
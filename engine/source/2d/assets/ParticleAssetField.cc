@@ -30,6 +30,10 @@
 #include "math/mMath.h"
 #endif
 
+#ifndef _SMALLVECTOR_H_
+#include "collection/smallVector.h"
+#endif
+
 #ifndef _SIMBASE_H_
 #include "sim/simBase.h"
 #endif
@@ -64,10 +68,14 @@ ParticleAssetField::ParticleAssetField() :
                         mMaxValue( 0.0f ),
                         mDefaultValue( 1.0f ),
                         mValueScale( 1.0f ),
-                        mValueBoundsDirty( true )
+                        mValueBoundsDirty( true ),
+                        mBakedSampleScale( 0.0f ),
+                        mBakedConstant( 0.0f ),
+                        mBakedError( 0.0f )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mBakedSamples );
 }
 
 //-----------------------------------------------------------------------------
@@ -170,6 +178,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Bake the data keys.
+    bakeDataKeys();
 }
 
 //-----------------------------------------------------------------------------
@@ -223,6 +234,9 @@ bool ParticleAssetField::setValueScale( const F32 valueScale )
     // Set Value Scale/
     mValueScale = valueScale;
 
+    // Bake the data keys.
+    bakeDataKeys();
+
     // Return Okay.
     return true;
 }
@@ -273,6 +287,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Bake the data keys.
+            bakeDataKeys();
+
             // Return Index.
             return index;
         }
@@ -289,6 +306,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Bake the data keys.
+    bakeDataKeys();
+
     // Return Index.
     return index;
 }
@@ -316,6 +336,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Bake the data keys.
+    bakeDataKeys();
+
     // Return Okay.
     return true;
 }
@@ -343,6 +366,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Bake the data keys.
+    bakeDataKeys();
+
     // Return Okay.
     return true;
 }
@@ -398,10 +424,29 @@ const ParticleAssetField::DataKey& ParticleAssetField::getDataKey( const U32 ind
 //-----------------------------------------------------------------------------
 
 F32 ParticleAssetField::getFieldValue( F32 time ) const
+{
+    // Return the constant value if there are no samples or we're using zero time.
+    if ( mIsZero(time) || mBakedSamples.size() == 0 )
+        return mBakedConstant;
+
+    // Clamp Key-Time.
+    time = getMin(getMax( 0.0f, time ), mMaxTime);
+
+    // Repeat Time.
+    if ( mRepeatTime != 1.0f )
+        time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
+
+    // Return the baked value.
+    return sampleBakedValue( time );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::getFieldValueExact( F32 time ) const
 {
     // Return First Entry if it's the only one or we're using zero time.
     if ( mIsZero(time) || getDataKeyCount() < 2)
-        return mDataKeys[0].mValue * mValueScale;
+        return mBakedConstant;
 
     // Clamp Key-Time.
     time = getMin(getMax( 0.0f, time ), mMaxTime);
@@ -409,12 +454,20 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     // Repeat Time.
     time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
 
+    // Return the evaluated value.
+    return evaluateDataKeys( time ) * mValueScale;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::evaluateDataKeys( const F32 time ) const
+{
     // Fetch Max Key Index.
     const U32 maxKeyIndex = getDataKeyCount()-1;
 
     // Return Last Value if we're on/past the last time.
     if ( time >= mDataKeys[maxKeyIndex].mTime )
-        return mDataKeys[maxKeyIndex].mValue * mValueScale;
+        return mDataKeys[maxKeyIndex].mValue;
 
     // Find Data-Key Indexes.
     U32 index1;
@@ -423,9 +476,9 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
         if ( mDataKeys[index1].mTime >= time )
             break;
 
-    // If we're exactly on a Data-Key then return that key.
-    if ( mIsEqual( mDataKeys[index1].mTime, time) )
-        return mDataKeys[index1].mValue * mValueScale;
+    // If we're exactly on (or before) a Data-Key then return that key.
+    if ( index1 == 0 || mIsEqual( mDataKeys[index1].mTime, time) )
+        return mDataKeys[index1].mValue;
 
     // Set Adjacent Indexes.
     index2 = index1--;
@@ -437,7 +490,61 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     const F32 dTime = (time-time1)/(time2-time1);
 
     // Return lerped Value.
-    return ((mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime)) * mValueScale;
+    return (mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime);
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::bakeDataKeys( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleAssetField_BakeDataKeys);
+
+    // Fetch key count.
+    const U32 keyCount = getDataKeyCount();
+
+    // Set the constant value.
+    mBakedConstant = (keyCount == 0 ? mDefaultValue : mDataKeys[0].mValue) * mValueScale;
+    mBakedError = 0.0f;
+
+    // Finish if there's nothing to interpolate.
+    if ( keyCount < 2 )
+    {
+        mBakedSamples.clear();
+        mBakedSamples.compact();
+        mBakedSampleScale = 0.0f;
+        return;
+    }
+
+    // Calculate the largest error we'll accept.
+    // NOTE:-   The baked curve is exact at every sample so the interpolation error can only peak at a data-key
+    //          that falls between samples.  We raise the resolution until those keys are within tolerance.
+    const F32 errorTolerance = (mMaxValue - mMinValue) * mValueScale * 0.001f;
+
+    for ( U32 intervals = BakedIntervalsMin; intervals <= BakedIntervalsMax; intervals *= 4 )
+    {
+        // Resample the data keys.
+        mBakedSamples.setSize( intervals + 1 );
+        mBakedSampleScale = (F32)intervals / mMaxTime;
+        const F32 sampleTime = mMaxTime / (F32)intervals;
+        for ( U32 sampleIndex = 0; sampleIndex <= intervals; ++sampleIndex )
+            mBakedSamples[sampleIndex] = evaluateDataKeys( (F32)sampleIndex * sampleTime ) * mValueScale;
+
+        // Calculate the interpolation error at the data keys.
+        mBakedError = 0.0f;
+        for ( U32 keyIndex = 0; keyIndex < keyCount; ++keyIndex )
+        {
+            const DataKey& dataKey = mDataKeys[keyIndex];
+            mBakedError = getMax( mBakedError, mFabs( sampleBakedValue( dataKey.mTime ) - dataKey.mValue * mValueScale ) );
+        }
+
+        // Finish if we're within tolerance.
+        if ( mBakedError <= errorTolerance )
+            break;
+    }
+
+    // Release any unused samples.
+    mBakedSamples.compact();
 }
 
 //-----------------------------------------------------------------------------
@@ -567,7 +674,7 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
     F32 valueScale = getValueScale();
 
     // Set-up a temporary set of keys.
-    Vector<DataKey> keys;
+    SmallVector<DataKey, 16> keys;
 
     // Clear the existing keys.
     mDataKeys.clear();
@@ -679,8 +786,12 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
     // Set the repeat time.
     setRepeatTime( repeatTime );
 
-    // Set the data keys.
-    mDataKeys = keys;
+    // Set the data keys (if any were found).
+    if ( keys.size() > 0 )
+        mDataKeys.set( keys.address(), keys.size() );
+
+    // Bake the data keys.
+    bakeDataKeys();
 }
 
 //-----------------------------------------------------------------------------
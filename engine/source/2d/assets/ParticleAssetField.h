@@ -58,6 +58,13 @@ public:
 
     static ParticleAssetField::DataKey BadDataKey;
 
+    /// Baked lookup-table resolution.
+    enum
+    {
+        BakedIntervalsMin = 64,
+        BakedIntervalsMax = 1024,
+    };
+
 private:
     StringTableEntry mFieldName;
     F32 mRepeatTime;
@@ -71,6 +78,26 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    /// Baked lookup-table.
+    Vector<F32> mBakedSamples;
+    F32 mBakedSampleScale;
+    F32 mBakedConstant;
+    F32 mBakedError;
+
+    void bakeDataKeys( void );
+    F32 evaluateDataKeys( const F32 time ) const;
+    inline F32 sampleBakedValue( const F32 time ) const
+    {
+        // Calculate the sample position.
+        const F32 samplePosition = time * mBakedSampleScale;
+        const U32 sampleIndex = getMin( (U32)samplePosition, (U32)mBakedSamples.size()-2 );
+        const F32 sampleDelta = samplePosition - (F32)sampleIndex;
+
+        // Return lerped sample.
+        const F32* pSamples = mBakedSamples.address() + sampleIndex;
+        return pSamples[0] + (pSamples[1] - pSamples[0]) * sampleDelta;
+    }
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -104,6 +131,11 @@ public:
     inline U32 getDataKeyCount( void ) const { return (U32)mDataKeys.size(); }
     const DataKey& getDataKey( const U32 index ) const;
     F32 getFieldValue( F32 time ) const;
+    F32 getFieldValueExact( F32 time ) const;
+
+    inline U32 getBakedSampleCount( void ) const { return (U32)mBakedSamples.size(); }
+    inline U32 getBakedMemory( void ) const { return (U32)mBakedSamples.memSize(); }
+    inline F32 getBakedError( void ) const { return mBakedError; }
 
     static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
     static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
@@ -419,6 +419,32 @@ F32 ParticleAssetFieldCollection::getValueScale( void ) const
     return mpSelectedField->getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+U32 ParticleAssetFieldCollection::getBakedMemory( void ) const
+{
+    U32 bakedMemory = 0;
+
+    // Iterate the fields.
+    for( typeFieldHash::const_iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+        bakedMemory += fieldItr->value->getBakedMemory();
+
+    return bakedMemory;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetFieldCollection::getBakedError( void ) const
+{
+    F32 bakedError = 0.0f;
+
+    // Iterate the fields.
+    for( typeFieldHash::const_iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+        bakedError = getMax( bakedError, fieldItr->value->getBakedError() );
+
+    return bakedError;
+}
+
 //------------------------------------------------------------------------------
 
 void ParticleAssetFieldCollection::onTamlCustomWrite( TamlCustomNodes& customNodes )
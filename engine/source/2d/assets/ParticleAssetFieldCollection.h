@@ -81,6 +81,9 @@ public:
     bool setValueScale( const F32 valueScale );
     F32 getValueScale( void ) const;    
 
+    U32 getBakedMemory( void ) const;
+    F32 getBakedError( void ) const;
+
     void onTamlCustomWrite( TamlCustomNodes& customNodes );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
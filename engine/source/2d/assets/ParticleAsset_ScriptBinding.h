@@ -468,4 +468,24 @@ ConsoleMethodWithDocs(ParticleAsset, moveEmitter, ConsoleVoid, 4, 4, (fromEmitte
    object->moveEmitter( dAtoi(argv[2]), dAtoi(argv[3]) );
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Gets the memory used by the baked lookup-tables of all the asset and emitter fields.
+    @return The memory (in bytes) used by the baked lookup-tables.
+*/
+ConsoleMethodWithDocs(ParticleAsset, getBakedFieldMemory, ConsoleInt, 2, 2, ())
+{
+   return object->getBakedFieldMemory();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the largest interpolation error of the baked lookup-tables of all the asset and emitter fields.
+    @return The largest interpolation error (in field value units) of the baked lookup-tables.
+*/
+ConsoleMethodWithDocs(ParticleAsset, getBakedFieldError, ConsoleFloat, 2, 2, ())
+{
+   return object->getBakedFieldError();
+}
+
 ConsoleMethodGroupEndWithDocs(ParticleAsset)
\ No newline at end of file
@@ -46,8 +46,46 @@ BatchRender::BatchRender() :
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mBatchEnabled( true ),
+    mpRenderStream( NULL )
 {
+    // Allocate the batch buffers.
+    mVertexBuffer = new Vector2[ BATCHRENDER_BUFFERSIZE ];
+    mTextureBuffer = new Vector2[ BATCHRENDER_BUFFERSIZE ];
+    mIndexBuffer = new U16[ BATCHRENDER_BUFFERSIZE ];
+    mColorBuffer = new ColorF[ BATCHRENDER_BUFFERSIZE ];
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRender::BatchRender( BatchRenderStream* pRenderStream ) :
+    mTriangleCount( 0 ),
+    mVertexCount( 0 ),
+    mTextureCoordCount( 0 ),
+    mIndexCount( 0 ),
+    mColorCount( 0 ),
+    mVertexBuffer( NULL ),
+    mTextureBuffer( NULL ),
+    mIndexBuffer( NULL ),
+    mColorBuffer( NULL ),
+    NoColor( -1.0f, -1.0f, -1.0f ),
+    mStrictOrderMode( false ),
+    mpDebugStats( NULL ),
+    mBlendMode( true ),
+    mSrcBlendFactor( GL_SRC_ALPHA ),
+    mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
+    mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
+    mAlphaTestMode( -1.0f ),
+    mWireframeMode( false ),
+    mBatchEnabled( true ),
+    mpRenderStream( pRenderStream )
+{
+    // Sanity!
+    AssertFatal( pRenderStream != NULL, "BatchRender() - Cannot record into a NULL stream." );
+
+    // Use the stream debug stats so that flush reasons can be recorded.
+    // NOTE:- A recording batch renderer never batches itself so no buffers are allocated.
+    mpDebugStats = pRenderStream->getDebugStats();
 }
 
 //-----------------------------------------------------------------------------
@@ -67,6 +105,12 @@ BatchRender::~BatchRender()
         delete (*itr);
     }
     mIndexVectorPool.clear();
+
+    // Destroy the batch buffers.
+    delete [] mVertexBuffer;
+    delete [] mTextureBuffer;
+    delete [] mIndexBuffer;
+    delete [] mColorBuffer;
 }
 
 //-----------------------------------------------------------------------------
@@ -114,6 +158,13 @@ void BatchRender::SubmitTriangles(
     AssertFatal( vertexCount % 3 == 0, "BatchRender::SubmitTriangles() - Invalid vertex count, cannot represent whole triangles." );
     AssertFatal( vertexCount <= BATCHRENDER_BUFFERSIZE, "BatchRender::SubmitTriangles() - Invalid vertex count." );
 
+    // Record if recording.
+    if ( mpRenderStream != NULL )
+    {
+        mpRenderStream->recordTriangles( vertexCount, pVertexArray, pTextureArray, texture, color );
+        return;
+    }
+
     // Calculate triangle count.
     const U32 triangleCount = vertexCount / 3;
 
@@ -236,6 +287,16 @@ void BatchRender::SubmitQuad(
     // Debug Profiling.
     PROFILE_SCOPE(BatchRender_SubmitQuad);
 
+    // Record if recording.
+    if ( mpRenderStream != NULL )
+    {
+        mpRenderStream->recordQuad(
+            vertexPos0, vertexPos1, vertexPos2, vertexPos3,
+            texturePos0, texturePos1, texturePos2, texturePos3,
+            texture, color );
+        return;
+    }
+
     // Would we exceed the triangle buffer size?
     if ( (mTriangleCount + 2) > BATCHRENDER_MAXTRIANGLES )
     {
@@ -332,8 +393,146 @@ void BatchRender::SubmitQuad(
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::SubmitQuads(
+        const U32 quadCount,
+        const Vector2* pVertexArray,
+        const Vector2* pTextureArray,
+        TextureHandle& texture,
+        const ColorF& color )
+{
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitQuads);
+
+    // Submit individually if recording or batching is disabled.
+    // NOTE:- The quads are stored as #0, #1, #3, #2 so we swap #2/#3 back here.
+    if ( mpRenderStream != NULL || !mBatchEnabled )
+    {
+        for( U32 n = 0; n < quadCount; ++n, pVertexArray += 4, pTextureArray += 4 )
+        {
+            SubmitQuad(
+                pVertexArray[0], pVertexArray[1], pVertexArray[3], pVertexArray[2],
+                pTextureArray[0], pTextureArray[1], pTextureArray[3], pTextureArray[2],
+                texture, color );
+        }
+        return;
+    }
+
+    U32 quadsRemaining = quadCount;
+
+    while( quadsRemaining > 0 )
+    {
+        // Would we exceed the triangle buffer size?
+        if ( (mTriangleCount + 2) > BATCHRENDER_MAXTRIANGLES )
+        {
+            // Yes, so flush.
+            flush( mpDebugStats->batchBufferFullFlush );
+        }
+        // Do we have anything batched?
+        else if ( mTriangleCount > 0 )
+        {
+            // Yes, so do we have any existing colors?
+            if ( mColorCount == 0 )
+            {
+                // No, so flush if color is specified.
+                if ( color != NoColor  )
+                    flush( mpDebugStats->batchColorStateFlush );
+            }
+            else
+            {
+                // Yes, so flush if color is not specified.
+                if ( color == NoColor  )
+                    flush( mpDebugStats->batchColorStateFlush );
+            }
+        }
+
+        // Strict order mode?
+        if ( mStrictOrderMode )
+        {
+            // Yes, so is there a texture change?
+            if ( texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
+            {
+                // Yes, so flush.
+                flush( mpDebugStats->batchTextureChangeFlush );
+            }
+
+            // Set strict order mode texture handle.
+            mStrictOrderTextureHandle = texture;
+        }
+
+        // Calculate how many quads fit in the buffer.
+        // NOTE:- This is the same point at which individually submitted quads would flush.
+        const U32 quads = getMin( quadsRemaining, (BATCHRENDER_MAXTRIANGLES - mTriangleCount) / 2 );
+        const U32 vertexCount = quads * 4;
+
+        // Strict order mode?
+        if ( mStrictOrderMode )
+        {
+            // Yes, so add new indices.
+            U16 vertexIndex = (U16)mVertexCount;
+            for( U32 n = 0; n < quads; ++n, vertexIndex += 4 )
+            {
+                mIndexBuffer[mIndexCount++] = vertexIndex;
+                mIndexBuffer[mIndexCount++] = vertexIndex+1;
+                mIndexBuffer[mIndexCount++] = vertexIndex+2;
+                mIndexBuffer[mIndexCount++] = vertexIndex+3;
+                mIndexBuffer[mIndexCount++] = vertexIndex+2;
+                mIndexBuffer[mIndexCount++] = vertexIndex+1;
+            }
+        }
+        else
+        {
+            // No, so add a single triangle run for all the quads.
+            findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, quads, mVertexCount ) );
+        }
+
+        // Is a color specified?
+        if ( color != NoColor )
+        {
+            // Yes, so add colors.
+            for( U32 n = 0; n < vertexCount; ++n )
+            {
+                mColorBuffer[mColorCount++] = color;
+            }
+        }
+
+        // Add textured vertices.
+        dMemcpy( mVertexBuffer + mVertexCount, pVertexArray, vertexCount * sizeof(Vector2) );
+        dMemcpy( mTextureBuffer + mTextureCoordCount, pTextureArray, vertexCount * sizeof(Vector2) );
+        mVertexCount += vertexCount;
+        mTextureCoordCount += vertexCount;
+        pVertexArray += vertexCount;
+        pTextureArray += vertexCount;
+
+        // Stats.
+        mpDebugStats->batchTrianglesSubmitted += quads * 2;
+
+        // Increase triangle count.
+        mTriangleCount += quads * 2;
+        quadsRemaining -= quads;
+
+        // Have we reached the buffer limit?
+        if ( mTriangleCount == BATCHRENDER_MAXTRIANGLES )
+        {
+            // Yes, so flush.
+            flush( mpDebugStats->batchBufferFullFlush );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::flush( U32& reasonMetric )
 {
+    // Record if recording.
+    if ( mpRenderStream != NULL )
+    {
+        mpRenderStream->recordFlush( reasonMetric );
+        return;
+    }
+
     // Finish if no triangles to flush.
     if ( mTriangleCount == 0 )
         return;
@@ -349,6 +548,13 @@ void BatchRender::flush( U32& reasonMetric )
 
 void BatchRender::flush( void )
 {
+    // Record if recording.
+    if ( mpRenderStream != NULL )
+    {
+        mpRenderStream->recordFlush();
+        return;
+    }
+
     // Finish if no triangles to flush.
     if ( mTriangleCount == 0 )
         return;
@@ -494,6 +700,9 @@ void BatchRender::flushInternal( void )
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
+
+                        // Move to the next quad.
+                        triangleIndex += 4;
                     }
                 }
                 else if ( primitiveMode == TriangleRun::TRIANGLE )
@@ -590,7 +799,7 @@ BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& hand
         else
         {
             // No, so generate one.
-            pIndexVector = new indexVectorType( 6 * 6 );
+            pIndexVector = new indexVectorType();
         }
 
         // Insert into texture batch map.
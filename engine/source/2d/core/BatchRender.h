@@ -43,10 +43,18 @@
 #include "collection/hashTable.h"
 #endif
 
+#ifndef _SMALLVECTOR_H_
+#include "collection/smallVector.h"
+#endif
+
 #ifndef _COLOR_H_
 #include "graphics/color.h"
 #endif
 
+#ifndef _BATCH_RENDER_STREAM_H_
+#include "2d/core/BatchRenderStream.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define BATCHRENDER_BUFFERSIZE      (65535)
@@ -80,7 +88,8 @@ private:
         U32 mStartIndex;
     };
 
-    typedef Vector<TriangleRun> indexVectorType;
+    // NOTE:- Most texture batches only hold a few triangle runs so they are kept inline.
+    typedef SmallVector<TriangleRun, 6 * 6> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
 
     VectorPtr< indexVectorType* > mIndexVectorPool;
@@ -88,10 +97,10 @@ private:
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
-    U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
+    Vector2*            mVertexBuffer;
+    Vector2*            mTextureBuffer;
+    U16*                mIndexBuffer;
+    ColorF*             mColorBuffer;
    
     U32                 mTriangleCount;
     U32                 mVertexCount;
@@ -112,13 +121,29 @@ private:
     bool                mWireframeMode;
     bool                mBatchEnabled;
 
+    BatchRenderStream*  mpRenderStream;
+
 public:
     BatchRender();
     virtual ~BatchRender();
 
+    /// Create a batch renderer that records into a stream rather than rendering.
+    /// A recording batch renderer doesn't touch the GL so it can be used away from the main thread.
+    BatchRender( BatchRenderStream* pRenderStream );
+
+    /// Gets whether the batch renderer is recording into a stream.
+    inline bool getRecording( void ) const { return mpRenderStream != NULL; }
+
     /// Set the strict order mode.
     inline void setStrictOrderMode( const bool strictOrder, const bool forceFlush = false )
     {
+        // Record if recording.
+        if ( mpRenderStream != NULL )
+        {
+            mpRenderStream->recordStrictOrderMode( strictOrder, forceFlush );
+            return;
+        }
+
         // Ignore if no change.
         if ( !forceFlush && strictOrder == mStrictOrderMode )
             return;
@@ -136,6 +161,13 @@ public:
     /// Turns-on blend mode with the specified blend factors and color.
     inline void setBlendMode( GLenum srcFactor, GLenum dstFactor, const ColorF& blendColor = ColorF(1.0f, 1.0f, 1.0f, 1.0f))
     {
+        // Record if recording.
+        if ( mpRenderStream != NULL )
+        {
+            mpRenderStream->recordBlendMode( srcFactor, dstFactor, blendColor );
+            return;
+        }
+
         // Ignore no change.
         if (    mBlendMode &&
                 mSrcBlendFactor == srcFactor &&
@@ -155,6 +187,13 @@ public:
     /// Turns-off blend mode.
     inline void setBlendOff( void )
     {
+        // Record if recording.
+        if ( mpRenderStream != NULL )
+        {
+            mpRenderStream->recordBlendOff();
+            return;
+        }
+
         // Ignore no change,
         if ( !mBlendMode )
             return;
@@ -171,6 +210,13 @@ public:
     /// Set alpha-test mode.
     void setAlphaTestMode( const F32 alphaTestMode )
     {
+        // Record if recording.
+        if ( mpRenderStream != NULL )
+        {
+            mpRenderStream->recordAlphaTestMode( alphaTestMode );
+            return;
+        }
+
         // Ignore no change.
         if ( mIsEqual( mAlphaTestMode, alphaTestMode ) )
             return;
@@ -219,6 +265,9 @@ public:
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
+    /// Gets the debug stats in use.
+    inline DebugStats* getDebugStats( void ) const { return mpDebugStats; }
+
     /// Submit triangles for batching.
     /// Vertex and textures are indexed as:
     ///  2        5
@@ -250,6 +299,17 @@ public:
             TextureHandle& texture,
             const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
 
+    /// Submit quads for batching.
+    /// The vertices and textures are four per-quad in the order the batch renderer stores them
+    /// which is #0, #1, #3, #2 of the order used by SubmitQuad().  This is equivalent to calling
+    /// SubmitQuad() for each quad but copies the quads in as few runs as possible.
+    void SubmitQuads(
+            const U32 quadCount,
+            const Vector2* pVertexArray,
+            const Vector2* pTextureArray,
+            TextureHandle& texture,
+            const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
+
     /// Render a quad immediately without affecting current batch.
     /// All render state should be set beforehand directly.
     /// Vertex and textures are indexed as:
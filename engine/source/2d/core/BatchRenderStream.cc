@@ -0,0 +1,254 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/BatchRenderStream.h"
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+BatchRenderStream::BatchRenderStream() :
+    mSegmentStart( 0 )
+{
+    // Set debug associations.
+    VECTOR_SET_ASSOCIATION( mCommands );
+    VECTOR_SET_ASSOCIATION( mVertices );
+    VECTOR_SET_ASSOCIATION( mTextureCoords );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::clear( void )
+{
+    mCommands.clear();
+    mVertices.clear();
+    mTextureCoords.clear();
+    mSegmentStart = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRenderStream::Command& BatchRenderStream::addCommand( const Command::CommandType commandType )
+{
+    mCommands.increment();
+    Command& command = mCommands.last();
+    command.mType = commandType;
+    command.mCount = 0;
+    command.mVertexStart = 0;
+    command.mpTexture = NULL;
+    command.mFlag = false;
+    return command;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordBlendMode( GLenum srcFactor, GLenum dstFactor, const ColorF& blendColor )
+{
+    Command& command = addCommand( Command::BLEND_MODE );
+    command.mSrcBlendFactor = srcFactor;
+    command.mDstBlendFactor = dstFactor;
+    command.mColor = blendColor;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordBlendOff( void )
+{
+    addCommand( Command::BLEND_OFF );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordAlphaTestMode( const F32 alphaTestMode )
+{
+    Command& command = addCommand( Command::ALPHA_TEST );
+    command.mAlphaTestMode = alphaTestMode;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordStrictOrderMode( const bool strictOrder, const bool forceFlush )
+{
+    Command& command = addCommand( Command::STRICT_ORDER );
+    command.mFlag = strictOrder;
+    command.mCount = forceFlush ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordQuad(
+        const Vector2& vertexPos0,
+        const Vector2& vertexPos1,
+        const Vector2& vertexPos2,
+        const Vector2& vertexPos3,
+        const Vector2& texturePos0,
+        const Vector2& texturePos1,
+        const Vector2& texturePos2,
+        const Vector2& texturePos3,
+        TextureHandle& texture,
+        const ColorF& color )
+{
+    // Can we add to the previous quads?
+    // NOTE:- Consecutive quads with the same texture and color are submitted together.
+    Command* pCommand = NULL;
+    if ( (U32)mCommands.size() > mSegmentStart )
+    {
+        Command& lastCommand = mCommands.last();
+        if ( lastCommand.mType == Command::QUADS && lastCommand.mpTexture == &texture && lastCommand.mColor == color )
+            pCommand = &lastCommand;
+    }
+
+    // Start new quads if we cannot.
+    if ( pCommand == NULL )
+    {
+        pCommand = &addCommand( Command::QUADS );
+        pCommand->mVertexStart = (U32)mVertices.size();
+        pCommand->mpTexture = &texture;
+        pCommand->mColor = color;
+    }
+
+    // Add the quad.
+    pCommand->mCount++;
+
+    // Add the vertices in the order the batch renderer uses.
+    // NOTE: We swap #2/#3 here.
+    mVertices.push_back( vertexPos0 );
+    mVertices.push_back( vertexPos1 );
+    mVertices.push_back( vertexPos3 );
+    mVertices.push_back( vertexPos2 );
+    mTextureCoords.push_back( texturePos0 );
+    mTextureCoords.push_back( texturePos1 );
+    mTextureCoords.push_back( texturePos3 );
+    mTextureCoords.push_back( texturePos2 );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordTriangles(
+        const U32 vertexCount,
+        const Vector2* pVertexArray,
+        const Vector2* pTextureArray,
+        TextureHandle& texture,
+        const ColorF& color )
+{
+    Command& command = addCommand( Command::TRIANGLES );
+    command.mCount = vertexCount;
+    command.mVertexStart = (U32)mVertices.size();
+    command.mpTexture = &texture;
+    command.mColor = color;
+
+    mVertices.increment( pVertexArray, vertexCount );
+    mTextureCoords.increment( pTextureArray, vertexCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordFlush( const U32& reasonMetric )
+{
+    // Calculate where the reason metric is in the debug stats.
+    const U32 metricOffset = (U32)((const U8*)&reasonMetric - (const U8*)&mDebugStats);
+
+    // Sanity!
+    AssertFatal( metricOffset < sizeof(DebugStats), "BatchRenderStream::recordFlush() - The reason metric must be one of the batch renderer debug stats." );
+
+    Command& command = addCommand( Command::FLUSH );
+    command.mCount = metricOffset;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::recordFlush( void )
+{
+    addCommand( Command::FLUSH_ANONYMOUS );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderStream::submit( BatchRender* pBatchRenderer, const U32 commandStart, const U32 commandEnd ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRenderStream_Submit);
+
+    // Sanity!
+    AssertFatal( pBatchRenderer != NULL, "BatchRenderStream::submit() - Cannot submit to a NULL batch renderer." );
+    AssertFatal( commandStart <= commandEnd && commandEnd <= (U32)mCommands.size(), "BatchRenderStream::submit() - Invalid command range." );
+
+    for ( U32 commandIndex = commandStart; commandIndex < commandEnd; ++commandIndex )
+    {
+        // Fetch command.
+        const Command& command = mCommands[commandIndex];
+
+        switch( command.mType )
+        {
+            case Command::BLEND_MODE:
+                pBatchRenderer->setBlendMode( command.mSrcBlendFactor, command.mDstBlendFactor, command.mColor );
+                break;
+
+            case Command::BLEND_OFF:
+                pBatchRenderer->setBlendOff();
+                break;
+
+            case Command::ALPHA_TEST:
+                pBatchRenderer->setAlphaTestMode( command.mAlphaTestMode );
+                break;
+
+            case Command::STRICT_ORDER:
+                pBatchRenderer->setStrictOrderMode( command.mFlag, command.mCount != 0 );
+                break;
+
+            case Command::QUADS:
+                pBatchRenderer->SubmitQuads(
+                    command.mCount,
+                    mVertices.address() + command.mVertexStart,
+                    mTextureCoords.address() + command.mVertexStart,
+                    *command.mpTexture,
+                    command.mColor );
+                break;
+
+            case Command::TRIANGLES:
+                pBatchRenderer->SubmitTriangles(
+                    command.mCount,
+                    mVertices.address() + command.mVertexStart,
+                    mTextureCoords.address() + command.mVertexStart,
+                    *command.mpTexture,
+                    command.mColor );
+                break;
+
+            case Command::FLUSH:
+                pBatchRenderer->flush( *(U32*)((U8*)pBatchRenderer->getDebugStats() + command.mCount) );
+                break;
+
+            case Command::FLUSH_ANONYMOUS:
+                pBatchRenderer->flush();
+                break;
+
+            default:
+                // Sanity!
+                AssertFatal( false, "BatchRenderStream::submit() - Unrecognized command encountered." );
+        }
+    }
+}
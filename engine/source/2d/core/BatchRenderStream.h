@@ -0,0 +1,139 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BATCH_RENDER_STREAM_H_
+#define _BATCH_RENDER_STREAM_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _DEBUG_STATS_H_
+#include "2d/scene/DebugStats.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _COLOR_H_
+#include "graphics/color.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class BatchRender;
+
+//-----------------------------------------------------------------------------
+
+/// A recording of the calls made to a batch renderer.
+/// A batch renderer that is given a stream records into it rather than rendering which allows
+/// vertices to be generated away from the main thread.  The stream is then submitted to a
+/// real batch renderer on the main thread which repeats the same state changes and flushes in
+/// the same order so the rendering and the debug stats are identical to rendering directly.
+///
+/// Recorded textures are held by reference so they must remain valid until the stream is submitted.
+class BatchRenderStream
+{
+private:
+    struct Command
+    {
+        enum CommandType
+        {
+            BLEND_MODE,
+            BLEND_OFF,
+            ALPHA_TEST,
+            STRICT_ORDER,
+            QUADS,
+            TRIANGLES,
+            FLUSH,
+            FLUSH_ANONYMOUS,
+        };
+
+        CommandType     mType;
+        U32             mCount;
+        U32             mVertexStart;
+        TextureHandle*  mpTexture;
+        ColorF          mColor;
+        GLenum          mSrcBlendFactor;
+        GLenum          mDstBlendFactor;
+        F32             mAlphaTestMode;
+        bool            mFlag;
+    };
+
+    typedef Vector<Command> typeCommandVector;
+
+    typeCommandVector   mCommands;
+    Vector<Vector2>     mVertices;
+    Vector<Vector2>     mTextureCoords;
+    U32                 mSegmentStart;
+
+    /// The debug stats the recording batch renderer uses so flush reasons can be identified.
+    DebugStats          mDebugStats;
+
+public:
+    BatchRenderStream();
+    virtual ~BatchRenderStream() {}
+
+    /// Clear the recording but keep the storage.
+    void clear( void );
+
+    /// Start a new segment returning the first command of it.
+    /// Segments are submitted independently so commands are never merged across them.
+    inline U32 beginSegment( void ) { mSegmentStart = (U32)mCommands.size(); return mSegmentStart; }
+
+    inline U32 getCommandCount( void ) const { return (U32)mCommands.size(); }
+    inline DebugStats* getDebugStats( void ) { return &mDebugStats; }
+
+    /// Recording.
+    void recordBlendMode( GLenum srcFactor, GLenum dstFactor, const ColorF& blendColor );
+    void recordBlendOff( void );
+    void recordAlphaTestMode( const F32 alphaTestMode );
+    void recordStrictOrderMode( const bool strictOrder, const bool forceFlush );
+    void recordQuad(
+            const Vector2& vertexPos0,
+            const Vector2& vertexPos1,
+            const Vector2& vertexPos2,
+            const Vector2& vertexPos3,
+            const Vector2& texturePos0,
+            const Vector2& texturePos1,
+            const Vector2& texturePos2,
+            const Vector2& texturePos3,
+            TextureHandle& texture,
+            const ColorF& color );
+    void recordTriangles(
+            const U32 vertexCount,
+            const Vector2* pVertexArray,
+            const Vector2* pTextureArray,
+            TextureHandle& texture,
+            const ColorF& color );
+    void recordFlush( const U32& reasonMetric );
+    void recordFlush( void );
+
+    /// Submit the commands [commandStart, commandEnd) to a batch renderer.
+    void submit( BatchRender* pBatchRenderer, const U32 commandStart, const U32 commandEnd ) const;
+
+private:
+    Command& addCommand( const Command::CommandType commandType );
+};
+
+#endif // _BATCH_RENDER_STREAM_H_
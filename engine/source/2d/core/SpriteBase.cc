@@ -73,6 +73,32 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
 
 //------------------------------------------------------------------------------
 
+bool SpriteBase::canTickPassive( void ) const
+{
+    // Not if we're animating.
+    if ( !isStaticFrameProvider() && !isAnimationFinished() )
+        return false;
+
+    // Call parent.
+    return Parent::canTickPassive();
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBase::setAnimation( const char* pAnimationAssetId )
+{
+    // Call parent.
+    if ( !ImageFrameProvider::setAnimation( pAnimationAssetId ) )
+        return false;
+
+    // Make sure the animation is ticked.
+    activateTick();
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBase::validRender( void ) const
 {
     return ImageFrameProvider::validRender();
@@ -44,6 +44,9 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool canTickPassive( void ) const;
+
+    virtual bool setAnimation( const char* pAnimationAssetId );
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
@@ -28,6 +28,10 @@
 #include "2d/core/SpriteBatchQuery.h"
 #endif
 
+#ifndef _SPRITE_BATCH_CHUNK_H_
+#include "2d/core/SpriteBatchChunk.h"
+#endif
+
 #ifndef _SCENE_RENDER_OBJECT_H_
 #include "2d/scene/SceneRenderObject.h"
 #endif
@@ -46,12 +50,18 @@ SpriteBatch::SpriteBatch() :
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mBatchCulling( true ),
+    mBatchChunkSize( 0.0f )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
     mBatchTransformDirty = true;
     mBatchTransformId = 0;
+    mSpriteTransformsId = 0;
+
+    // Set debug associations.
+    VECTOR_SET_ASSOCIATION( mDirtySprites );
+    VECTOR_SET_ASSOCIATION( mDirtySlots );
 
     // Reset local extents.
     mLocalExtents.SetZero();
@@ -84,6 +94,9 @@ void SpriteBatch::onRemove()
 
     // Delete the sprite batch query.
     destroySpriteBatchQuery();
+
+    // Delete any batch chunks.
+    destroyBatchChunks();
 }
 
 //-----------------------------------------------------------------------------
@@ -99,6 +112,48 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     // Calculate local AABB.
     const b2AABB localAABB = calculateLocalAABB( pSceneRenderState->mRenderAABB );
 
+    // Are we chunking the sprites?
+    if ( mBatchChunkSize > 0.0f )
+    {
+        // Yes, so update the sprite local transforms which keeps the chunks up-to-date.
+        updateLocalTransforms();
+        if ( getLocalExtentsDirty() )
+            updateLocalExtents();
+
+        // Perform a render request for each chunk in view.
+        for( typeSpriteChunkHash::iterator chunkItr = mSpriteChunks.begin(); chunkItr != mSpriteChunks.end(); ++chunkItr )
+        {
+            // Fetch sprite batch chunk.
+            SpriteBatchChunk* pSpriteBatchChunk = chunkItr->value;
+
+            // Fetch the chunk local AABB.
+            const b2AABB& chunkAABB = pSpriteBatchChunk->getLocalAABB();
+
+            // Skip if culling and not in view.
+            if ( mBatchCulling && !b2TestOverlap( chunkAABB, localAABB ) )
+                continue;
+
+            // Create a render request.
+            // NOTE:- Only the chunk bounds are transformed here, the sprites are transformed as they are rendered.
+            SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+            pSceneRenderRequest->set(
+                pSceneRenderObject,
+                b2Mul( mBatchTransform, chunkAABB.GetCenter() ),
+                0.0f,
+                Vector2::getZero(),
+                (S32)pSpriteBatchChunk->getChunkKey(),
+                StringTable->EmptyString,
+                NULL,
+                pSpriteBatchChunk );
+        }
+
+        return;
+    }
+
+    // Update the sprite transforms.
+    // NOTE:- This also keeps the sprite batch query proxies up-to-date.
+    updateRenderTransforms();
+
     // Do we have a sprite batch query?
     if ( mpSpriteBatchQuery != NULL )
     {
@@ -138,7 +193,7 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
             SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
 
             // Prepare batch item.
-            pSpriteBatchItem->prepareRender( pSceneRenderRequest, mBatchTransformId );
+            pSpriteBatchItem->prepareRender( pSceneRenderRequest );
 
             // Set identity.
             pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
@@ -166,7 +221,7 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
             SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
 
             // Prepare batch item.
-            pSpriteBatchItem->prepareRender( pSceneRenderRequest, mBatchTransformId );
+            pSpriteBatchItem->prepareRender( pSceneRenderRequest );
 
             // Set identity.
             pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
@@ -181,11 +236,23 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
 
 void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Is this a sprite batch chunk?
+    if ( pSceneRenderRequest->mpCustomData2 != NULL )
+    {
+        // Yes, so batch render the chunk.
+        SpriteBatchChunk* pSpriteBatchChunk = (SpriteBatchChunk*)pSceneRenderRequest->mpCustomData2;
+        pSpriteBatchChunk->render( pBatchRenderer, mBatchTransform, mBatchTransformId );
+        return;
+    }
+
+    // Update the sprite transforms.
+    updateRenderTransforms();
+
     // Fetch sprite batch Item.
     SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
 
     // Batch render.
-    pSpriteBatchItem->render( pBatchRenderer, pSceneRenderRequest, mBatchTransformId );
+    pSpriteBatchItem->render( pBatchRenderer, pSceneRenderRequest );
 }
 
 //------------------------------------------------------------------------------
@@ -247,6 +314,191 @@ void SpriteBatch::moveQueryProxy( SpriteBatchItem* pSpriteBatchItem, const b2AAB
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::updateBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch:updateBatchChunkSprite() - Cannot update the chunk of a NULL sprite batch item." );
+
+    // Finish if not chunking.
+    if ( mBatchChunkSize <= 0.0f )
+        return;
+
+    // Calculate the chunk key for the sprite.
+    const U32 chunkKey = SpriteBatchChunk::getChunkKey( pSpriteBatchItem->mLocalAABB.GetCenter(), mBatchChunkSize );
+
+    // Fetch the current sprite chunk.
+    SpriteBatchChunk* pSpriteBatchChunk = pSpriteBatchItem->getBatchChunk();
+
+    // Is the sprite already in a chunk?
+    if ( pSpriteBatchChunk != NULL )
+    {
+        // Yes, so flag the chunk as dirty and finish if the sprite remains in it.
+        if ( pSpriteBatchChunk->getChunkKey() == chunkKey )
+        {
+            pSpriteBatchChunk->setDirty();
+            return;
+        }
+
+        // Remove from the chunk.
+        removeBatchChunkSprite( pSpriteBatchItem );
+    }
+
+    // Find the chunk.
+    typeSpriteChunkHash::iterator chunkItr = mSpriteChunks.find( chunkKey );
+
+    // Create the chunk if it does not exist.
+    if ( chunkItr == mSpriteChunks.end() )
+    {
+        pSpriteBatchChunk = new SpriteBatchChunk( chunkKey );
+        mSpriteChunks.insert( chunkKey, pSpriteBatchChunk );
+    }
+    else
+    {
+        pSpriteBatchChunk = chunkItr->value;
+    }
+
+    // Add to the chunk.
+    pSpriteBatchChunk->addSprite( pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::removeBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch:removeBatchChunkSprite() - Cannot remove a NULL sprite batch item." );
+
+    // Fetch the sprite chunk.
+    SpriteBatchChunk* pSpriteBatchChunk = pSpriteBatchItem->getBatchChunk();
+
+    // Finish if not in a chunk.
+    if ( pSpriteBatchChunk == NULL )
+        return;
+
+    // Remove from the chunk.
+    pSpriteBatchChunk->removeSprite( pSpriteBatchItem );
+
+    // Finish if the chunk still has sprites.
+    if ( pSpriteBatchChunk->getSpriteCount() > 0 )
+        return;
+
+    // Delete the empty chunk.
+    mSpriteChunks.erase( pSpriteBatchChunk->getChunkKey() );
+    delete pSpriteBatchChunk;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::createTransformSlot( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::createTransformSlot() - Cannot create a transform slot for a NULL sprite batch item." );
+    AssertFatal( pSpriteBatchItem->mTransformSlot == SpriteBatchTransforms::INVALID_SLOT, "SpriteBatch::createTransformSlot() - Sprite batch item already has a transform slot." );
+
+    // Create the transform slot.
+    pSpriteBatchItem->mTransformSlot = mSpriteTransforms.createSlot( pSpriteBatchItem );
+
+    // Queue the local transform update.
+    if ( pSpriteBatchItem->mLocalTransformDirty )
+        mDirtySprites.push_back( pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroyTransformSlot( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::destroyTransformSlot() - Cannot destroy the transform slot of a NULL sprite batch item." );
+    AssertFatal( pSpriteBatchItem->mTransformSlot != SpriteBatchTransforms::INVALID_SLOT, "SpriteBatch::destroyTransformSlot() - Sprite batch item does not have a transform slot." );
+
+    // Remove any queued local transform update.
+    if ( pSpriteBatchItem->mLocalTransformDirty )
+    {
+        for ( U32 index = 0; index < (U32)mDirtySprites.size(); ++index )
+        {
+            if ( mDirtySprites[index] != pSpriteBatchItem )
+                continue;
+
+            mDirtySprites.erase_fast( index );
+            break;
+        }
+    }
+
+    // Destroy the transform slot.
+    mSpriteTransforms.destroySlot( pSpriteBatchItem->mTransformSlot );
+    pSpriteBatchItem->mTransformSlot = SpriteBatchTransforms::INVALID_SLOT;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setLocalTransformDirty( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::setLocalTransformDirty() - Cannot queue a NULL sprite batch item." );
+
+    // Finish if the sprite has no transform slot yet.
+    // NOTE:- The local transform update is queued when the transform slot is created.
+    if ( pSpriteBatchItem->mTransformSlot == SpriteBatchTransforms::INVALID_SLOT )
+        return;
+
+    // Queue the local transform update.
+    mDirtySprites.push_back( pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateLocalTransforms( void )
+{
+    // Finish if there are no dirty local transforms.
+    if ( mDirtySprites.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateLocalTransforms);
+
+    // Gather the dirty sprites into their transform slots.
+    const U32 dirtyCount = (U32)mDirtySprites.size();
+    mDirtySlots.setSize( dirtyCount );
+    for ( U32 index = 0; index < dirtyCount; ++index )
+    {
+        SpriteBatchItem* pSpriteBatchItem = mDirtySprites[index];
+        pSpriteBatchItem->prepareLocalTransform();
+        mDirtySlots[index] = pSpriteBatchItem->mTransformSlot;
+    }
+
+    // Transform all the dirty slots together.
+    mSpriteTransforms.updateLocalTransforms( mDirtySlots.address(), dirtyCount );
+    mSpriteTransforms.updateRenderTransforms( mBatchTransform, mDirtySlots.address(), dirtyCount );
+
+    // Finish the dirty sprites.
+    for ( U32 index = 0; index < dirtyCount; ++index )
+    {
+        mDirtySprites[index]->finishLocalTransform();
+    }
+
+    mDirtySprites.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateRenderTransforms( void )
+{
+    // Update any dirty local transforms.
+    updateLocalTransforms();
+
+    // Finish if the render transforms are up-to-date.
+    if ( mSpriteTransformsId == mBatchTransformId )
+        return;
+
+    // Transform all the sprites by the batch transform.
+    mSpriteTransforms.updateRenderTransforms( mBatchTransform );
+
+    // Note the batch transform Id.
+    mSpriteTransformsId = mBatchTransformId;
+}
+
+//------------------------------------------------------------------------------
+
 SpriteBatchQuery* SpriteBatch::getSpriteBatchQuery( const bool clearQuery )
 {
     if ( mpSpriteBatchQuery == NULL )
@@ -275,6 +527,9 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
 
+    // Set batch chunk size.
+    pSpriteBatch->setBatchChunkSize( getBatchChunkSize() );
+
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
     pSpriteBatch->setDefaultSpriteSize( getDefaultSpriteSize() );
@@ -370,6 +625,11 @@ void SpriteBatch::clearSprites( void )
     // Clear sprite names.
     mSpriteNames.clear();
 
+    // Clear the sprite transforms.
+    // NOTE:- Doing this up-front means the sprites do not have to release their slots individually.
+    mSpriteTransforms.clear();
+    mDirtySprites.clear();
+
     // Cache all sprites.
     for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
@@ -402,6 +662,27 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setBatchChunkSize( const F32 chunkSize )
+{
+    // Zero or less turns chunking off.
+    const F32 batchChunkSize = getMax( chunkSize, 0.0f );
+
+    // Finish if no change.
+    if ( mIsEqual( mBatchChunkSize, batchChunkSize ) )
+        return;
+
+    // Destroy the existing chunks.
+    destroyBatchChunks();
+
+    // Set batch chunk size.
+    mBatchChunkSize = batchChunkSize;
+
+    // Create the chunks.
+    createBatchChunks();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition )
 {
     // Select sprite.
@@ -1319,6 +1600,59 @@ void SpriteBatch::destroySpriteBatchQuery( void )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::createBatchChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_CreateBatchChunks);
+
+    // Finish if not chunking.
+    if ( mBatchChunkSize <= 0.0f )
+        return;
+
+    // Add all the sprites to chunks.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+
+        // Update the local transform which adds the sprite to its chunk.
+        pSpriteBatchItem->getLocalAABB();
+
+        // Add the sprite if its local transform was already up-to-date.
+        if ( pSpriteBatchItem->getBatchChunk() == NULL )
+            updateBatchChunkSprite( pSpriteBatchItem );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroyBatchChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_DestroyBatchChunks);
+
+    // Finish if there are no chunks.
+    if ( mSpriteChunks.size() == 0 )
+        return;
+
+    // Remove all the sprites from their chunks.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+        pSpriteBatchItem->mpBatchChunk = NULL;
+        pSpriteBatchItem->mBatchChunkIndex = 0;
+    }
+
+    // Delete the chunks.
+    for( typeSpriteChunkHash::iterator chunkItr = mSpriteChunks.begin(); chunkItr != mSpriteChunks.end(); ++chunkItr )
+    {
+        delete chunkItr->value;
+    }
+    mSpriteChunks.clear();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::destroySprite( const U32 batchId )
 {
     // Debug Profiling.
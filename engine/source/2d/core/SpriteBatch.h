@@ -27,6 +27,10 @@
 #include "2d/core/SpriteBatchItem.h"
 #endif
 
+#ifndef _SPRITE_BATCH_TRANSFORMS_H_
+#include "2d/core/SpriteBatchTransforms.h"
+#endif
+
 #ifndef _SCENE_RENDER_OBJECT_H_
 #include "2d/scene/SceneRenderObject.h"
 #endif
@@ -34,6 +38,7 @@
 //------------------------------------------------------------------------------  
 
 class SpriteBatchQuery;
+class SpriteBatchChunk;
 
 //------------------------------------------------------------------------------  
 
@@ -46,6 +51,7 @@ protected:
     typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
     typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
     typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
+    typedef HashMap< U32, SpriteBatchChunk* > typeSpriteChunkHash;
 
     typeSpriteBatchHash             mSprites;
     typeSpritePositionHash          mSpritePositions;
@@ -53,6 +59,7 @@ protected:
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    F32                             mBatchChunkSize;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
@@ -61,6 +68,13 @@ private:
     SpriteBatchQuery*               mpSpriteBatchQuery;
     U32                             mMasterBatchId;
 
+    typeSpriteChunkHash             mSpriteChunks;
+
+    SpriteBatchTransforms           mSpriteTransforms;
+    Vector<SpriteBatchItem*>        mDirtySprites;
+    Vector<U32>                     mDirtySlots;
+    U32                             mSpriteTransformsId;
+
     b2Transform                     mBatchTransform;
     bool                            mBatchTransformDirty;
     U32                             mBatchTransformId;
@@ -92,6 +106,17 @@ public:
     void moveQueryProxy( SpriteBatchItem* pSpriteBatchItem, const b2AABB& localAABB );    
     SpriteBatchQuery* getSpriteBatchQuery( const bool clearQuery = false );
 
+    void updateBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem );
+    void removeBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem );
+
+    void createTransformSlot( SpriteBatchItem* pSpriteBatchItem );
+    void destroyTransformSlot( SpriteBatchItem* pSpriteBatchItem );
+    void setLocalTransformDirty( SpriteBatchItem* pSpriteBatchItem );
+    void updateLocalTransforms( void );
+    void updateRenderTransforms( void );
+    inline SpriteBatchTransforms& getSpriteTransforms( void ) { return mSpriteTransforms; }
+    inline const SpriteBatchTransforms& getSpriteTransforms( void ) const { return mSpriteTransforms; }
+
     virtual void copyTo( SpriteBatch* pSpriteBatch ) const;
 
     inline U32 getSpriteCount( void ) { return (U32)mSprites.size(); }
@@ -106,6 +131,10 @@ public:
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    void setBatchChunkSize( const F32 chunkSize );
+    inline F32 getBatchChunkSize( void ) const { return mBatchChunkSize; }
+    inline U32 getBatchChunkCount( void ) const { return (U32)mSpriteChunks.size(); }
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -201,6 +230,9 @@ protected:
     void createSpriteBatchQuery( void );
     void destroySpriteBatchQuery( void );
 
+    void createBatchChunks( void );
+    void destroyBatchChunks( void );
+
     void onTamlCustomWrite( TamlCustomNodes& customNodes  );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
@@ -0,0 +1,199 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/SpriteBatchChunk.h"
+
+#ifndef _SPRITE_BATCH_ITEM_H_
+#include "2d/core/SpriteBatchItem.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+SpriteBatchChunk::SpriteBatchChunk( const U32 chunkKey ) :
+    mChunkKey( chunkKey ),
+    mWorldTransformId( 0 ),
+    mDirty( true ),
+    mWorldVerticesValid( false )
+{
+    // Set debug associations.
+    VECTOR_SET_ASSOCIATION( mSprites );
+    VECTOR_SET_ASSOCIATION( mLocalVertices );
+    VECTOR_SET_ASSOCIATION( mWorldVertices );
+
+    mLocalAABB.lowerBound.SetZero();
+    mLocalAABB.upperBound.SetZero();
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchChunk::addSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatchChunk::addSprite() - Cannot add a NULL sprite batch item." );
+    AssertFatal( pSpriteBatchItem->mpBatchChunk == NULL, "SpriteBatchChunk::addSprite() - Sprite batch item is already in a chunk." );
+
+    // Note the sprite chunk placement.
+    pSpriteBatchItem->mpBatchChunk = this;
+    pSpriteBatchItem->mBatchChunkIndex = (U32)mSprites.size();
+
+    mSprites.push_back( pSpriteBatchItem );
+
+    // Flag as dirty.
+    setDirty();
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchChunk::removeSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatchChunk::removeSprite() - Cannot remove a NULL sprite batch item." );
+    AssertFatal( pSpriteBatchItem->mpBatchChunk == this, "SpriteBatchChunk::removeSprite() - Sprite batch item is not in this chunk." );
+
+    // Fetch the sprite index.
+    const U32 spriteIndex = pSpriteBatchItem->mBatchChunkIndex;
+
+    // Move the last sprite into the removed slot.
+    SpriteBatchItem* pLastSpriteBatchItem = mSprites.last();
+    mSprites[spriteIndex] = pLastSpriteBatchItem;
+    pLastSpriteBatchItem->mBatchChunkIndex = spriteIndex;
+    mSprites.pop_back();
+
+    // Remove the sprite chunk placement.
+    pSpriteBatchItem->mpBatchChunk = NULL;
+    pSpriteBatchItem->mBatchChunkIndex = 0;
+
+    // Flag as dirty.
+    setDirty();
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchChunk::render( BatchRender* pBatchRenderer, const b2Transform& batchTransform, const U32 batchTransformId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchChunk_Render);
+
+    // Rebuild if dirty.
+    if ( mDirty )
+        rebuild();
+
+    // Transform the local vertices by the batch if the batch has moved since they were last transformed.
+    // NOTE:- All the sprites are transformed so that changing their visibility does not invalidate the world vertices.
+    if ( !mWorldVerticesValid || mWorldTransformId != batchTransformId )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(SpriteBatchChunk_TransformVertices);
+
+        const U32 vertexCount = (U32)mLocalVertices.size();
+        mWorldVertices.setSize( vertexCount );
+
+        const Vector2* pLocalVertices = mLocalVertices.address();
+        Vector2* pWorldVertices = mWorldVertices.address();
+        for ( U32 vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+            pWorldVertices[vertexIndex] = b2Mul( batchTransform, pLocalVertices[vertexIndex] );
+
+        mWorldTransformId = batchTransformId;
+        mWorldVerticesValid = true;
+    }
+
+    // Fetch the world vertices.
+    const Vector2* pWorldVertices = mWorldVertices.address();
+
+    const U32 spriteCount = (U32)mSprites.size();
+    for ( U32 spriteIndex = 0; spriteIndex < spriteCount; ++spriteIndex, pWorldVertices += 4 )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = mSprites[spriteIndex];
+
+        // Skip if not visible.
+        if ( !pSpriteBatchItem->getVisible() )
+            continue;
+
+        // Batch render.
+        pSpriteBatchItem->render( pBatchRenderer, pWorldVertices );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SpriteBatchChunk::getChunkKey( const Vector2& localPosition, const F32 chunkSize )
+{
+    // Sanity!
+    AssertFatal( chunkSize > 0.0f, "SpriteBatchChunk::getChunkKey() - Invalid chunk size." );
+
+    // Calculate the chunk cell.
+    const S32 chunkX = (S32)mFloor( localPosition.x / chunkSize );
+    const S32 chunkY = (S32)mFloor( localPosition.y / chunkSize );
+
+    // Pack the cell into the key.
+    return ((U32)(chunkX & 0xFFFF) << 16) | (U32)(chunkY & 0xFFFF);
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchChunk::rebuild( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchChunk_Rebuild);
+
+    // Flag as NOT dirty.
+    mDirty = false;
+
+    const U32 spriteCount = (U32)mSprites.size();
+    mLocalVertices.setSize( spriteCount * 4 );
+
+    // Finish if there are no sprites.
+    if ( spriteCount == 0 )
+    {
+        mLocalAABB.lowerBound.SetZero();
+        mLocalAABB.upperBound.SetZero();
+        return;
+    }
+
+    // Gather the local vertices and bounds.
+    // NOTE:- The sprite local transforms are updated by the sprite batch before the chunks are used.
+    Vector2* pLocalVertices = mLocalVertices.address();
+    for ( U32 spriteIndex = 0; spriteIndex < spriteCount; ++spriteIndex, pLocalVertices += 4 )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = mSprites[spriteIndex];
+
+        const Vector2* pLocalOOBB = pSpriteBatchItem->getLocalOOBB();
+        pLocalVertices[0] = pLocalOOBB[0];
+        pLocalVertices[1] = pLocalOOBB[1];
+        pLocalVertices[2] = pLocalOOBB[2];
+        pLocalVertices[3] = pLocalOOBB[3];
+
+        if ( spriteIndex == 0 )
+            mLocalAABB = pSpriteBatchItem->mLocalAABB;
+        else
+            mLocalAABB.Combine( pSpriteBatchItem->mLocalAABB );
+    }
+}
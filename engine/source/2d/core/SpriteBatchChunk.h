@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SPRITE_BATCH_CHUNK_H_
+#define _SPRITE_BATCH_CHUNK_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class SpriteBatchItem;
+class BatchRender;
+
+///-----------------------------------------------------------------------------
+
+/// A fixed-size cell of sprites within a chunked sprite batch.
+/// The chunk keeps its sprites' local vertices in a single array and is culled and
+/// rendered as a whole so moving the batch only needs the chunk bounds re-transformed.
+/// The world vertices are cached until the sprites or the batch transform change.
+class SpriteBatchChunk
+{
+public:
+    SpriteBatchChunk( const U32 chunkKey );
+    virtual ~SpriteBatchChunk() {}
+
+    inline U32 getChunkKey( void ) const { return mChunkKey; }
+
+    void addSprite( SpriteBatchItem* pSpriteBatchItem );
+    void removeSprite( SpriteBatchItem* pSpriteBatchItem );
+    inline U32 getSpriteCount( void ) const { return (U32)mSprites.size(); }
+
+    inline void setDirty( void ) { mDirty = true; mWorldVerticesValid = false; }
+    inline const b2AABB& getLocalAABB( void ) { if ( mDirty ) rebuild(); return mLocalAABB; }
+
+    void render( BatchRender* pBatchRenderer, const b2Transform& batchTransform, const U32 batchTransformId );
+
+    static U32 getChunkKey( const Vector2& localPosition, const F32 chunkSize );
+
+private:
+    void rebuild( void );
+
+private:
+    U32                         mChunkKey;
+    Vector<SpriteBatchItem*>    mSprites;
+    Vector<Vector2>             mLocalVertices;
+    Vector<Vector2>             mWorldVertices;
+    U32                         mWorldTransformId;
+    b2AABB                      mLocalAABB;
+    bool                        mDirty;
+    bool                        mWorldVerticesValid;
+};
+
+#endif // _SPRITE_BATCH_CHUNK_H_
@@ -60,7 +60,10 @@ static StringTableEntry spriteDataObjectName        = StringTable->insert("DataO
 
 //------------------------------------------------------------------------------
 
-SpriteBatchItem::SpriteBatchItem() : mProxyId( SpriteBatch::INVALID_SPRITE_PROXY )
+SpriteBatchItem::SpriteBatchItem() :
+    mProxyId( SpriteBatch::INVALID_SPRITE_PROXY ),
+    mTransformSlot( SpriteBatchTransforms::INVALID_SLOT ),
+    mpBatchChunk( NULL )
 {
     resetState();
 }
@@ -89,6 +92,26 @@ void SpriteBatchItem::resetState( void )
         mSpriteBatch->destroyQueryProxy( this );
     }
 
+    // Are we in a batch chunk?
+    if ( mpBatchChunk != NULL )
+    {
+        // Sanity!
+        AssertFatal( mSpriteBatch != NULL, "Cannot remove from batch chunk with NULL sprite batch." );
+
+        // Remove from batch chunk.
+        mSpriteBatch->removeBatchChunkSprite( this );
+    }
+
+    // Do we have a transform slot?
+    if ( mTransformSlot != SpriteBatchTransforms::INVALID_SLOT )
+    {
+        // Sanity!
+        AssertFatal( mSpriteBatch != NULL, "Cannot destroy transform slot with NULL sprite batch." );
+
+        // Destroy transform slot.
+        mSpriteBatch->destroyTransformSlot( this );
+    }
+
     mSpriteBatch = NULL;
     mBatchId = 0;
     mName = StringTable->EmptyString;
@@ -123,13 +146,11 @@ void SpriteBatchItem::resetState( void )
     mLocalAABB.lowerBound.Set( -0.5f, -0.5f );
     mLocalAABB.upperBound.Set( 0.5f, 0.5f );
 
-    mRenderAABB.lowerBound.Set( -0.5f, -0.5f );
-    mRenderAABB.upperBound.Set( 0.5f, 0.5f );
-    mRenderPosition.setZero();
-    mLastBatchTransformId = 0;
 
     mSpriteBatchQueryKey = 0;
 
+    mBatchChunkIndex = 0;
+
     mUserData = NULL;
 
     // Require self ticking.
@@ -151,6 +172,9 @@ void SpriteBatchItem::setBatchParent( SpriteBatch* pSpriteBatch, const U32 batch
 
     // Create proxy.
     mSpriteBatch->createQueryProxy( this );
+
+    // Create transform slot.
+    mSpriteBatch->createTransformSlot( this );
 }
 
 //------------------------------------------------------------------------------
@@ -181,18 +205,17 @@ void SpriteBatchItem::copyTo( SpriteBatchItem* pSpriteBatchItem ) const
 
 //------------------------------------------------------------------------------
 
-void SpriteBatchItem::prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId )
+void SpriteBatchItem::prepareRender( SceneRenderRequest* pSceneRenderRequest )
 {
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatchItem_PrepareRender);
 
     // Sanity!
     AssertFatal( pSceneRenderRequest != NULL, "Cannot prepare a sprite batch with a NULL scene render request." );
+    AssertFatal( mSpriteBatch != NULL, "Cannot prepare a sprite batch item with a NULL sprite batch." );
 
-    // Update the world transform.
-    updateWorldTransform( batchTransformId );
-
-    pSceneRenderRequest->mWorldPosition = mRenderPosition;
+    // NOTE:- The sprite batch is expected to have updated the render transforms.
+    pSceneRenderRequest->mWorldPosition = mSpriteBatch->getSpriteTransforms().getRenderPosition( mTransformSlot );
     pSceneRenderRequest->mDepth = getDepth();
     pSceneRenderRequest->mSortPoint = getSortPoint();
     pSceneRenderRequest->mSerialId = getBatchId();
@@ -206,13 +229,18 @@ void SpriteBatchItem::prepareRender( SceneRenderRequest* pSceneRenderRequest, co
 
 //------------------------------------------------------------------------------
 
-void SpriteBatchItem::render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId )
+void SpriteBatchItem::render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest )
 {
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatchItem_Render);
 
-    // Update the world transform.
-    updateWorldTransform( batchTransformId );
+    // Sanity!
+    AssertFatal( mSpriteBatch != NULL, "Cannot render a sprite batch item with a NULL sprite batch." );
+
+    // Fetch the render OOBB.
+    // NOTE:- The sprite batch is expected to have updated the render transforms.
+    Vector2 renderOOBB[4];
+    mSpriteBatch->getSpriteTransforms().getRenderOOBB( mTransformSlot, renderOOBB );
 
     // Set the blend mode.
     pBatchRenderer->setBlendMode( pSceneRenderRequest );
@@ -222,10 +250,32 @@ void SpriteBatchItem::render( BatchRender* pBatchRenderer, const SceneRenderRequ
 
     // Render.
     Parent::render( mFlipX, mFlipY,
-                    mRenderOOBB[0],
-                    mRenderOOBB[1],
-                    mRenderOOBB[2],
-                    mRenderOOBB[3],
+                    renderOOBB[0],
+                    renderOOBB[1],
+                    renderOOBB[2],
+                    renderOOBB[3],
+                    pBatchRenderer );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::render( BatchRender* pBatchRenderer, const Vector2* pRenderVertices )
+{
+    // Set the blend mode.
+    if ( mBlendMode )
+        pBatchRenderer->setBlendMode( mSrcBlendFactor, mDstBlendFactor, mBlendColor );
+    else
+        pBatchRenderer->setBlendOff();
+
+    // Set the alpha test mode.
+    pBatchRenderer->setAlphaTestMode( mAlphaTest );
+
+    // Render.
+    Parent::render( mFlipX, mFlipY,
+                    pRenderVertices[0],
+                    pRenderVertices[1],
+                    pRenderVertices[2],
+                    pRenderVertices[3],
                     pBatchRenderer );
 }
 
@@ -239,15 +289,30 @@ void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
     mExplicitVerts[1] = explicitVertices[1];
     mExplicitVerts[2] = explicitVertices[2];
     mExplicitVerts[3] = explicitVertices[3];
+
+    setLocalTransformDirty();
 }
 
 //------------------------------------------------------------------------------
 
-void SpriteBatchItem::updateLocalTransform( void )
+void SpriteBatchItem::setLocalTransformDirty( void )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(SpriteBatchItem_UpdateLocalTransform);
+    // Finish if the local transform is already dirty.
+    if ( mLocalTransformDirty )
+        return;
+
+    // Flag local transform as dirty.
+    mLocalTransformDirty = true;
 
+    // Queue the local transform update with the sprite batch.
+    if ( mSpriteBatch != NULL )
+        mSpriteBatch->setLocalTransformDirty( this );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::updateLocalTransform( void )
+{
     // Sanity!
     AssertFatal( mSpriteBatch != NULL, "SpriteBatchItem::updateLocalTransform() - Cannot update local transform with a NULL sprite batch." );
 
@@ -255,77 +320,65 @@ void SpriteBatchItem::updateLocalTransform( void )
     if ( !mLocalTransformDirty )
         return;
 
+    // Update all the dirty local transforms in the sprite batch.
+    mSpriteBatch->updateLocalTransforms();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::prepareLocalTransform( void )
+{
+    // Sanity!
+    AssertFatal( mSpriteBatch != NULL, "SpriteBatchItem::prepareLocalTransform() - Cannot prepare local transform with a NULL sprite batch." );
+
     // Set local transform.
     b2Transform localTransform;
     localTransform.p = mLocalPosition;
     localTransform.q.Set( mLocalAngle );
 
+    // Are we using explicit vertices?
+    if ( mExplicitMode )
+    {
+        // Yes, so set the explicit vertices.
+        mSpriteBatch->getSpriteTransforms().setLocalTransform( mTransformSlot, mExplicitVerts, localTransform );
+        return;
+    }
+
     // Calculate half size.
     const F32 halfWidth = mSize.x * 0.5f;
     const F32 halfHeight = mSize.y * 0.5f;
 
     // Set local size vertices.
-    if (!mExplicitMode)
-    {
-        mLocalOOBB[0].Set( -halfWidth, -halfHeight );
-        mLocalOOBB[1].Set( +halfWidth, -halfHeight );
-        mLocalOOBB[2].Set( +halfWidth, +halfHeight );
-        mLocalOOBB[3].Set( -halfWidth, +halfHeight );
-    }
-    else
-    {
-        mLocalOOBB[0] = mExplicitVerts[0];
-        mLocalOOBB[1] = mExplicitVerts[1];
-        mLocalOOBB[2] = mExplicitVerts[2];
-        mLocalOOBB[3] = mExplicitVerts[3];
-    }
-
-    // Calculate local OOBB.
-    CoreMath::mCalculateOOBB( mLocalOOBB, localTransform, mLocalOOBB );
+    Vector2 sizeVertices[4];
+    sizeVertices[0].Set( -halfWidth, -halfHeight );
+    sizeVertices[1].Set( +halfWidth, -halfHeight );
+    sizeVertices[2].Set( +halfWidth, +halfHeight );
+    sizeVertices[3].Set( -halfWidth, +halfHeight );
 
-    // Calculate local AABB.
-    CoreMath::mOOBBtoAABB( mLocalOOBB, mLocalAABB );
-
-    // Move query proxy.
-    mSpriteBatch->moveQueryProxy( this, mLocalAABB );
-
-    // Flag local transform as NOT dirty.
-    mLocalTransformDirty = false;
+    mSpriteBatch->getSpriteTransforms().setLocalTransform( mTransformSlot, sizeVertices, localTransform );
 }
 
 //------------------------------------------------------------------------------
 
-void SpriteBatchItem::updateWorldTransform( const U32 batchTransformId )
+void SpriteBatchItem::finishLocalTransform( void )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(SpriteBatchItem_UpdateWorldTransform);
-
     // Sanity!
-    AssertFatal( mSpriteBatch != NULL, "SpriteBatchItem::updateWorldTransform() - Cannot update transform with a NULL sprite batch." );
+    AssertFatal( mSpriteBatch != NULL, "SpriteBatchItem::finishLocalTransform() - Cannot finish local transform with a NULL sprite batch." );
 
-    // Update the local transform if needed.
-    if ( mLocalTransformDirty )
-    {
-        updateLocalTransform();
-    }
-    // Finish if the batch transform is up-to-date.
-    else if ( batchTransformId == mLastBatchTransformId )
-        return;
-
-    // Fetch world transform.
-    const b2Transform& worldTransform = mSpriteBatch->getBatchTransform();
+    // Fetch local OOBB.
+    mSpriteBatch->getSpriteTransforms().getLocalOOBB( mTransformSlot, mLocalOOBB );
 
-    // Calculate world OOBB.
-    CoreMath::mCalculateOOBB( mLocalOOBB, worldTransform, mRenderOOBB );
+    // Calculate local AABB.
+    CoreMath::mOOBBtoAABB( mLocalOOBB, mLocalAABB );
 
-    // Calculate render AABB.
-    CoreMath::mOOBBtoAABB( mRenderOOBB, mRenderAABB );
+    // Flag local transform as NOT dirty.
+    mLocalTransformDirty = false;
 
-    // Calculate the render position.
-    mRenderPosition = mRenderAABB.GetCenter();
+    // Move query proxy.
+    mSpriteBatch->moveQueryProxy( this, mLocalAABB );
 
-    // Note the last batch transform Id.
-    mLastBatchTransformId = batchTransformId;
+    // Update batch chunk.
+    mSpriteBatch->updateBatchChunkSprite( this );
 }
 
 //------------------------------------------------------------------------------
@@ -30,6 +30,8 @@
 //------------------------------------------------------------------------------  
 
 class SpriteBatch;
+class SpriteBatchChunk;
+class SpriteBatchTransforms;
 class SceneRenderRequest;
 
 //------------------------------------------------------------------------------  
@@ -41,6 +43,8 @@ extern StringTableEntry spritesItemTypeName;
 class SpriteBatchItem : public ImageFrameProvider
 {
     friend class SpriteBatch;
+    friend class SpriteBatchChunk;
+    friend class SpriteBatchTransforms;
 
     typedef ImageFrameProvider Parent;
 
@@ -220,13 +224,13 @@ protected:
     b2AABB              mLocalAABB;
     bool                mLocalTransformDirty;
 
-    Vector2             mRenderOOBB[4];
-    b2AABB              mRenderAABB;
-    Vector2             mRenderPosition;
-    U32                 mLastBatchTransformId;
+    U32                 mTransformSlot;
 
     U32                 mSpriteBatchQueryKey;
 
+    SpriteBatchChunk*   mpBatchChunk;
+    U32                 mBatchChunkIndex;
+
     void*               mUserData;
 
 public:
@@ -238,6 +242,7 @@ public:
     inline SpriteBatch* getBatchParent( void ) const { return mSpriteBatch; }
     inline U32 getBatchId( void ) const { return mBatchId; }
     inline S32 getProxyId( void ) const { return mProxyId; }
+    inline SpriteBatchChunk* getBatchChunk( void ) const { return mpBatchChunk; }
     inline StringTableEntry getName( void ) const { return mName; }
 
     inline void setLogicalPosition( const LogicalPosition& logicalPosition ) { mLogicalPosition = logicalPosition; }
@@ -249,15 +254,15 @@ public:
     inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; }
     inline bool getExplicitMode( void ) const { return mExplicitMode; }
 
-    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; }
+    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; setLocalTransformDirty(); }
     inline Vector2 getLocalPosition( void ) const { return mLocalPosition; }
 
     void setExplicitVertices( const Vector2* explicitVertices );
 
-    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; }
+    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; setLocalTransformDirty(); }
     inline F32 getLocalAngle( void ) const { return mLocalAngle; }
 
-    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; }
+    inline void setSize( const Vector2& size ) { mSize = size; setLocalTransformDirty(); }
     inline Vector2 getSize( void ) const { return mSize; }
 
     inline const b2AABB& getLocalAABB( void ) { if ( mLocalTransformDirty ) updateLocalTransform(); return mLocalAABB; }
@@ -303,10 +308,11 @@ public:
     virtual void copyTo( SpriteBatchItem* pSpriteBatchItem ) const;
 
     inline const Vector2* getLocalOOBB( void ) const { return mLocalOOBB; }
-    inline const Vector2* getRenderOOBB( void ) const { return mRenderOOBB; }
+    inline U32 getTransformSlot( void ) const { return mTransformSlot; }
 
-    void prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
-    void render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
+    void prepareRender( SceneRenderRequest* pSceneRenderRequest );
+    void render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest );
+    void render( BatchRender* pBatchRenderer, const Vector2* pRenderVertices );
 
     static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement );
 
@@ -314,8 +320,10 @@ protected:
     void setBatchParent( SpriteBatch* pSpriteBatch, const U32 batchId );
     inline void setProxyId( const S32 proxyId ) { mProxyId = proxyId; }
     inline void setName( const char* pName ) { mName = StringTable->insert( pName ); }
+    void setLocalTransformDirty( void );
     void updateLocalTransform( void );
-    void updateWorldTransform( const U32 batchTransformId );
+    void prepareLocalTransform( void );
+    void finishLocalTransform( void );
 
     void onTamlCustomWrite( TamlCustomNode* pParentNode );
     void onTamlCustomRead( const TamlCustomNode* pSpriteNode );
@@ -0,0 +1,309 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/SpriteBatchTransforms.h"
+
+#ifndef _SPRITE_BATCH_ITEM_H_
+#include "2d/core/SpriteBatchItem.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+SpriteBatchTransforms::SpriteBatchTransforms()
+{
+    // Set debug associations.
+    VECTOR_SET_ASSOCIATION( mSprites );
+    VECTOR_SET_ASSOCIATION( mPositionX );
+    VECTOR_SET_ASSOCIATION( mPositionY );
+    VECTOR_SET_ASSOCIATION( mCosine );
+    VECTOR_SET_ASSOCIATION( mSine );
+    VECTOR_SET_ASSOCIATION( mVertexX );
+    VECTOR_SET_ASSOCIATION( mVertexY );
+    VECTOR_SET_ASSOCIATION( mLocalX );
+    VECTOR_SET_ASSOCIATION( mLocalY );
+    VECTOR_SET_ASSOCIATION( mRenderX );
+    VECTOR_SET_ASSOCIATION( mRenderY );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SpriteBatchTransforms::createSlot( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatchTransforms::createSlot() - Cannot create a slot for a NULL sprite batch item." );
+
+    // Fetch the new slot.
+    const U32 slot = getSlotCount();
+
+    mSprites.push_back( pSpriteBatchItem );
+
+    // Add the per-slot transform as identity.
+    mPositionX.push_back( 0.0f );
+    mPositionY.push_back( 0.0f );
+    mCosine.push_back( 1.0f );
+    mSine.push_back( 0.0f );
+
+    // Add the per-slot vertices.
+    mVertexX.increment( 4 );
+    mVertexY.increment( 4 );
+    mLocalX.increment( 4 );
+    mLocalY.increment( 4 );
+    mRenderX.increment( 4 );
+    mRenderY.increment( 4 );
+
+    const U32 vertexIndex = slot * 4;
+    for ( U32 n = vertexIndex; n < vertexIndex + 4; ++n )
+    {
+        mVertexX[n] = mVertexY[n] = 0.0f;
+        mLocalX[n] = mLocalY[n] = 0.0f;
+        mRenderX[n] = mRenderY[n] = 0.0f;
+    }
+
+    return slot;
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::destroySlot( const U32 slot )
+{
+    // Sanity!
+    AssertFatal( slot < getSlotCount(), "SpriteBatchTransforms::destroySlot() - Invalid slot." );
+
+    // Fetch the last slot.
+    const U32 lastSlot = getSlotCount() - 1;
+
+    // Move the last slot into the destroyed slot.
+    if ( slot != lastSlot )
+    {
+        SpriteBatchItem* pLastSpriteBatchItem = mSprites[lastSlot];
+        pLastSpriteBatchItem->mTransformSlot = slot;
+        mSprites[slot] = pLastSpriteBatchItem;
+
+        mPositionX[slot] = mPositionX[lastSlot];
+        mPositionY[slot] = mPositionY[lastSlot];
+        mCosine[slot] = mCosine[lastSlot];
+        mSine[slot] = mSine[lastSlot];
+
+        const U32 vertexIndex = slot * 4;
+        const U32 lastVertexIndex = lastSlot * 4;
+        for ( U32 n = 0; n < 4; ++n )
+        {
+            mVertexX[vertexIndex+n] = mVertexX[lastVertexIndex+n];
+            mVertexY[vertexIndex+n] = mVertexY[lastVertexIndex+n];
+            mLocalX[vertexIndex+n] = mLocalX[lastVertexIndex+n];
+            mLocalY[vertexIndex+n] = mLocalY[lastVertexIndex+n];
+            mRenderX[vertexIndex+n] = mRenderX[lastVertexIndex+n];
+            mRenderY[vertexIndex+n] = mRenderY[lastVertexIndex+n];
+        }
+    }
+
+    // Remove the last slot.
+    mSprites.pop_back();
+    mPositionX.decrement();
+    mPositionY.decrement();
+    mCosine.decrement();
+    mSine.decrement();
+    mVertexX.decrement( 4 );
+    mVertexY.decrement( 4 );
+    mLocalX.decrement( 4 );
+    mLocalY.decrement( 4 );
+    mRenderX.decrement( 4 );
+    mRenderY.decrement( 4 );
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::clear( void )
+{
+    // Release all the sprite slots.
+    for ( U32 slot = 0; slot < getSlotCount(); ++slot )
+    {
+        mSprites[slot]->mTransformSlot = INVALID_SLOT;
+    }
+
+    mSprites.clear();
+    mPositionX.clear();
+    mPositionY.clear();
+    mCosine.clear();
+    mSine.clear();
+    mVertexX.clear();
+    mVertexY.clear();
+    mLocalX.clear();
+    mLocalY.clear();
+    mRenderX.clear();
+    mRenderY.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::setLocalTransform( const U32 slot, const Vector2* pVertices, const b2Transform& localTransform )
+{
+    // Sanity!
+    AssertFatal( slot < getSlotCount(), "SpriteBatchTransforms::setLocalTransform() - Invalid slot." );
+
+    mPositionX[slot] = localTransform.p.x;
+    mPositionY[slot] = localTransform.p.y;
+    mCosine[slot] = localTransform.q.c;
+    mSine[slot] = localTransform.q.s;
+
+    const U32 vertexIndex = slot * 4;
+    for ( U32 n = 0; n < 4; ++n )
+    {
+        mVertexX[vertexIndex+n] = pVertices[n].x;
+        mVertexY[vertexIndex+n] = pVertices[n].y;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::getLocalOOBB( const U32 slot, Vector2* pLocalOOBB ) const
+{
+    // Sanity!
+    AssertFatal( slot < getSlotCount(), "SpriteBatchTransforms::getLocalOOBB() - Invalid slot." );
+
+    const U32 vertexIndex = slot * 4;
+    for ( U32 n = 0; n < 4; ++n )
+    {
+        pLocalOOBB[n].Set( mLocalX[vertexIndex+n], mLocalY[vertexIndex+n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::getRenderOOBB( const U32 slot, Vector2* pRenderOOBB ) const
+{
+    // Sanity!
+    AssertFatal( slot < getSlotCount(), "SpriteBatchTransforms::getRenderOOBB() - Invalid slot." );
+
+    const U32 vertexIndex = slot * 4;
+    for ( U32 n = 0; n < 4; ++n )
+    {
+        pRenderOOBB[n].Set( mRenderX[vertexIndex+n], mRenderY[vertexIndex+n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+Vector2 SpriteBatchTransforms::getRenderPosition( const U32 slot ) const
+{
+    // Sanity!
+    AssertFatal( slot < getSlotCount(), "SpriteBatchTransforms::getRenderPosition() - Invalid slot." );
+
+    // Fetch the render vertices.
+    const U32 vertexIndex = slot * 4;
+    const F32* pRenderX = mRenderX.address() + vertexIndex;
+    const F32* pRenderY = mRenderY.address() + vertexIndex;
+
+    // Calculate the center of the render AABB.
+    const F32 lowerX = getMin( getMin( pRenderX[0], pRenderX[1] ), getMin( pRenderX[2], pRenderX[3] ) );
+    const F32 upperX = getMax( getMax( pRenderX[0], pRenderX[1] ), getMax( pRenderX[2], pRenderX[3] ) );
+    const F32 lowerY = getMin( getMin( pRenderY[0], pRenderY[1] ), getMin( pRenderY[2], pRenderY[3] ) );
+    const F32 upperY = getMax( getMax( pRenderY[0], pRenderY[1] ), getMax( pRenderY[2], pRenderY[3] ) );
+
+    return Vector2( (lowerX + upperX) * 0.5f, (lowerY + upperY) * 0.5f );
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::updateLocalTransforms( const U32* pSlots, const U32 slotCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchTransforms_UpdateLocalTransforms);
+
+    // Fetch the arrays.
+    const F32* pPositionX = mPositionX.address();
+    const F32* pPositionY = mPositionY.address();
+    const F32* pCosine = mCosine.address();
+    const F32* pSine = mSine.address();
+    const F32* pVertexX = mVertexX.address();
+    const F32* pVertexY = mVertexY.address();
+    F32* pLocalX = mLocalX.address();
+    F32* pLocalY = mLocalY.address();
+
+    for ( U32 n = 0; n < slotCount; ++n )
+    {
+        // Fetch the slot transform.
+        const U32 slot = pSlots[n];
+        const F32 positionX = pPositionX[slot];
+        const F32 positionY = pPositionY[slot];
+        const F32 cosine = pCosine[slot];
+        const F32 sine = pSine[slot];
+
+        // Transform the slot vertices.
+        const U32 vertexIndex = slot * 4;
+        for ( U32 v = vertexIndex; v < vertexIndex + 4; ++v )
+        {
+            const F32 x = pVertexX[v];
+            const F32 y = pVertexY[v];
+            pLocalX[v] = (cosine * x - sine * y) + positionX;
+            pLocalY[v] = (sine * x + cosine * y) + positionY;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::updateRenderTransforms( const b2Transform& batchTransform )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchTransforms_UpdateRenderTransforms);
+
+    // Transform all the local vertices in a single pass.
+    transformVertices( batchTransform, mLocalX.address(), mLocalY.address(), mRenderX.address(), mRenderY.address(), (U32)mLocalX.size() );
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::updateRenderTransforms( const b2Transform& batchTransform, const U32* pSlots, const U32 slotCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchTransforms_UpdateRenderTransformSlots);
+
+    for ( U32 n = 0; n < slotCount; ++n )
+    {
+        const U32 vertexIndex = pSlots[n] * 4;
+        transformVertices( batchTransform, mLocalX.address() + vertexIndex, mLocalY.address() + vertexIndex, mRenderX.address() + vertexIndex, mRenderY.address() + vertexIndex, 4 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchTransforms::transformVertices( const b2Transform& transform, const F32* pInputX, const F32* pInputY, F32* pOutputX, F32* pOutputY, const U32 vertexCount )
+{
+    // NOTE:- This is kept as a flat loop over separate arrays with the transform hoisted into
+    // locals so that the compiler is free to vectorize it.
+    const F32 positionX = transform.p.x;
+    const F32 positionY = transform.p.y;
+    const F32 cosine = transform.q.c;
+    const F32 sine = transform.q.s;
+
+    for ( U32 n = 0; n < vertexCount; ++n )
+    {
+        const F32 x = pInputX[n];
+        const F32 y = pInputY[n];
+        pOutputX[n] = (cosine * x - sine * y) + positionX;
+        pOutputY[n] = (sine * x + cosine * y) + positionY;
+    }
+}
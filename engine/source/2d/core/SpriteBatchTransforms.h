@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SPRITE_BATCH_TRANSFORMS_H_
+#define _SPRITE_BATCH_TRANSFORMS_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class SpriteBatchItem;
+
+///-----------------------------------------------------------------------------
+
+/// Contiguous storage of the sprite transforms in a sprite batch.
+/// Each sprite owns a slot; the vertices are held as separate X/Y arrays (four per slot)
+/// so that the local and render transforms can be calculated for many sprites in one pass.
+/// Slots are compacted when released so the slot of a sprite may change but the sprite itself never moves.
+class SpriteBatchTransforms
+{
+public:
+    static const U32 INVALID_SLOT = 0xFFFFFFFF;
+
+public:
+    SpriteBatchTransforms();
+    virtual ~SpriteBatchTransforms() {}
+
+    U32 createSlot( SpriteBatchItem* pSpriteBatchItem );
+    void destroySlot( const U32 slot );
+    void clear( void );
+    inline U32 getSlotCount( void ) const { return (U32)mSprites.size(); }
+
+    void setLocalTransform( const U32 slot, const Vector2* pVertices, const b2Transform& localTransform );
+    void getLocalOOBB( const U32 slot, Vector2* pLocalOOBB ) const;
+    void getRenderOOBB( const U32 slot, Vector2* pRenderOOBB ) const;
+    Vector2 getRenderPosition( const U32 slot ) const;
+
+    void updateLocalTransforms( const U32* pSlots, const U32 slotCount );
+    void updateRenderTransforms( const b2Transform& batchTransform );
+    void updateRenderTransforms( const b2Transform& batchTransform, const U32* pSlots, const U32 slotCount );
+
+    static void transformVertices( const b2Transform& transform, const F32* pInputX, const F32* pInputY, F32* pOutputX, F32* pOutputY, const U32 vertexCount );
+
+private:
+    Vector<SpriteBatchItem*>    mSprites;
+
+    // Per-slot local transform.
+    Vector<F32>                 mPositionX;
+    Vector<F32>                 mPositionY;
+    Vector<F32>                 mCosine;
+    Vector<F32>                 mSine;
+
+    // Four vertices per-slot.
+    Vector<F32>                 mVertexX;
+    Vector<F32>                 mVertexY;
+    Vector<F32>                 mLocalX;
+    Vector<F32>                 mLocalY;
+    Vector<F32>                 mRenderX;
+    Vector<F32>                 mRenderY;
+};
+
+#endif // _SPRITE_BATCH_TRANSFORMS_H_
@@ -56,10 +56,13 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool canTickPassive( void ) const { return false; }
 
     virtual void copyTo( SimObject* object );
 
     virtual bool canPrepareRender( void ) const { return true; }
+    virtual bool canPrepareRenderConcurrently( void ) const { return true; }
+    virtual bool canRenderConcurrently( void ) const { return true; }
     virtual bool validRender( void ) const { return mImageAsset.notNull(); }
     virtual bool shouldRender( void ) const { return true; }
     virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );    
@@ -73,6 +73,7 @@ public:
         if ( objectsEnabled > maxObjectsEnabled ) maxObjectsEnabled = objectsEnabled;
         if ( objectsVisible > maxObjectsVisible ) maxObjectsVisible = objectsVisible;
         if ( objectsAwake > maxObjectsAwake ) maxObjectsAwake = objectsAwake;
+        if ( objectsActive > maxObjectsActive ) maxObjectsActive = objectsActive;
 
         // Render pick/requests.
         if ( renderPicked > maxRenderPicked ) maxRenderPicked = renderPicked;
@@ -123,6 +124,9 @@ public:
         objectsAwake = 0;
         maxObjectsAwake = 0;
 
+        objectsActive = 0;
+        maxObjectsActive = 0;
+
         renderPicked = 0;
         maxRenderPicked = 0;
 
@@ -213,6 +217,9 @@ public:
     U32     objectsAwake;
     U32     maxObjectsAwake;
 
+    U32     objectsActive;
+    U32     maxObjectsActive;
+
     U32     renderPicked;
     U32     maxRenderPicked;
 
@@ -56,6 +56,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_WORKERPOOL_H_
+#include "platform/threads/workerPool.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -68,6 +72,13 @@ SimObjectPtr<Scene> Scene::LoadingScene = NULL;
 
 //------------------------------------------------------------------------------
 
+namespace Sim
+{
+    extern void cancelPendingEvents( SimObject* pObject );
+}
+
+//-----------------------------------------------------------------------------
+
 static ContactFilter mContactFilter;
 
 // Scene counter.
@@ -153,6 +164,12 @@ Scene::Scene() :
     mVelocityIterations(8),
     mPositionIterations(3),
 
+    /// Tick activity.
+    mActiveTombstones(0),
+    mPassiveTombstones(0),
+    mActiveOrderDirty(false),
+    mTickListBuilt(false),
+
     /// Joint access.
     mJointMasterId(1),
 
@@ -166,6 +183,9 @@ Scene::Scene() :
 
     /// Window rendering.
     mpCurrentRenderWindow(NULL),
+
+    /// Delete requests.
+    mDeleteBudget(0),
     
     /// Miscellaneous.
     mIsEditorScene(0),
@@ -175,10 +195,18 @@ Scene::Scene() :
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mActiveSceneObjects );
+    VECTOR_SET_ASSOCIATION( mPassiveSceneObjects );
+    VECTOR_SET_ASSOCIATION( mAwokenSceneObjects );
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
+    VECTOR_SET_ASSOCIATION( mRetiredObjects );
+    VECTOR_SET_ASSOCIATION( mRecyclePools );
     VECTOR_SET_ASSOCIATION( mEndContacts );
     VECTOR_SET_ASSOCIATION( mAssetPreloads );
+    VECTOR_SET_ASSOCIATION( mRenderShards );
+    VECTOR_SET_ASSOCIATION( mPrepareRenderJobs );
+    VECTOR_SET_ASSOCIATION( mRenderJobs );
      
     // Initialize layer sort mode.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
@@ -204,6 +232,13 @@ Scene::~Scene()
     if ( mControllers.notNull() )
         mControllers->deleteObject();
 
+    // Delete the render shards.
+    for ( typeRenderShardVector::iterator shardItr = mRenderShards.begin(); shardItr != mRenderShards.end(); ++shardItr )
+    {
+        delete *shardItr;
+    }
+    mRenderShards.clear();
+
     // Decrease scene count.
     --sSceneCount;
 }
@@ -228,6 +263,9 @@ bool Scene::onAdd()
     // Set destruction listener.
     mpWorld->SetDestructionListener( this );
 
+    // Set wake listener.
+    mpWorld->SetWakeListener( this );
+
     // Create ground body.
     b2BodyDef groundBodyDef;
     groundBodyDef.userData = static_cast<PhysicsProxy*>(this);
@@ -259,6 +297,10 @@ void Scene::onRemove()
 
     // Process Delete Requests.
     processDeleteRequests(true);
+    processRetiredObjects(true);
+
+    // Delete any recycled objects.
+    clearRecyclePools();
 
     // Delete ground body.
     mpWorld->DestroyBody( mpGroundBody );
@@ -416,6 +458,28 @@ void Scene::PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
 
 //-----------------------------------------------------------------------------
 
+void Scene::BodyAwoken( b2Body* pBody )
+{
+    // Fetch physics proxy.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(pBody->GetUserData());
+
+    // Ignore stuff that's not a scene object.
+    if ( pPhysicsProxy == NULL || pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return;
+
+    // Fetch scene object.
+    SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+
+    // Finish if the object is not passive or cannot move.
+    if ( !pSceneObject->mTickPassive || pBody->GetType() == b2_staticBody || !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
+        return;
+
+    // Activate the scene object.
+    activateSceneObject( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::forwardContacts( void )
 {
     // Debug Profiling.
@@ -713,12 +777,16 @@ void Scene::processTick( void )
     // Debug Profiling.
     PROFILE_SCOPE(Scene_ProcessTick);
 
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Scene );
+
     // Finish if the Scene is not added to the simulation.
     if ( !isProperlyAdded() )
         return;
 
     // Process Delete Requests.
     processDeleteRequests(false);
+    processRetiredObjects(false);
 
     // Update debug stats.
     mDebugStats.fps           = Con::getFloatVariable("fps::framePeriod", 0.0f);
@@ -728,6 +796,7 @@ void Scene::processTick( void )
     mDebugStats.contactCount  = (U32)mpWorld->GetContactCount();
     mDebugStats.proxyCount    = (U32)mpWorld->GetProxyCount();
     mDebugStats.objectsCount  = (U32)mSceneObjects.size();
+    mDebugStats.objectsActive = getActiveSceneObjectCount();
     mDebugStats.worldProfile  = mpWorld->GetProfile();
 
     // Set particle stats.
@@ -738,64 +807,96 @@ void Scene::processTick( void )
     // Finish if scene is paused.
     if ( !getScenePause() )
     {
-        // Reset object stats.
-        U32 objectsEnabled = 0;
-        U32 objectsVisible = 0;
-        U32 objectsAwake   = 0;
-
         // Fetch if a "normal" i.e. non-editor scene.
         const bool isNormalScene = !getIsEditorScene();
 
         // Update scene time.
         mSceneTime += Tickable::smTickSec;
 
+        // Are the metrics being shown?
+        if ( (getDebugMask() & SCENE_DEBUG_METRICS) != 0 )
+        {
+            // Yes, so reset object stats.
+            U32 objectsEnabled = 0;
+            U32 objectsVisible = 0;
+            U32 objectsAwake   = 0;
+
+            // Iterate scene objects.
+            for( S32 n = 0; n < mSceneObjects.size(); ++n )
+            {
+                // Fetch scene object.
+                SceneObject* pSceneObject = mSceneObjects[n];
+
+                // Update awake/asleep counts.
+                if ( pSceneObject->getAwake() )
+                    objectsAwake++;
+
+                // Update visible.
+                if ( pSceneObject->getVisible() )
+                    objectsVisible++;
+
+                // Update enabled.
+                if ( pSceneObject->isEnabled() )
+                    objectsEnabled++;
+            }
+
+            // Update object stats.
+            mDebugStats.objectsEnabled = objectsEnabled;
+            mDebugStats.objectsVisible = objectsVisible;
+            mDebugStats.objectsAwake   = objectsAwake;
+        }
+
+        // Compact the active scene objects and restore their id order if objects were added out of order.
+        // NOTE:- Objects are ticked in id order so that the tick order does not depend on activity history.
+        if ( mActiveTombstones > 0 || mActiveOrderDirty )
+        {
+            compactTickObjects( mActiveSceneObjects, mActiveTombstones, mActiveOrderDirty );
+            mActiveOrderDirty = false;
+        }
+
+        // Compact the passive scene objects once they are mostly tombstones.
+        if ( mPassiveTombstones > (U32)mPassiveSceneObjects.size() / 2 )
+            compactTickObjects( mPassiveSceneObjects, mPassiveTombstones, false );
+
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
 
-        // Iterate scene objects.
-        for( S32 n = 0; n < mSceneObjects.size(); ++n )
+        // Iterate active scene objects.
+        // NOTE:- Passivating an object here leaves a tombstone so the iteration is unaffected.
+        const S32 activeSceneObjectCount = mActiveSceneObjects.size();
+        for( S32 n = 0; n < activeSceneObjectCount; ++n )
         {
             // Fetch scene object.
-            SceneObject* pSceneObject = mSceneObjects[n];
-
-            // Update awake/asleep counts.
-            if ( pSceneObject->getAwake() )
-                objectsAwake++;
+            SceneObject* pSceneObject = mActiveSceneObjects[n];
 
-            // Update visible.
-            if ( pSceneObject->getVisible() )
-                objectsVisible++;
-
-            // Push scene object if it's eligible for ticking.
-            if ( pSceneObject->isEnabled() )
+            // Is the object disabled or being deleted?
+            if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
             {
-                // Update enabled.
-                objectsEnabled++;
-
-                // Add to ticked objects if object is not being deleted and this is a "normal" scene or
-                // the object is marked as allowing editor ticks.
-                if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
-                    mTickedSceneObjects.push_back( pSceneObject );
+                // Yes, so passivate it.
+                passivateSceneObject( pSceneObject );
+                continue;
             }
+
+            // Add to ticked objects if this is a "normal" scene or the object is marked as allowing editor ticks.
+            if ( isNormalScene || pSceneObject->getIsEditorTickAllowed() )
+                mTickedSceneObjects.push_back( pSceneObject );
         }
 
-        // Update object stats.
-        mDebugStats.objectsEnabled = objectsEnabled;
-        mDebugStats.objectsVisible = objectsVisible;
-        mDebugStats.objectsAwake   = objectsAwake;
+        // Flag the ticked objects as built so that any object activated from here on is queued to join them.
+        mTickListBuilt = true;
 
         // Debug Status Reference.
         DebugStats* pDebugStats = &mDebugStats;
 
-        // Fetch ticked scene object count.
-        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+        // Fetch pre-integrated scene object count.
+        const S32 preIntegratedSceneObjectCount = mTickedSceneObjects.size();
 
         // ****************************************************
         // Pre-integrate objects.
         // ****************************************************
 
         // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        for ( S32 i = 0; i < preIntegratedSceneObjectCount; ++i )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PreIntegrate);
@@ -849,9 +950,30 @@ void Scene::processTick( void )
             mpWorld->Step( Tickable::smTickSec, mVelocityIterations, mPositionIterations );
         }
 
+        // Tick any objects activated by pre-integration, the controllers or the physics step.
+        // NOTE:- Passive objects have settled spatials so they have nothing to pre-integrate.
+        // Objects activated after this are already active so they are ticked next tick.
+        for ( S32 i = 0; i < mAwokenSceneObjects.size(); ++i )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mAwokenSceneObjects[i];
+
+            // Skip the object if it has been passivated again since.
+            if ( pSceneObject->mTickPassive )
+                continue;
+
+            mTickedSceneObjects.push_back( pSceneObject );
+        }
+
+        mAwokenSceneObjects.clear();
+        mTickListBuilt = false;
+
         // Debug Profiling.
         PROFILE_END();   // Scene_IntegratePhysicsSystem
 
+        // Fetch ticked scene object count.
+        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+
         // Forward the contacts.
         forwardContacts();
 
@@ -879,8 +1001,15 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PostIntegrate);
 
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
             // Post-integrate.
-            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+
+            // Passivate the object if it no longer needs ticking and is still in this scene.
+            if ( pSceneObject->getScene() == this && pSceneObject->canTickPassive() )
+                passivateSceneObject( pSceneObject );
         }
 
         // Scene update callback.
@@ -922,17 +1051,18 @@ void Scene::interpolateTick( F32 timeDelta )
     // Interpolate scene objects.
     // ****************************************************
 
-    // Fetch the scene object count.
-    const S32 sceneObjectCount = mSceneObjects.size();
+    // Fetch the active scene object count.
+    // NOTE:- Passive objects have nothing to interpolate.
+    const S32 sceneObjectCount = mActiveSceneObjects.size();
 
-    // Iterate scene objects.
+    // Iterate active scene objects.
     for( S32 n = 0; n < sceneObjectCount; ++n )
     {
         // Fetch scene object.
-        SceneObject* pSceneObject = mSceneObjects[n];
+        SceneObject* pSceneObject = mActiveSceneObjects[n];
 
         // Skip interpolation of scene object if it's not eligible.
-        if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
+        if ( pSceneObject == NULL || !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
             continue;
 
         pSceneObject->interpolateObject( timeDelta );
@@ -946,6 +1076,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     // Debug Profiling.
     PROFILE_SCOPE(Scene_RenderSceneTotal);
 
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Render );
+
     // Fetch debug stats.
     DebugStats* pDebugStats = pSceneRenderState->mpDebugStats;
 
@@ -1020,6 +1153,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                 // Yes, so increase render picked.
                 pDebugStats->renderPicked += layerObjectCount;
 
+                // Prepare any objects that can be prepared concurrently.
+                const bool preparedConcurrently = prepareRenderConcurrently( pSceneRenderState, layerResults );
+                U32 prepareRenderJobIndex = 0;
+
                 // Iterate query results.
                 for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
                 {
@@ -1051,6 +1188,22 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                             // Adjust for the extra private render request.
                             pDebugStats->renderRequests -= 1;
                         }
+                        // Was the object prepared concurrently?
+                        else if ( preparedConcurrently && prepareRenderJobIndex < (U32)mPrepareRenderJobs.size() && mPrepareRenderJobs[prepareRenderJobIndex].mpSceneObject == pSceneObject )
+                        {
+                            // Yes, so fetch the prepare job.
+                            const tPrepareRenderJob& prepareRenderJob = mPrepareRenderJobs[prepareRenderJobIndex++];
+
+                            // Move the render requests from the shard into the primary queue.
+                            // NOTE:- This happens in object order so the primary queue is identical to preparing serially.
+                            SceneRenderQueue::typeRenderRequestVector& shardRenderRequests = mRenderShards[prepareRenderJob.mShard]->mRenderQueue.getRenderRequests();
+                            SceneRenderQueue::typeRenderRequestVector& primaryRenderRequests = pSceneRenderQueue->getRenderRequests();
+                            const U32 requestEnd = prepareRenderJob.mRequestStart + prepareRenderJob.mRequestCount;
+                            for ( U32 requestIndex = prepareRenderJob.mRequestStart; requestIndex < requestEnd; ++requestIndex )
+                            {
+                                primaryRenderRequests.push_back( shardRenderRequests[requestIndex] );
+                            }
+                        }
                         else
                         {
                             // No, so prepare in primary queue.
@@ -1064,6 +1217,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     }
                 }
 
+                // Finish any concurrent preparation.
+                if ( preparedConcurrently )
+                    finishPrepareRenderConcurrently();
+
                 // Fetch render requests.
                 SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
 
@@ -1093,6 +1250,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     pSceneRenderQueue->sort();
                 }
 
+                // Record any render requests that can be rendered concurrently.
+                const bool renderedConcurrently = renderConcurrently( pSceneRenderState, sceneRenderRequests );
+                U32 renderJobIndex = 0;
+
                 // Iterate render requests.
                 for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
                 {
@@ -1171,8 +1332,16 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     }
                     else
                     {
-                        // No, so can the object render?
-                        if ( pSceneRenderObject->validRender() )
+                        // No, so was the object recorded concurrently?
+                        if ( renderedConcurrently && renderJobIndex < (U32)mRenderJobs.size() && mRenderJobs[renderJobIndex].mpSceneRenderRequest == pSceneRenderRequest )
+                        {
+                            // Yes, so submit the recording.
+                            // NOTE:- This goes through the same batch renderer calls as rendering the object would.
+                            const tRenderJob& renderJob = mRenderJobs[renderJobIndex++];
+                            mRenderShards[renderJob.mShard]->mRenderStream.submit( &mBatchRenderer, renderJob.mCommandStart, renderJob.mCommandEnd );
+                        }
+                        // Can the object render?
+                        else if ( pSceneRenderObject->validRender() )
                         {
                             // Yes, so render object.
                             pSceneRenderObject->sceneRender( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
@@ -1188,6 +1357,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     }
                 }
 
+                // Finished with the concurrent recordings.
+                mRenderJobs.clear();
+
                 // Flush.
                 // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
                 mBatchRenderer.flush( pDebugStats->batchLayerFlush );
@@ -1305,6 +1477,117 @@ void Scene::clearScene( bool deleteObjects )
 
 //-----------------------------------------------------------------------------
 
+static S32 QSORT_CALLBACK tickObjectIdSort( const void* a, const void* b )
+{
+    // Fetch scene objects.
+    const SceneObject* pSceneObjectA  = *((const SceneObject**)a);
+    const SceneObject* pSceneObjectB  = *((const SceneObject**)b);
+
+    return pSceneObjectA->getId() < pSceneObjectB->getId() ? -1 : pSceneObjectA->getId() > pSceneObjectB->getId() ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addTickObject( SceneObject* pSceneObject, const bool passive )
+{
+    // Fetch the tick objects.
+    typeSceneObjectVector& tickObjects = passive ? mPassiveSceneObjects : mActiveSceneObjects;
+
+    // Flag the active order as dirty if the object is not being added in id order.
+    if ( !passive && tickObjects.size() > 0 && ( tickObjects.last() == NULL || tickObjects.last()->getId() > pSceneObject->getId() ) )
+        mActiveOrderDirty = true;
+
+    pSceneObject->mTickPassive = passive;
+    pSceneObject->mTickIndex = tickObjects.size();
+    tickObjects.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeTickObject( SceneObject* pSceneObject )
+{
+    // Fetch the tick objects.
+    typeSceneObjectVector& tickObjects = pSceneObject->mTickPassive ? mPassiveSceneObjects : mActiveSceneObjects;
+
+    // Fetch the tick index.
+    const S32 tickIndex = pSceneObject->mTickIndex;
+
+    // Sanity!
+    AssertFatal( tickIndex >= 0 && tickIndex < tickObjects.size() && tickObjects[tickIndex] == pSceneObject, "Scene - Invalid scene object tick index." );
+
+    // Leave a tombstone so that the order of the remaining objects is preserved.
+    // NOTE:- The tombstones are compacted before the next tick.
+    tickObjects[tickIndex] = NULL;
+    if ( pSceneObject->mTickPassive )
+        mPassiveTombstones++;
+    else
+        mActiveTombstones++;
+
+    pSceneObject->mTickIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::compactTickObjects( typeSceneObjectVector& tickObjects, U32& tombstones, const bool sortById )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CompactTickObjects);
+
+    // Remove the tombstones keeping the order of the remaining objects.
+    if ( tombstones > 0 )
+    {
+        U32 objectCount = 0;
+        for ( S32 n = 0; n < tickObjects.size(); ++n )
+        {
+            if ( tickObjects[n] != NULL )
+                tickObjects[objectCount++] = tickObjects[n];
+        }
+
+        tickObjects.setSize( objectCount );
+        tombstones = 0;
+    }
+
+    // Sort by id if requested.
+    if ( sortById )
+        dQsort( tickObjects.address(), tickObjects.size(), sizeof(SceneObject*), tickObjectIdSort );
+
+    // Fix-up the tick indices.
+    for ( S32 n = 0; n < tickObjects.size(); ++n )
+        tickObjects[n]->mTickIndex = n;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::activateSceneObject( SceneObject* pSceneObject )
+{
+    // Finish if the object is not passive in this scene.
+    if ( !pSceneObject->mTickPassive || pSceneObject->getScene() != this )
+        return;
+
+    // Move to the active scene objects.
+    removeTickObject( pSceneObject );
+    addTickObject( pSceneObject, false );
+
+    // Queue the object to be ticked this tick if the ticked objects have already been gathered.
+    if ( mTickListBuilt && ( !getIsEditorScene() || pSceneObject->getIsEditorTickAllowed() ) )
+        mAwokenSceneObjects.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::passivateSceneObject( SceneObject* pSceneObject )
+{
+    // Finish if the object is not active in this scene.
+    if ( pSceneObject->mTickPassive || pSceneObject->mTickIndex < 0 || pSceneObject->getScene() != this )
+        return;
+
+    // Move to the passive scene objects.
+    removeTickObject( pSceneObject );
+    addTickObject( pSceneObject, true );
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::addToScene( SceneObject* pSceneObject )
 {
     if ( pSceneObject == NULL )
@@ -1335,6 +1618,9 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Add scene object.
     mSceneObjects.push_back( pSceneObject );
 
+    // Add as an active scene object.
+    addTickObject( pSceneObject, false );
+
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
@@ -1393,6 +1679,20 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
         }
     }
 
+    // Remove from the active or passive scene objects.
+    removeTickObject( pSceneObject );
+    pSceneObject->mTickPassive = false;
+
+    // Remove from the queued activations.
+    for ( S32 n = 0; n < mAwokenSceneObjects.size(); ++n )
+    {
+        if ( mAwokenSceneObjects[n] == pSceneObject )
+        {
+            mAwokenSceneObjects.erase( n );
+            break;
+        }
+    }
+
     // Perform callback.
     Con::executef( pSceneObject, 2, "onRemoveFromScene", getIdString() );
 }
@@ -3723,8 +4023,11 @@ void Scene::processDeleteRequests( const bool forceImmediate )
             // Do script callback.
             Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
 
-            // Destroy the object.
-            pSceneObject->deleteObject();
+            // Retire or destroy the object.
+            if ( forceImmediate )
+                destroySceneObject( pSceneObject, pSceneObject->isEnabled(), pSceneObject->getVisible() );
+            else
+                retireSceneObject( pSceneObject );
         }
 
         // Remove All delete-requests.
@@ -3747,8 +4050,11 @@ void Scene::processDeleteRequests( const bool forceImmediate )
                 // Do script callback.
                 Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
 
-                // Destroy the object.
-                pSceneObject->deleteObject();
+                // Retire or destroy the object.
+                if ( forceImmediate )
+                    destroySceneObject( pSceneObject, pSceneObject->isEnabled(), pSceneObject->getVisible() );
+                else
+                    retireSceneObject( pSceneObject );
 
                 // Quickly remove delete-request.
                 mDeleteRequestsTemp.erase_fast( requestIndex );
@@ -3765,6 +4071,260 @@ void Scene::processDeleteRequests( const bool forceImmediate )
 
 //-----------------------------------------------------------------------------
 
+void Scene::processRetiredObjects( const bool forceImmediate )
+{
+    // Ignore if there's no retired objects.
+    if ( mRetiredObjects.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_ProcessRetiredObjects);
+
+    // NOTE:-   The budget is a count rather than a time so that the same objects are destroyed on the same tick
+    //          whatever the machine which keeps recycling, and so journal playback, deterministic.
+    //          We always destroy at least a single object so that the retired objects cannot accumulate forever.
+    const U32 destroyBudget = getMax( mDeleteBudget, (U32)1 );
+
+    U32 destroyedCount = 0;
+    while ( mRetiredObjects.size() > 0 )
+    {
+        // Stop if the budget is spent.
+        if ( !forceImmediate && destroyedCount >= destroyBudget )
+            break;
+
+        if ( destroyRetiredObject() )
+            ++destroyedCount;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::destroyRetiredObject( void )
+{
+    // Fetch the retired object.
+    // NOTE:-   The object may have been deleted since it was retired.
+    const tRetiredObject retiredObject = mRetiredObjects.last();
+    mRetiredObjects.pop_back();
+
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( Sim::findObject( retiredObject.mObjectId ) );
+
+    if ( pSceneObject == NULL )
+        return false;
+
+    // Destroy the object.
+    destroySceneObject( pSceneObject, retiredObject.mEnabled, retiredObject.mVisible );
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::retireSceneObject( SceneObject* pSceneObject )
+{
+    // Destroy the object immediately if there's no delete budget.
+    if ( mDeleteBudget == 0 )
+    {
+        destroySceneObject( pSceneObject, pSceneObject->isEnabled(), pSceneObject->getVisible() );
+        return;
+    }
+
+    // Note the state to restore if the object is recycled.
+    tRetiredObject retiredObject;
+    retiredObject.mObjectId = pSceneObject->getId();
+    retiredObject.mEnabled = pSceneObject->isEnabled();
+    retiredObject.mVisible = pSceneObject->getVisible();
+
+    // Hide and disable the object so that it plays no further part in the scene.
+    // NOTE:-   The object remains flagged as being deleted so it is neither ticked nor contacted.
+    pSceneObject->setVisible( false );
+    pSceneObject->setEnabled( false );
+
+    // Destroy it later within the delete budget of a tick.
+    mRetiredObjects.push_back( retiredObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::destroySceneObject( SceneObject* pSceneObject, const bool enabled, const bool visible )
+{
+    // Fetch the recycle pool for the object type.
+    tRecyclePool* pRecyclePool = findRecyclePool( pSceneObject->getClassRep() );
+
+    // Is there space in the recycle pool?
+    if ( pRecyclePool == NULL || (U32)pRecyclePool->mObjects.size() >= pRecyclePool->mLimit || pSceneObject->getScene() != this )
+    {
+        // No, so destroy the object.
+        pSceneObject->deleteObject();
+        return;
+    }
+
+    // Stop any movement events.
+    pSceneObject->cancelMoveTo( false );
+    pSceneObject->cancelRotateTo( false );
+
+    // Remove from the scene.
+    removeFromScene( pSceneObject );
+
+    // Cancel any scheduled events.
+    Sim::cancelPendingEvents( pSceneObject );
+
+    // Reset the transient state.
+    pSceneObject->setLifetime( 0.0f );
+    pSceneObject->setLinearVelocity( Vector2::getZero() );
+    pSceneObject->setAngularVelocity( 0.0f );
+    pSceneObject->setActive( true );
+    pSceneObject->setAwake( true );
+
+    // Forget the identity of the deleted object.
+    // NOTE:-   The object is given a new id so that any references to the deleted object no longer find it
+    //          either in the pool or once it has been reused.
+    pSceneObject->assignName( "" );
+    pSceneObject->clearDynamicFields();
+    pSceneObject->setId( 0 );
+
+    // Keep the object for reuse.
+    tRetiredObject recycledObject;
+    recycledObject.mObjectId = pSceneObject->getId();
+    recycledObject.mEnabled = enabled;
+    recycledObject.mVisible = visible;
+    pRecyclePool->mObjects.push_back( recycledObject );
+}
+
+//-----------------------------------------------------------------------------
+
+tRecyclePool* Scene::findRecyclePool( AbstractClassRep* pClassRep )
+{
+    for ( U32 poolIndex = 0; poolIndex < (U32)mRecyclePools.size(); ++poolIndex )
+    {
+        if ( mRecyclePools[poolIndex].mpClassRep == pClassRep )
+            return &mRecyclePools[poolIndex];
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* Scene::takeRecycledObject( AbstractClassRep* pClassRep )
+{
+    // Fetch the recycle pool for the object type.
+    tRecyclePool* pRecyclePool = findRecyclePool( pClassRep );
+
+    // Finish if there's no pool.
+    if ( pRecyclePool == NULL )
+        return NULL;
+
+    while ( pRecyclePool->mObjects.size() > 0 )
+    {
+        // Fetch the recycled object.
+        // NOTE:-   The object may have been deleted whilst it was in the pool.
+        const tRetiredObject recycledObject = pRecyclePool->mObjects.last();
+        pRecyclePool->mObjects.pop_back();
+
+        SceneObject* pSceneObject = dynamic_cast<SceneObject*>( Sim::findObject( recycledObject.mObjectId ) );
+
+        if ( pSceneObject == NULL || pSceneObject->getScene() != NULL )
+            continue;
+
+        // Restore the object to the state it had before it was deleted.
+        pSceneObject->mBeingSafeDeleted = false;
+        pSceneObject->setEnabled( recycledObject.mEnabled );
+        pSceneObject->setVisible( recycledObject.mVisible );
+
+        return pSceneObject;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setRecycleLimit( const char* pType, const U32 limit )
+{
+    // Sanity!
+    AssertFatal( pType != NULL, "Scene::setRecycleLimit() - Cannot use a NULL type." );
+
+    // Find the class rep.
+    AbstractClassRep* pClassRep = AbstractClassRep::findClassRep( pType );
+
+    // Is the type derived from scene object?
+    if ( pClassRep == NULL || !pClassRep->isClass( AbstractClassRep::findClassRep( "SceneObject" ) ) )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::setRecycleLimit() - Type '%s' is not derived from SceneObject.", pType );
+        return;
+    }
+
+    // Fetch the recycle pool.
+    tRecyclePool* pRecyclePool = findRecyclePool( pClassRep );
+
+    // Create the recycle pool if needed.
+    if ( pRecyclePool == NULL )
+    {
+        // Finish if there's no limit.
+        if ( limit == 0 )
+            return;
+
+        mRecyclePools.increment();
+        pRecyclePool = &mRecyclePools.last();
+        pRecyclePool->mpClassRep = pClassRep;
+    }
+
+    pRecyclePool->mLimit = limit;
+
+    // Delete any objects beyond the limit.
+    while ( (U32)pRecyclePool->mObjects.size() > limit )
+    {
+        SimObject* pSimObject = Sim::findObject( pRecyclePool->mObjects.last().mObjectId );
+        pRecyclePool->mObjects.pop_back();
+
+        if ( pSimObject != NULL )
+            pSimObject->deleteObject();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::getRecycleLimit( const char* pType )
+{
+    // Fetch the recycle pool.
+    tRecyclePool* pRecyclePool = findRecyclePool( AbstractClassRep::findClassRep( pType ) );
+
+    return pRecyclePool == NULL ? 0 : pRecyclePool->mLimit;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::getRecycleCount( const char* pType )
+{
+    // Fetch the recycle pool.
+    tRecyclePool* pRecyclePool = findRecyclePool( AbstractClassRep::findClassRep( pType ) );
+
+    return pRecyclePool == NULL ? 0 : (U32)pRecyclePool->mObjects.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::clearRecyclePools( void )
+{
+    for ( U32 poolIndex = 0; poolIndex < (U32)mRecyclePools.size(); ++poolIndex )
+    {
+        tRecyclePool& recyclePool = mRecyclePools[poolIndex];
+
+        // Delete the recycled objects.
+        for ( U32 objectIndex = 0; objectIndex < (U32)recyclePool.mObjects.size(); ++objectIndex )
+        {
+            SimObject* pSimObject = Sim::findObject( recyclePool.mObjects[objectIndex].mObjectId );
+
+            if ( pSimObject != NULL )
+                pSimObject->deleteObject();
+        }
+
+        recyclePool.mObjects.clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::SayGoodbye( b2Joint* pJoint )
 {
     // Find the joint id.
@@ -3811,8 +4371,19 @@ SceneObject* Scene::create( const char* pType )
         return NULL;
     }
     
+    // Reuse a recycled object if one is available.
+    SceneObject* pSceneObject = takeRecycledObject( pClassRep );
+
+    if ( pSceneObject != NULL )
+    {
+        // Add to the scene.
+        addToScene( pSceneObject );
+
+        return pSceneObject;
+    }
+
     // Create the type.
-    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pClassRep->create() );
+    pSceneObject = dynamic_cast<SceneObject*>( pClassRep->create() );
 
     // Sanity!
     AssertFatal( pSceneObject != NULL, "Scene::create() - Failed to create type via class rep." );
@@ -5206,6 +5777,246 @@ U32 Scene::getGlobalSceneCount( void )
 
 //-----------------------------------------------------------------------------
 
+struct ScenePrepareRenderContext
+{
+    const SceneRenderState* mpSceneRenderState;
+    tPrepareRenderJob*      mpPrepareRenderJobs;
+    U32                     mJobCount;
+    tRenderShard**          mpRenderShards;
+    U32                     mShardCount;
+};
+
+//-----------------------------------------------------------------------------
+
+static void prepareRenderShard( void* pContext, const U32 shardIndex )
+{
+    // Fetch the prepare context.
+    ScenePrepareRenderContext* pPrepareContext = (ScenePrepareRenderContext*)pContext;
+
+    // Fetch the shard queue.
+    SceneRenderQueue* pShardRenderQueue = &pPrepareContext->mpRenderShards[shardIndex]->mRenderQueue;
+    SceneRenderQueue::typeRenderRequestVector& shardRenderRequests = pShardRenderQueue->getRenderRequests();
+
+    // Calculate the contiguous range of jobs for this shard.
+    const U32 jobStart = (pPrepareContext->mJobCount * shardIndex) / pPrepareContext->mShardCount;
+    const U32 jobEnd = (pPrepareContext->mJobCount * (shardIndex+1)) / pPrepareContext->mShardCount;
+
+    // Prepare the objects into the shard noting where each object's render requests are.
+    for ( U32 jobIndex = jobStart; jobIndex < jobEnd; ++jobIndex )
+    {
+        tPrepareRenderJob& prepareRenderJob = pPrepareContext->mpPrepareRenderJobs[jobIndex];
+        prepareRenderJob.mShard = shardIndex;
+        prepareRenderJob.mRequestStart = (U32)shardRenderRequests.size();
+        prepareRenderJob.mpSceneObject->scenePrepareRender( pPrepareContext->mpSceneRenderState, pShardRenderQueue );
+        prepareRenderJob.mRequestCount = (U32)shardRenderRequests.size() - prepareRenderJob.mRequestStart;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::prepareRenderConcurrently( const SceneRenderState* pSceneRenderState, typeWorldQueryResultVector& layerResults )
+{
+    // Finish if there are no worker threads.
+    const U32 threadCount = WorkerPool::getThreadCount();
+    if ( threadCount == 0 )
+        return false;
+
+    // Gather the objects that can be prepared concurrently.
+    // NOTE:- Batch isolated objects need their own queue so are always prepared serially.
+    mPrepareRenderJobs.clear();
+    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+        // Skip if the object cannot be prepared concurrently.
+        if ( !pSceneObject->shouldRender() || !pSceneObject->canPrepareRender() || pSceneObject->getBatchIsolated() || !pSceneObject->canPrepareRenderConcurrently() )
+            continue;
+
+        tPrepareRenderJob prepareRenderJob;
+        prepareRenderJob.mpSceneObject = pSceneObject;
+        prepareRenderJob.mShard = 0;
+        prepareRenderJob.mRequestStart = 0;
+        prepareRenderJob.mRequestCount = 0;
+        mPrepareRenderJobs.push_back( prepareRenderJob );
+    }
+
+    // Finish if there's not enough to split.
+    const U32 jobCount = (U32)mPrepareRenderJobs.size();
+    if ( jobCount < 2 )
+    {
+        mPrepareRenderJobs.clear();
+        return false;
+    }
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RenderScenePrepareConcurrently);
+
+    // Create any render shards required.
+    const U32 shardCount = getMin( threadCount + 1, jobCount );
+    while ( (U32)mRenderShards.size() < shardCount )
+    {
+        mRenderShards.push_back( new tRenderShard() );
+    }
+
+    // Reserve render requests for the shards.
+    // NOTE:- The shared render request factory isn't thread-safe so each shard is given enough
+    // requests from it for what it used last time.  The requests are returned to the shared factory
+    // by the primary queue once they have been moved there.
+    for ( U32 shardIndex = 0; shardIndex < shardCount; ++shardIndex )
+    {
+        tRenderShard* pRenderShard = mRenderShards[shardIndex];
+        pRenderShard->mRenderRequestFactory.reserveCache( SceneRenderRequestFactory, pRenderShard->mRenderRequestReserve );
+    }
+
+    // Prepare the shards.
+    ScenePrepareRenderContext prepareContext;
+    prepareContext.mpSceneRenderState = pSceneRenderState;
+    prepareContext.mpPrepareRenderJobs = mPrepareRenderJobs.address();
+    prepareContext.mJobCount = jobCount;
+    prepareContext.mpRenderShards = mRenderShards.address();
+    prepareContext.mShardCount = shardCount;
+    WorkerPool::process( prepareRenderShard, &prepareContext, shardCount );
+
+    // Note the render requests used by each shard.
+    for ( U32 shardIndex = 0; shardIndex < shardCount; ++shardIndex )
+    {
+        tRenderShard* pRenderShard = mRenderShards[shardIndex];
+        pRenderShard->mRenderRequestReserve = (U32)pRenderShard->mRenderQueue.getRenderRequests().size();
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::finishPrepareRenderConcurrently( void )
+{
+    // Sanity!
+    AssertFatal( mRenderShards.size() > 0, "Scene::finishPrepareRenderConcurrently() - No render shards." );
+
+    // Reset the render shards.
+    // NOTE:- The render requests have been moved to the primary queue which now owns them.
+    for ( typeRenderShardVector::iterator shardItr = mRenderShards.begin(); shardItr != mRenderShards.end(); ++shardItr )
+    {
+        SceneRenderQueue& shardRenderQueue = (*shardItr)->mRenderQueue;
+        shardRenderQueue.detachRenderRequests();
+        shardRenderQueue.resetState();
+    }
+
+    mPrepareRenderJobs.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+struct SceneRenderContext
+{
+    const SceneRenderState* mpSceneRenderState;
+    tRenderJob*             mpRenderJobs;
+    U32                     mJobCount;
+    tRenderShard**          mpRenderShards;
+    U32                     mShardCount;
+};
+
+//-----------------------------------------------------------------------------
+
+static void renderShard( void* pContext, const U32 shardIndex )
+{
+    // Fetch the render context.
+    SceneRenderContext* pRenderContext = (SceneRenderContext*)pContext;
+
+    // Fetch the shard stream and the batch renderer that records into it.
+    tRenderShard* pRenderShard = pRenderContext->mpRenderShards[shardIndex];
+    BatchRenderStream& renderStream = pRenderShard->mRenderStream;
+    BatchRender* pStreamRenderer = &pRenderShard->mStreamRenderer;
+
+    // Calculate the contiguous range of jobs for this shard.
+    const U32 jobStart = (pRenderContext->mJobCount * shardIndex) / pRenderContext->mShardCount;
+    const U32 jobEnd = (pRenderContext->mJobCount * (shardIndex+1)) / pRenderContext->mShardCount;
+
+    // Record each render request into its own segment of the stream.
+    for ( U32 jobIndex = jobStart; jobIndex < jobEnd; ++jobIndex )
+    {
+        tRenderJob& renderJob = pRenderContext->mpRenderJobs[jobIndex];
+        SceneRenderRequest* pSceneRenderRequest = renderJob.mpSceneRenderRequest;
+        renderJob.mShard = shardIndex;
+        renderJob.mCommandStart = renderStream.beginSegment();
+        pSceneRenderRequest->mpSceneRenderObject->sceneRender( pRenderContext->mpSceneRenderState, pSceneRenderRequest, pStreamRenderer );
+        renderJob.mCommandEnd = renderStream.getCommandCount();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::renderConcurrently( const SceneRenderState* pSceneRenderState, SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests )
+{
+    // Finish if there are no worker threads.
+    const U32 threadCount = WorkerPool::getThreadCount();
+    if ( threadCount == 0 )
+        return false;
+
+    // Gather the render requests that can be recorded concurrently.
+    // NOTE:- Batch isolated objects and fallbacks are always rendered serially.
+    mRenderJobs.clear();
+    for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
+    {
+        // Fetch render request.
+        SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
+
+        // Fetch scene render object.
+        SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
+
+        // Skip if the request cannot be recorded concurrently.
+        if ( !pSceneRenderObject->canRenderConcurrently() || pSceneRenderObject->getBatchIsolated() || !pSceneRenderObject->isBatchRendered() || !pSceneRenderObject->validRender() )
+            continue;
+
+        tRenderJob renderJob;
+        renderJob.mpSceneRenderRequest = pSceneRenderRequest;
+        renderJob.mShard = 0;
+        renderJob.mCommandStart = 0;
+        renderJob.mCommandEnd = 0;
+        mRenderJobs.push_back( renderJob );
+    }
+
+    // Finish if there's not enough to split.
+    const U32 jobCount = (U32)mRenderJobs.size();
+    if ( jobCount < 2 )
+    {
+        mRenderJobs.clear();
+        return false;
+    }
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RenderSceneRecordConcurrently);
+
+    // Create any render shards required.
+    const U32 shardCount = getMin( threadCount + 1, jobCount );
+    while ( (U32)mRenderShards.size() < shardCount )
+    {
+        mRenderShards.push_back( new tRenderShard() );
+    }
+
+    // Clear the shard streams.
+    // NOTE:- The streams keep their storage so recording doesn't allocate once warmed up.
+    for ( U32 shardIndex = 0; shardIndex < shardCount; ++shardIndex )
+    {
+        mRenderShards[shardIndex]->mRenderStream.clear();
+    }
+
+    // Record the shards.
+    SceneRenderContext renderContext;
+    renderContext.mpSceneRenderState = pSceneRenderState;
+    renderContext.mpRenderJobs = mRenderJobs.address();
+    renderContext.mJobCount = jobCount;
+    renderContext.mpRenderShards = mRenderShards.address();
+    renderContext.mShardCount = shardCount;
+    WorkerPool::process( renderShard, &renderContext, shardCount );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 SceneRenderRequest* Scene::createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject )
 {
     // Create a render request and populate it with the default details.
@@ -95,6 +95,62 @@ struct tDeleteRequest
 
 ///-----------------------------------------------------------------------------
 
+struct tRetiredObject
+{
+    SimObjectId     mObjectId;
+    bool            mEnabled;
+    bool            mVisible;
+};
+
+///-----------------------------------------------------------------------------
+
+struct tRecyclePool
+{
+    AbstractClassRep*       mpClassRep;
+    U32                     mLimit;
+    Vector<tRetiredObject>  mObjects;
+};
+
+///-----------------------------------------------------------------------------
+
+struct tRenderShard
+{
+    tRenderShard() : mRenderRequestReserve( 0 ), mStreamRenderer( &mRenderStream )
+    {
+        mRenderQueue.setRenderRequestFactory( &mRenderRequestFactory );
+    }
+
+    FactoryCache<SceneRenderRequest>    mRenderRequestFactory;
+    SceneRenderQueue                    mRenderQueue;
+    U32                                 mRenderRequestReserve;
+
+    // NOTE:- The stream must be declared before the batch renderer that records into it.
+    BatchRenderStream                   mRenderStream;
+    BatchRender                         mStreamRenderer;
+};
+
+///-----------------------------------------------------------------------------
+
+struct tPrepareRenderJob
+{
+    SceneObject*    mpSceneObject;
+    U32             mShard;
+    U32             mRequestStart;
+    U32             mRequestCount;
+};
+
+///-----------------------------------------------------------------------------
+
+struct tRenderJob
+{
+    SceneRenderRequest* mpSceneRenderRequest;
+    U32                 mShard;
+    U32                 mCommandStart;
+    U32                 mCommandEnd;
+};
+
+///-----------------------------------------------------------------------------
+
 struct TickContact
 {
     TickContact()
@@ -163,15 +219,21 @@ class Scene :
     public PhysicsProxy,
     public b2ContactListener,
     public b2DestructionListener,
+    public b2WakeListener,
     public virtual Tickable
 {
 public:
     typedef HashMap<S32, b2Joint*>              typeJointHash;
     typedef HashMap<b2Joint*, S32>              typeReverseJointHash;
     typedef Vector<tDeleteRequest>              typeDeleteVector;
+    typedef Vector<tRetiredObject>              typeRetiredVector;
+    typedef Vector<tRecyclePool>                typeRecyclePoolVector;
     typedef Vector<TickContact>                 typeContactVector;
     typedef HashMap<b2Contact*, TickContact>    typeContactHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
+    typedef Vector<tRenderShard*>               typeRenderShardVector;
+    typedef Vector<tPrepareRenderJob>           typePrepareRenderJobVector;
+    typedef Vector<tRenderJob>                  typeRenderJobVector;
 
     /// Scene Debug Options.
     enum DebugOption
@@ -222,6 +284,13 @@ private:
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
+    typeSceneObjectVector       mActiveSceneObjects;
+    typeSceneObjectVector       mPassiveSceneObjects;
+    typeSceneObjectVector       mAwokenSceneObjects;
+    U32                         mActiveTombstones;
+    U32                         mPassiveTombstones;
+    bool                        mActiveOrderDirty;
+    bool                        mTickListBuilt;
 
     /// Joint access.
     typeJointHash               mJoints;
@@ -249,6 +318,11 @@ private:
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
 
+    /// Concurrent render preparation.
+    typeRenderShardVector       mRenderShards;
+    typePrepareRenderJobVector  mPrepareRenderJobs;
+    typeRenderJobVector         mRenderJobs;
+
     /// Window rendering.
     SceneWindow*                mpCurrentRenderWindow;
 
@@ -258,6 +332,11 @@ private:
     /// Delete requests.
     typeDeleteVector            mDeleteRequests;
     typeDeleteVector            mDeleteRequestsTemp;
+    typeRetiredVector           mRetiredObjects;
+    U32                         mDeleteBudget;
+
+    /// Recycle pools.
+    typeRecyclePoolVector       mRecyclePools;
   
     /// Miscellaneous.
     S32                         mIsEditorScene;
@@ -273,6 +352,23 @@ private:
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
 
+    /// Deletion and recycling.
+    void                        retireSceneObject( SceneObject* pSceneObject );
+    bool                        destroyRetiredObject( void );
+    void                        destroySceneObject( SceneObject* pSceneObject, const bool enabled, const bool visible );
+    tRecyclePool*               findRecyclePool( AbstractClassRep* pClassRep );
+    SceneObject*                takeRecycledObject( AbstractClassRep* pClassRep );
+
+    /// Tick activity.
+    void                        addTickObject( SceneObject* pSceneObject, const bool passive );
+    void                        removeTickObject( SceneObject* pSceneObject );
+    void                        compactTickObjects( typeSceneObjectVector& tickObjects, U32& tombstones, const bool sortById );
+
+    /// Render preparation.
+    bool                        prepareRenderConcurrently( const SceneRenderState* pSceneRenderState, typeWorldQueryResultVector& layerResults );
+    void                        finishPrepareRenderConcurrently( void );
+    bool                        renderConcurrently( const SceneRenderState* pSceneRenderState, SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests );
+
     /// Joint definition.
     struct CommonJointDefinition
     {
@@ -316,6 +412,9 @@ public:
     virtual void            PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse );
     virtual void            BeginContact( b2Contact* pContact );
     virtual void            EndContact( b2Contact* pContact );
+
+    /// Wake processing.
+    virtual void            BodyAwoken( b2Body* pBody );
     const typeContactHash&  getBeginContacts( void ) const              { return mBeginContacts; }
     const typeContactVector& getEndContacts( void ) const               { return mEndContacts; }
 
@@ -351,6 +450,12 @@ public:
     U32                     getSceneObjects( typeSceneObjectVector& objects ) const;
     U32                     getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const;
 
+    /// Tick activity.
+    void                    activateSceneObject( SceneObject* pSceneObject );
+    void                    passivateSceneObject( SceneObject* pSceneObject );
+    inline U32              getActiveSceneObjectCount( void ) const     { return (U32)mActiveSceneObjects.size() - mActiveTombstones; }
+    inline U32              getPassiveSceneObjectCount( void ) const    { return (U32)mPassiveSceneObjects.size() - mPassiveTombstones; }
+
     void                    mergeScene( const Scene* pScene );
 
     inline SimSet*			getControllers( void )						{ return mControllers; }
@@ -646,6 +751,16 @@ public:
     /// Delete requests.
     void                    addDeleteRequest( SceneObject* pSceneObject );
     void                    processDeleteRequests( const bool forceImmediate );
+    void                    processRetiredObjects( const bool forceImmediate );
+    inline void             setDeleteBudget( const U32 count )          { mDeleteBudget = count; }
+    inline U32              getDeleteBudget( void ) const               { return mDeleteBudget; }
+    inline U32              getRetiredCount( void ) const               { return (U32)mRetiredObjects.size(); }
+
+    /// Recycle pools.
+    void                    setRecycleLimit( const char* pType, const U32 limit );
+    U32                     getRecycleLimit( const char* pType );
+    U32                     getRecycleCount( const char* pType );
+    void                    clearRecyclePools( void );
 
     /// Destruction listeners.
     virtual                 void SayGoodbye( b2Joint* pJoint );
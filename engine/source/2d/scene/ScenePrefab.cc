@@ -0,0 +1,463 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/scene/ScenePrefab.h"
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+// Script bindings.
+#include "2d/scene/ScenePrefab_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT( ScenePrefab );
+
+//-----------------------------------------------------------------------------
+
+static bool isRawBlockField( const AbstractClassRep::Field* pField )
+{
+    // Only fields without setters or validators can be copied directly.
+    if ( pField->setDataFn != &defaultProtectedSetFn || pField->validator != NULL || pField->elementCount != 1 )
+        return false;
+
+    // Only plain value types can be copied directly.
+    // NOTE:-   Strings are string-table entries so copying the pointer is safe.
+    const S32 fieldType = (S32)pField->type;
+    return fieldType == TypeBool ||
+           fieldType == TypeS32 ||
+           fieldType == TypeF32 ||
+           fieldType == TypeEnum ||
+           fieldType == TypeString ||
+           fieldType == TypeColorF ||
+           fieldType == TypeVector2;
+}
+
+//-----------------------------------------------------------------------------
+
+ScenePrefab::ScenePrefab() :
+    mFile( StringTable->EmptyString )
+{
+    VECTOR_SET_ASSOCIATION( mObjects );
+}
+
+//-----------------------------------------------------------------------------
+
+ScenePrefab::~ScenePrefab()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePrefab::initPersistFields()
+{
+    // Call parent.
+    Parent::initPersistFields();
+
+    addProtectedField("File", TypeFilename, 0, &setFile, &getFile, &writeFile, "The Taml file the prefab is compiled from.");
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScenePrefab::compile( SimObject* pTemplateObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePrefab_Compile);
+
+    // Sanity!
+    AssertFatal( pTemplateObject != NULL, "ScenePrefab::compile() - Cannot compile a NULL template object." );
+
+    // Clear any existing compilation.
+    clear();
+
+    // Is the template a scene object?
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pTemplateObject );
+    if ( pSceneObject != NULL )
+    {
+        // Yes, so compile it alone.
+        compileObject( pSceneObject );
+        return true;
+    }
+
+    // No, so does it have children?
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pTemplateObject );
+    if ( pChildren == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "ScenePrefab::compile() - Template object '%s' is neither a scene object nor has children.", pTemplateObject->getIdString() );
+        return false;
+    }
+
+    // Compile the scene object children.
+    const U32 childCount = pChildren->getTamlChildCount();
+    for ( U32 childIndex = 0; childIndex < childCount; ++childIndex )
+    {
+        SceneObject* pChildObject = dynamic_cast<SceneObject*>( pChildren->getTamlChild( childIndex ) );
+
+        if ( pChildObject == NULL )
+        {
+            Con::warnf( "ScenePrefab::compile() - Ignoring child %d of template object '%s' as it is not a scene object.", childIndex, pTemplateObject->getIdString() );
+            continue;
+        }
+
+        compileObject( pChildObject );
+    }
+
+    return mObjects.size() > 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScenePrefab::compileFile( const char* pFilename )
+{
+    // Sanity!
+    AssertFatal( pFilename != NULL, "ScenePrefab::compileFile() - Cannot compile a NULL filename." );
+
+    // Expand the filename.
+    char filenameBuffer[1024];
+    Con::expandPath( filenameBuffer, sizeof(filenameBuffer), pFilename );
+
+    // Read the template.
+    Taml taml;
+    SimObject* pTemplateObject = taml.read( filenameBuffer );
+
+    if ( pTemplateObject == NULL )
+    {
+        Con::warnf( "ScenePrefab::compileFile() - Could not read template file '%s'.", filenameBuffer );
+        clear();
+        return false;
+    }
+
+    // Compile the template.
+    const bool compiled = compile( pTemplateObject );
+
+    // Delete the template children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pTemplateObject );
+    if ( pChildren != NULL && dynamic_cast<SceneObject*>( pTemplateObject ) == NULL )
+    {
+        while ( pChildren->getTamlChildCount() > 0 )
+            pChildren->getTamlChild( pChildren->getTamlChildCount()-1 )->deleteObject();
+    }
+
+    // Delete the template.
+    pTemplateObject->deleteObject();
+
+    // Note the file if compiled.
+    mFile = compiled ? StringTable->insert( pFilename ) : StringTable->EmptyString;
+
+    return compiled;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePrefab::clear( void )
+{
+    for ( U32 objectIndex = 0; objectIndex < (U32)mObjects.size(); ++objectIndex )
+    {
+        PrefabObject* pPrefabObject = mObjects[objectIndex];
+
+        // Delete the fixture shapes.
+        for ( U32 fixtureIndex = 0; fixtureIndex < (U32)pPrefabObject->mFixtures.size(); ++fixtureIndex )
+            delete pPrefabObject->mFixtures[fixtureIndex].shape;
+
+        delete pPrefabObject->mpCustomNodes;
+        delete pPrefabObject;
+    }
+
+    mObjects.clear();
+    mFile = StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePrefab::compileObject( SceneObject* pSceneObject )
+{
+    // NOTE:-   Field offsets are relative to the sim object.
+    SimObject* pSimObject = pSceneObject;
+
+    PrefabObject* pPrefabObject = new PrefabObject();
+    pPrefabObject->mpClassRep = pSceneObject->getClassRep();
+    pPrefabObject->mPosition = pSceneObject->getPosition();
+    pPrefabObject->mpCustomNodes = NULL;
+
+    // Fetch field list.
+    const AbstractClassRep::FieldList& fieldList = pSceneObject->getFieldList();
+
+    // Compile the static fields.
+    for ( U32 fieldIndex = 0; fieldIndex < (U32)fieldList.size(); ++fieldIndex )
+    {
+        // Fetch field.
+        const AbstractClassRep::Field* pField = &fieldList[fieldIndex];
+
+        // Ignore if field not appropriate.
+        if( pField->type == AbstractClassRep::DepricatedFieldType ||
+            pField->type == AbstractClassRep::StartGroupFieldType ||
+            pField->type == AbstractClassRep::EndGroupFieldType)
+            continue;
+
+        // Fetch fieldname.
+        StringTableEntry fieldName = StringTable->insert( pField->pFieldname );
+
+        // Skip the same fields that Taml would not write.
+        if ( pField->elementCount == 1 && pField->writeDataFn != NULL && pField->writeDataFn( pSimObject, fieldName ) == false )
+            continue;
+
+        // Can the field be copied directly?
+        if ( isRawBlockField( pField ) )
+        {
+            // Yes, so snapshot the raw value.
+            const U32 fieldSize = (U32)ConsoleBaseType::getType( pField->type )->getTypeSize();
+
+            PrefabBlock block;
+            block.mOffset = (U32)pField->offset;
+            block.mSize = fieldSize;
+            block.mDataOffset = (U32)pPrefabObject->mBlockData.size();
+
+            pPrefabObject->mBlockData.setSize( block.mDataOffset + fieldSize );
+            dMemcpy( pPrefabObject->mBlockData.address() + block.mDataOffset, ((const U8*)pSimObject) + block.mOffset, fieldSize );
+            pPrefabObject->mBlocks.push_back( block );
+            continue;
+        }
+
+        // No, so snapshot the prepared value of each element.
+        for( S32 elementIndex = 0; elementIndex < pField->elementCount; ++elementIndex )
+        {
+            char indexBuffer[8];
+            dSprintf( indexBuffer, 8, "%d", elementIndex );
+
+            // Fetch object field value.
+            const char* pFieldValue = pSceneObject->getPrefixedDataField( fieldName, indexBuffer );
+
+            // Skip if field should not be written.
+            if ( !pSceneObject->writeField( fieldName, pFieldValue ) )
+                continue;
+
+            char valueBuffer[2048];
+            const char* pPreparedValue = ConsoleBaseType::getType( pField->type )->prepData( pFieldValue, valueBuffer, sizeof(valueBuffer) );
+
+            PrefabField field;
+            field.mpField = pField;
+            field.mElement = elementIndex;
+            field.mValue = StringTable->insert( pPreparedValue );
+            pPrefabObject->mFields.push_back( field );
+        }
+    }
+
+    // Compile the dynamic fields.
+    SimFieldDictionary* pFieldDictionary = pSceneObject->getFieldDictionary();
+    if ( pFieldDictionary != NULL )
+    {
+        for( SimFieldDictionaryIterator itr(pFieldDictionary); *itr; ++itr )
+        {
+            PrefabDynamicField dynamicField;
+            dynamicField.mSlotName = (*itr)->slotName;
+            dynamicField.mValue = StringTable->insert( (*itr)->value );
+            pPrefabObject->mDynamicFields.push_back( dynamicField );
+        }
+    }
+
+    // Compile the collision shapes.
+    const U32 collisionShapeCount = pSceneObject->getCollisionShapeCount();
+    for ( U32 shapeIndex = 0; shapeIndex < collisionShapeCount; ++shapeIndex )
+    {
+        b2FixtureDef fixtureDef = pSceneObject->getCollisionShapeDefinition( shapeIndex );
+        fixtureDef.shape = cloneShape( fixtureDef.shape );
+        fixtureDef.userData = NULL;
+        pPrefabObject->mFixtures.push_back( fixtureDef );
+    }
+
+    // Compile any remaining custom state.
+    // NOTE:-   Collision shapes are written as custom state but are already compiled so we remove them.
+    TamlCustomNodes* pCustomNodes = new TamlCustomNodes();
+    pSceneObject->onTamlCustomWrite( *pCustomNodes );
+
+    const TamlCustomNodeVector& customNodes = pCustomNodes->getNodes();
+    for ( S32 nodeIndex = customNodes.size()-1; nodeIndex >= 0; --nodeIndex )
+    {
+        if ( customNodes[nodeIndex]->isEmpty() || customNodes[nodeIndex]->getNodeName() == StringTable->insert( "CollisionShapes" ) )
+            pCustomNodes->removeNode( nodeIndex );
+    }
+
+    // Keep the custom state only if there is any.
+    if ( pCustomNodes->getNodes().size() > 0 )
+        pPrefabObject->mpCustomNodes = pCustomNodes;
+    else
+        delete pCustomNodes;
+
+    mObjects.push_back( pPrefabObject );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScenePrefab::instantiate( Scene* pScene, const Vector2& position, Vector<SceneObject*>* pInstances )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePrefab_Instantiate);
+
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Scene );
+
+    // Sanity!
+    AssertFatal( pScene != NULL, "ScenePrefab::instantiate() - Cannot instantiate into a NULL scene." );
+
+    U32 instanceCount = 0;
+
+    for ( U32 objectIndex = 0; objectIndex < (U32)mObjects.size(); ++objectIndex )
+    {
+        SceneObject* pSceneObject = instantiateObject( mObjects[objectIndex], pScene, position );
+
+        if ( pSceneObject == NULL )
+            continue;
+
+        instanceCount++;
+
+        if ( pInstances != NULL )
+            pInstances->push_back( pSceneObject );
+    }
+
+    return instanceCount;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePrefab::instantiateObject( const PrefabObject* pPrefabObject, Scene* pScene, const Vector2& position )
+{
+    // Create the object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pPrefabObject->mpClassRep->create() );
+
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "ScenePrefab::instantiateObject() - Failed to create type via class rep." );
+
+    // NOTE:-   Field offsets are relative to the sim object.
+    SimObject* pSimObject = pSceneObject;
+
+    // Copy the raw field blocks.
+    const U8* pBlockData = pPrefabObject->mBlockData.address();
+    for ( U32 blockIndex = 0; blockIndex < (U32)pPrefabObject->mBlocks.size(); ++blockIndex )
+    {
+        const PrefabBlock& block = pPrefabObject->mBlocks[blockIndex];
+        dMemcpy( ((U8*)pSimObject) + block.mOffset, pBlockData + block.mDataOffset, block.mSize );
+    }
+
+    // Set the remaining static fields.
+    for ( U32 fieldIndex = 0; fieldIndex < (U32)pPrefabObject->mFields.size(); ++fieldIndex )
+    {
+        const PrefabField& field = pPrefabObject->mFields[fieldIndex];
+        const AbstractClassRep::Field* pField = field.mpField;
+
+        // If the set data notify callback returns true then set the data ourselves.
+        if ( (*pField->setDataFn)( pSimObject, field.mValue ) )
+        {
+            const char* pValue = field.mValue;
+            Con::setData( pField->type, (void*)(((const char*)pSimObject) + pField->offset), field.mElement, 1, &pValue, pField->table, pField->flag );
+        }
+    }
+
+    // Set the dynamic fields.
+    for ( U32 fieldIndex = 0; fieldIndex < (U32)pPrefabObject->mDynamicFields.size(); ++fieldIndex )
+    {
+        const PrefabDynamicField& dynamicField = pPrefabObject->mDynamicFields[fieldIndex];
+        pSceneObject->setDataField( dynamicField.mSlotName, NULL, dynamicField.mValue );
+    }
+
+    // Place the object.
+    // NOTE:-   The object is not in a scene yet so this only sets the body definition.
+    pSceneObject->setPosition( pPrefabObject->mPosition + position );
+
+    // Attempt to register the object.
+    if ( !pSceneObject->registerObject() )
+    {
+        // No, so warn.
+        Con::warnf( "ScenePrefab::instantiateObject() - Failed to register type '%s'.", pPrefabObject->mpClassRep->getClassName() );
+        delete pSceneObject;
+        return NULL;
+    }
+
+    // Restore any custom state.
+    if ( pPrefabObject->mpCustomNodes != NULL )
+        pSceneObject->onTamlCustomRead( *pPrefabObject->mpCustomNodes );
+
+    // Add to the scene.
+    // NOTE:-   This creates the body directly at its final transform.
+    pScene->addToScene( pSceneObject );
+
+    // Create the fixtures directly from the compiled definitions.
+    for ( U32 fixtureIndex = 0; fixtureIndex < (U32)pPrefabObject->mFixtures.size(); ++fixtureIndex )
+    {
+        b2FixtureDef fixtureDef = pPrefabObject->mFixtures[fixtureIndex];
+        fixtureDef.userData = static_cast<PhysicsProxy*>( pSceneObject );
+        pSceneObject->mCollisionFixtures.push_back( pSceneObject->mpBody->CreateFixture( &fixtureDef ) );
+    }
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+b2Shape* ScenePrefab::cloneShape( const b2Shape* pShape )
+{
+    switch( pShape->GetType() )
+    {
+        case b2Shape::e_circle:
+            return new b2CircleShape( *static_cast<const b2CircleShape*>( pShape ) );
+
+        case b2Shape::e_polygon:
+            return new b2PolygonShape( *static_cast<const b2PolygonShape*>( pShape ) );
+
+        case b2Shape::e_edge:
+            return new b2EdgeShape( *static_cast<const b2EdgeShape*>( pShape ) );
+
+        case b2Shape::e_chain:
+            {
+                // Chains own their vertices so they cannot be copied directly.
+                const b2ChainShape* pChainShape = static_cast<const b2ChainShape*>( pShape );
+                b2ChainShape* pClonedShape = new b2ChainShape();
+                pClonedShape->CreateChain( pChainShape->m_vertices, pChainShape->m_count );
+                pClonedShape->m_prevVertex = pChainShape->m_prevVertex;
+                pClonedShape->m_nextVertex = pChainShape->m_nextVertex;
+                pClonedShape->m_hasPrevVertex = pChainShape->m_hasPrevVertex;
+                pClonedShape->m_hasNextVertex = pChainShape->m_hasNextVertex;
+                return pClonedShape;
+            }
+
+        default:
+            AssertFatal( false, "ScenePrefab::cloneShape() - Unsupported collision shape type encountered." );
+            return NULL;
+    }
+}
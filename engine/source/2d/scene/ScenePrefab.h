@@ -0,0 +1,126 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_PREFAB_H_
+#define _SCENE_PREFAB_H_
+
+#ifndef _SIM_OBJECT_H_
+#include "sim/simObject.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef BOX2D_H
+#include "Box2D/Box2D.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Scene;
+class SceneObject;
+class TamlCustomNodes;
+
+//-----------------------------------------------------------------------------
+
+/// A scene prefab is a compiled snapshot of one or more scene objects that can be
+/// instantiated without a Taml read or a field-by-field copy.
+///
+/// Compiling resolves everything that does not change between instances once:
+/// - Plain static fields become raw blocks that are copied directly into each instance.
+/// - Static fields with setters keep their prepared value and resolved field.
+/// - Collision shapes are kept as fixture definitions and created directly on each new body.
+/// - Any remaining custom state (such as behaviors) is kept as Taml custom nodes.
+class ScenePrefab : public SimObject
+{
+private:
+    typedef SimObject Parent;
+
+    struct PrefabBlock
+    {
+        U32                 mOffset;
+        U32                 mSize;
+        U32                 mDataOffset;
+    };
+
+    struct PrefabField
+    {
+        const AbstractClassRep::Field* mpField;
+        S32                 mElement;
+        StringTableEntry    mValue;
+    };
+
+    struct PrefabDynamicField
+    {
+        StringTableEntry    mSlotName;
+        StringTableEntry    mValue;
+    };
+
+    struct PrefabObject
+    {
+        AbstractClassRep*           mpClassRep;
+        Vector2                     mPosition;
+        Vector<PrefabBlock>         mBlocks;
+        Vector<U8>                  mBlockData;
+        Vector<PrefabField>         mFields;
+        Vector<PrefabDynamicField>  mDynamicFields;
+        Vector<b2FixtureDef>        mFixtures;
+        TamlCustomNodes*            mpCustomNodes;
+    };
+
+    typedef Vector<PrefabObject*> typePrefabObjectVector;
+
+    typePrefabObjectVector  mObjects;
+    StringTableEntry        mFile;
+
+private:
+    void                    compileObject( SceneObject* pSceneObject );
+    SceneObject*            instantiateObject( const PrefabObject* pPrefabObject, Scene* pScene, const Vector2& position );
+    static b2Shape*         cloneShape( const b2Shape* pShape );
+
+public:
+    ScenePrefab();
+    virtual ~ScenePrefab();
+
+    static void             initPersistFields();
+
+    /// Compiling.
+    bool                    compile( SimObject* pTemplateObject );
+    bool                    compileFile( const char* pFilename );
+    void                    clear( void );
+    inline U32              getObjectCount( void ) const                { return (U32)mObjects.size(); }
+    inline StringTableEntry getFile( void ) const                       { return mFile; }
+
+    /// Instancing.
+    U32                     instantiate( Scene* pScene, const Vector2& position, Vector<SceneObject*>* pInstances = NULL );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( ScenePrefab );
+
+protected:
+    static bool             setFile( void* obj, const char* data )      { static_cast<ScenePrefab*>(obj)->compileFile( data ); return false; }
+    static const char*      getFile( void* obj, const char* data )      { return static_cast<ScenePrefab*>(obj)->getFile(); }
+    static bool             writeFile( void* obj, StringTableEntry pFieldName ) { return static_cast<ScenePrefab*>(obj)->getFile() != StringTable->EmptyString; }
+};
+
+#endif // _SCENE_PREFAB_H_
@@ -0,0 +1,111 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(ScenePrefab, SimObject)
+
+/*! Compiles the prefab from a template object.
+    The template is either a scene object or an object whose children are scene objects.  The template is not modified and can be deleted afterwards.
+    @param templateObject The template object.
+    @return Whether the prefab was compiled or not.
+*/
+ConsoleMethodWithDocs(ScenePrefab, compile, ConsoleBool, 3, 3, (templateObject))
+{
+    // Find the template object.
+    SimObject* pTemplateObject = Sim::findObject( argv[2] );
+
+    if ( pTemplateObject == NULL )
+    {
+        Con::warnf( "ScenePrefab::compile() - Could not find template object '%s'.", argv[2] );
+        return false;
+    }
+
+    return object->compile( pTemplateObject );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Compiles the prefab from a Taml file.
+    @param filename The Taml file to read the template from.
+    @return Whether the prefab was compiled or not.
+*/
+ConsoleMethodWithDocs(ScenePrefab, compileFile, ConsoleBool, 3, 3, (filename))
+{
+    return object->compileFile( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of scene objects created for each instance of the prefab.
+    @return The number of scene objects created for each instance.
+*/
+ConsoleMethodWithDocs(ScenePrefab, getObjectCount, ConsoleInt, 2, 2, ())
+{
+    return object->getObjectCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Creates an instance of the prefab in the specified scene.
+    @param scene The scene to add the instance to.
+    @param x/y The position added to the position of each object in the prefab.  Defaults to the origin.
+    @return The instance scene objects separated by spaces.
+*/
+ConsoleMethodWithDocs(ScenePrefab, instantiate, ConsoleString, 3, 5, (scene, [x / y]))
+{
+    // Find the scene.
+    Scene* pScene = Sim::findObject<Scene>( argv[2] );
+
+    if ( pScene == NULL )
+    {
+        Con::warnf( "ScenePrefab::instantiate() - Could not find scene '%s'.", argv[2] );
+        return StringTable->EmptyString;
+    }
+
+    // Fetch the position.
+    Vector2 position( 0.0f, 0.0f );
+
+    if ( argc == 4 )
+    {
+        position = Utility::mGetStringElementVector( argv[3] );
+    }
+    else if ( argc == 5 )
+    {
+        position.Set( dAtof(argv[3]), dAtof(argv[4]) );
+    }
+
+    // Create the instance.
+    Vector<SceneObject*> instances;
+    object->instantiate( pScene, position, &instances );
+
+    // Format the instance list.
+    const U32 bufferSize = 12 * instances.size() + 1;
+    char* pBuffer = Con::getReturnBuffer( bufferSize );
+    pBuffer[0] = 0;
+
+    U32 bufferOffset = 0;
+    for ( U32 index = 0; index < (U32)instances.size(); ++index )
+        bufferOffset += dSprintf( pBuffer + bufferOffset, bufferSize - bufferOffset, index == 0 ? "%d" : " %d", instances[index]->getId() );
+
+    return pBuffer;
+}
+
+ConsoleMethodGroupEndWithDocs(ScenePrefab)
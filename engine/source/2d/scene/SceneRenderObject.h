@@ -53,6 +53,10 @@ public:
 
     virtual bool shouldRender( void ) const = 0;
 
+    /// Whether sceneRender() can record into a batch renderer away from the main thread.
+    /// This requires that rendering only reads state which was finalized when the render was prepared.
+    virtual bool canRenderConcurrently( void ) const { return false; }
+
     virtual void scenePrepareRender(const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) = 0;
 
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) = 0;
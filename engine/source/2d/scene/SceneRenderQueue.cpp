@@ -81,168 +81,236 @@ const char* SceneRenderQueue::getRenderSortDescription( const RenderSort& sortMo
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredNewFrontSort(const void* a, const void* b)
+void SceneRenderQueue::sort( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Batching means we don't need strict order.
+    if ( mSortMode == RENDER_SORT_BATCH )
+        mStrictOrderMode = false;
 
-    // Use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-    
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredOldFrontSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Use reverse serial Id,
-    return pSceneRenderRequestB->mSerialId - pSceneRenderRequestA->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
+    // Fetch the request count.
+    const U32 requestCount = (U32)mRenderRequests.size();
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredDepthSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    // Finish if there's nothing to sort.
+    if ( requestCount < 2 || mSortMode == RENDER_SORT_OFF || mSortMode == RENDER_SORT_INVALID )
+        return;
 
-    return depthA < depthB ? 1 : depthA > depthB ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_Sort);
 
-//-----------------------------------------------------------------------------
+    // Size the sort buffers.  These are retained so are only ever reallocated if the request count grows.
+    mSortItems.setSize( requestCount );
+    mSortScratch.setSize( requestCount );
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseDepthSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    SortItem* pSortItems = mSortItems.address();
+    SceneRenderRequest** ppSceneRenderRequests = mRenderRequests.address();
 
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    // Generate the sort keys.
+    switch( mSortMode )
+    {
+        case RENDER_SORT_NEWEST:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortNewest);
 
-    return depthA < depthB ? -1 : depthA > depthB ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+                // Lower serial Ids first.
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    pSortItems[index].mKey = getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_OLDEST:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortOldest);
+
+                // Higher serial Ids first.
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    pSortItems[index].mKey = ~getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_BATCH:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortBatch);
+
+                // Batch isolated objects first then lower serial Ids first.
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    const U32 batchKey = pSceneRenderRequest->mpSceneRenderObject->getBatchIsolated() ? 0 : 1;
+                    pSortItems[index].mKey = getSortKey( batchKey, getSerialSortKey( pSceneRenderRequest->mSerialId ) );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_GROUP:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortGroup);
+
+                // Lower serial Ids first.
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    pSortItems[index].mKey = getSerialSortKey( pSceneRenderRequest->mSerialId );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+
+                // The render group address doesn't fit alongside the serial Id so sort by serial Id first.
+                // The stable sort by render group (address, arbitrary but static) that follows then keeps the serial Id order within each group.
+                pSortItems = radixSort( pSortItems, mSortScratch.address(), requestCount );
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    pSortItems[index].mKey = (U64)(size_t)pSortItems[index].mpSceneRenderRequest->mRenderGroup;
+                }
+                break;
+            }
+
+        case RENDER_SORT_XAXIS:
+        case RENDER_SORT_INVERSE_XAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
+
+                // Lower (or higher when inverse) x values first then lower serial Ids first.
+                const U32 axisKeyMask = mSortMode == RENDER_SORT_INVERSE_XAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    const F32 x = pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x;
+                    pSortItems[index].mKey = getSortKey( getFloatSortKey( x ) ^ axisKeyMask, getSerialSortKey( pSceneRenderRequest->mSerialId ) );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_YAXIS:
+        case RENDER_SORT_INVERSE_YAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
+
+                // Lower (or higher when inverse) y values first then lower serial Ids first.
+                const U32 axisKeyMask = mSortMode == RENDER_SORT_INVERSE_YAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    const F32 y = pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y;
+                    pSortItems[index].mKey = getSortKey( getFloatSortKey( y ) ^ axisKeyMask, getSerialSortKey( pSceneRenderRequest->mSerialId ) );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_ZAXIS:
+        case RENDER_SORT_INVERSE_ZAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
+
+                // Higher (or lower when inverse) depths first then lower serial Ids first.
+                const U32 depthKeyMask = mSortMode == RENDER_SORT_ZAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 index = 0; index < requestCount; ++index )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[index];
+                    pSortItems[index].mKey = getSortKey( getFloatSortKey( pSceneRenderRequest->mDepth ) ^ depthKeyMask, getSerialSortKey( pSceneRenderRequest->mSerialId ) );
+                    pSortItems[index].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        default:
+            return;
+    };
+
+    // Sort the keys.
+    pSortItems = radixSort( pSortItems, pSortItems == mSortItems.address() ? mSortScratch.address() : mSortItems.address(), requestCount );
+
+    // Fetch the sorted requests.
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        ppSceneRenderRequests[index] = pSortItems[index].mpSceneRenderRequest;
+    }
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layerBatchOrderSort(const void* a, const void* b)
+SceneRenderQueue::SortItem* SceneRenderQueue::radixSort( SortItem* pItems, SortItem* pScratch, const U32 count )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_RadixSort);
 
-    // Fetch scene render objects.
-    SceneRenderObject* pSceneRenderObjectA = pSceneRenderRequestA->mpSceneRenderObject;
-    SceneRenderObject* pSceneRenderObjectB = pSceneRenderRequestB->mpSceneRenderObject;
-
-    // Fetch batch render isolation.
-    const bool renderIsolatedA = pSceneRenderObjectA->getBatchIsolated();
-    const bool renderIsolatedB = pSceneRenderObjectB->getBatchIsolated();
-
-    // A not render isolated?
-    if ( !renderIsolatedA )
+    // Use an insertion sort for small counts.
+    if ( count <= 32 )
     {
-        // Use the serial Id if neither are render isolated.
-        if ( !renderIsolatedB )
-            return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-
-        // A not render isolated but B is.
-        return 1;
+        for ( U32 index = 1; index < count; ++index )
+        {
+            const SortItem item = pItems[index];
+            U32 insertIndex = index;
+            while( insertIndex > 0 && pItems[insertIndex-1].mKey > item.mKey )
+            {
+                pItems[insertIndex] = pItems[insertIndex-1];
+                --insertIndex;
+            }
+            pItems[insertIndex] = item;
+        }
+
+        return pItems;
     }
 
-    // B not render isolated?
-    if ( !renderIsolatedB )
+    // Histogram all the key bytes in a single pass.
+    U32 histograms[8][256];
+    dMemset( histograms, 0, sizeof(histograms) );
+    for ( U32 index = 0; index < count; ++index )
     {
-        // A is render isolated.
-        return -1;
+        const U64 key = pItems[index].mKey;
+        for ( U32 pass = 0; pass < 8; ++pass )
+        {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
     }
 
-    // A and B are render isolated so use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layerGroupOrderSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch the groups.
-    StringTableEntry renderGroupA = pSceneRenderRequestA->mRenderGroup;
-    StringTableEntry renderGroupB = pSceneRenderRequestB->mRenderGroup;
-
-    // Sort by render group (address, arbitrary but static) and use age if render groups are identical.
-    return renderGroupA == renderGroupB ? pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId : renderGroupA < renderGroupB ? -1 : 1;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredXSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
-
-    // We sort lower x values before higher values.
-    return x1 < x2 ? -1 : x1 > x2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredYSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
-
-    // We sort lower y values before higher values.
-    return y1 < y2 ? -1 : y1 > y2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseXSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
-
-    // We sort higher x values before lower values.
-    return x1 < x2 ? 1 : x1 > x2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseYSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    // Sort each key byte, least significant first.
+    for ( U32 pass = 0; pass < 8; ++pass )
+    {
+        U32* pHistogram = histograms[pass];
+        const U32 shift = pass * 8;
+
+        // Skip the pass if all the keys share the same byte.
+        if ( pHistogram[(pItems[0].mKey >> shift) & 0xFF] == count )
+            continue;
+
+        // Convert the histogram into bucket offsets.
+        U32 offset = 0;
+        for ( U32 bucket = 0; bucket < 256; ++bucket )
+        {
+            const U32 bucketCount = pHistogram[bucket];
+            pHistogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        // Scatter the items into the buckets, preserving their existing order.
+        for ( U32 index = 0; index < count; ++index )
+        {
+            const SortItem& item = pItems[index];
+            pScratch[pHistogram[(item.mKey >> shift) & 0xFF]++] = item;
+        }
+
+        // Swap the buffers.
+        SortItem* pSorted = pScratch;
+        pScratch = pItems;
+        pItems = pSorted;
+    }
 
-    // We sort higher y values before lower values.
-    return y1 < y2 ? 1 : y1 > y2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    return pItems;
 }
@@ -57,23 +57,41 @@ public:
 
 private: 
     typeRenderRequestVector mRenderRequests;
+    FactoryCache<SceneRenderRequest>* mpRenderRequestFactory;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
 
+    /// Sorting.
+    struct SortItem
+    {
+        U64                 mKey;
+        SceneRenderRequest* mpSceneRenderRequest;
+    };
+    typedef Vector<SortItem> typeSortItemVector;
+
+    typeSortItemVector      mSortItems;
+    typeSortItemVector      mSortScratch;
+
 private:
-    static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredOldFrontSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredDepthSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseDepthSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layerBatchOrderSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layerGroupOrderSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredXSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredYSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseXSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseYSortPointSort(const void* a, const void* b);
+    static SortItem* radixSort( SortItem* pItems, SortItem* pScratch, const U32 count );
+
+    static inline U64 getSortKey( const U32 primaryKey, const U32 secondaryKey ) { return ((U64)primaryKey << 32) | (U64)secondaryKey; }
+
+    static inline U32 getSerialSortKey( const S32 serialId ) { return (U32)serialId ^ 0x80000000; }
+
+    static inline U32 getFloatSortKey( const F32 value )
+    {
+        // Treat negative zero as positive zero.
+        union { F32 mFloat; U32 mBits; } floatBits;
+        floatBits.mFloat = value + 0.0f;
+
+        // Flip the bits so that the unsigned integer order matches the float order.
+        return (floatBits.mBits & 0x80000000) ? ~floatBits.mBits : floatBits.mBits | 0x80000000;
+    }
 
 public:
-    SceneRenderQueue()
+    SceneRenderQueue() :
+        mpRenderRequestFactory( &SceneRenderRequestFactory )
     {
         resetState();
     }
@@ -90,7 +108,7 @@ public:
         // Cache request.
         for( typeRenderRequestVector::iterator itr = mRenderRequests.begin(); itr != mRenderRequests.end(); ++itr )
         {
-            SceneRenderRequestFactory.cacheObject( *itr );
+            mpRenderRequestFactory->cacheObject( *itr );
         }
         mRenderRequests.clear();
 
@@ -107,7 +125,7 @@ public:
         PROFILE_SCOPE(SceneRenderQueue_CreateRenderRequest);
 
         // Create scene render request.
-        SceneRenderRequest* pSceneRenderRequest = SceneRenderRequestFactory.createObject();
+        SceneRenderRequest* pSceneRenderRequest = mpRenderRequestFactory->createObject();
 
         // Queue render request.
         mRenderRequests.push_back( pSceneRenderRequest );
@@ -117,119 +135,24 @@ public:
 
     inline typeRenderRequestVector& getRenderRequests( void ) { return mRenderRequests; }
 
+    /// Set the factory render requests are created from and cached to.
+    /// A private factory allows a queue to be filled on a worker thread.
+    inline void setRenderRequestFactory( FactoryCache<SceneRenderRequest>* pRenderRequestFactory ) { mpRenderRequestFactory = pRenderRequestFactory; }
+    inline FactoryCache<SceneRenderRequest>* getRenderRequestFactory( void ) const { return mpRenderRequestFactory; }
+
+    /// Forget the render requests without caching them.
+    /// This is used once the requests have been handed to another queue which then owns them.
+    inline void detachRenderRequests( void ) { mRenderRequests.clear(); }
+
     inline void setSortMode( RenderSort sortMode ) { mSortMode = sortMode; }
     inline RenderSort getSortMode( void ) const { return mSortMode; }
 
     inline void setStrictOrderMode( const bool strictOrderMode ) { mStrictOrderMode = strictOrderMode; }
     inline bool getStrictOrderMode( void ) const { return mStrictOrderMode; }
 
-    void sort( void )
-    {
-        // Sort layer appropriately.
-        switch( mSortMode )
-        {
-            case RENDER_SORT_NEWEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortNewest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_OLDEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortOldest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_BATCH:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortBatch);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
-
-                    // Batching means we don't need strict order.
-                    mStrictOrderMode = false;
-                    return;
-                }
-
-            case RENDER_SORT_GROUP:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortGroup);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
-                    return;
-                }
-
-            case RENDER_SORT_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
-                    return;
-                }
-
-            case RENDER_SORT_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_OFF:
-                {
-                    return;
-                }
-
-            default:
-                break;
-        };
-    }
+    /// Sort the render requests using the current sort mode.
+    /// Each request is given a packed 64-bit key which is then sorted with a stable radix sort.
+    void sort( void );
 
     static RenderSort getRenderSortEnum(const char* label);
     static const char* getRenderSortDescription( const RenderSort& sortMode );
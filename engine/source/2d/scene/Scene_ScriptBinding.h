@@ -3589,4 +3589,81 @@ ConsoleMethodWithDocs(Scene, create, ConsoleString, 3, 3, (type))
     return pSceneObject == NULL ? NULL : pSceneObject->getIdString();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the budget used to destroy safe-deleted objects.
+    When the budget is non-zero, safe-deleted objects are hidden and disabled immediately but their destruction is spread across subsequent ticks, destroying at most the budget each tick.
+    @param count The maximum number of objects destroyed per tick.  Zero destroys safe-deleted objects immediately (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setDeleteBudget, ConsoleVoid, 3, 3, (count))
+{
+    object->setDeleteBudget( (U32)getMax( dAtoi(argv[2]), 0 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the budget used to destroy safe-deleted objects.
+    @return The maximum number of objects destroyed per tick.
+*/
+ConsoleMethodWithDocs(Scene, getDeleteBudget, ConsoleInt, 2, 2, ())
+{
+    return object->getDeleteBudget();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of safe-deleted objects waiting to be destroyed.
+    @return The number of safe-deleted objects waiting to be destroyed.
+*/
+ConsoleMethodWithDocs(Scene, getRetiredCount, ConsoleInt, 2, 2, ())
+{
+    return object->getRetiredCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the maximum number of safe-deleted objects of the specified type that are kept for reuse.
+    Objects kept for reuse are returned by "create()" in place of new objects.  They are removed from the scene, have their pending events cancelled, their velocities and lifetime reset and their name and dynamic fields cleared.  They are given a new id so references to the deleted object are not reused but otherwise keep their configuration, including whether they were enabled and visible.
+    @param type The scene-object derived type.
+    @param limit The maximum number of objects kept for reuse.  Zero disables reuse (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setRecycleLimit, ConsoleVoid, 4, 4, (type, limit))
+{
+    object->setRecycleLimit( argv[2], (U32)getMax( dAtoi(argv[3]), 0 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the maximum number of safe-deleted objects of the specified type that are kept for reuse.
+    @param type The scene-object derived type.
+    @return The maximum number of objects kept for reuse.
+*/
+ConsoleMethodWithDocs(Scene, getRecycleLimit, ConsoleInt, 3, 3, (type))
+{
+    return object->getRecycleLimit( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of objects of the specified type currently kept for reuse.
+    @param type The scene-object derived type.
+    @return The number of objects kept for reuse.
+*/
+ConsoleMethodWithDocs(Scene, getRecycleCount, ConsoleInt, 3, 3, (type))
+{
+    return object->getRecycleCount( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Deletes all the objects kept for reuse.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, clearRecyclePools, ConsoleVoid, 2, 2, ())
+{
+    object->clearRecyclePools();
+}
+
 ConsoleMethodGroupEndWithDocs(Scene)
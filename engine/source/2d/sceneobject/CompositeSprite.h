@@ -65,8 +65,11 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool canTickPassive( void ) const { return false; }
 
     virtual bool canPrepareRender( void ) const { return true; }
+    virtual bool canPrepareRenderConcurrently( void ) const { return true; }
+    virtual bool canRenderConcurrently( void ) const { return true; }
     virtual bool shouldRender( void ) const { return true; }
     virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );    
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
@@ -104,6 +107,8 @@ protected:
     static bool         writeBatchLayout( void* obj, StringTableEntry pFieldName )          { return static_cast<CompositeSprite*>(obj)->getBatchLayout() != CompositeSprite::NO_LAYOUT; }
     static bool         setBatchCulling(void* obj, const char* data)                        { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCulling(dAtob(data)); return false; }
     static bool         writeBatchCulling( void* obj, StringTableEntry pFieldName )         { return !static_cast<CompositeSprite*>(obj)->getBatchCulling(); }
+    static bool         setBatchChunkSize(void* obj, const char* data)                      { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchChunkSize(dAtof(data)); return false; }
+    static bool         writeBatchChunkSize( void* obj, StringTableEntry pFieldName )       { return static_cast<CompositeSprite*>(obj)->getBatchChunkSize() > 0.0f; }
 };
 
 #endif // _COMPOSITE_SPRITE_H_
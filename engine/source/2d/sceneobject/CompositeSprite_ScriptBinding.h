@@ -151,6 +151,32 @@ ConsoleMethodWithDocs(CompositeSprite, getBatchCulling, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the size of the chunks the sprites are grouped into.
+    Each chunk is culled and rendered as a whole which is considerably faster for very large tile-maps.
+    Sprites within a chunk are not sorted and a size of zero turns chunking off.
+    @param chunkSize The local size of each square chunk.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchChunkSize, ConsoleVoid, 3, 3, (float chunkSize))
+{
+    // Fetch batch chunk size.
+    const F32 chunkSize = dAtof(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchChunkSize( chunkSize );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the size of the chunks the sprites are grouped into.
+    @return The local size of each square chunk or zero if chunking is off.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunkSize, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchChunkSize();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the batch render sort mode.
     The render sort mode is used when isolated batch mode is on.
     @return No return value.
@@ -129,6 +129,10 @@ SceneObject::SceneObject() :
     mRenderAngle( 0.0f ),
     mSpatialDirty( true ),
 
+    /// Tick activity.
+    mTickIndex( -1 ),
+    mTickPassive( false ),
+
     /// Body.
     mpBody(NULL),
     mWorldQueryKey(0),
@@ -319,7 +323,7 @@ void SceneObject::initPersistFields()
     addField("PickingAllowed", TypeBool, Offset(mPickingAllowed, SceneObject), &writePickingAllowed, "");
 
     // Script callbacks.
-    addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &writeUpdateCallback, "");
+    addProtectedField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &setUpdateCallback, &defaultProtectedGetFn, &writeUpdateCallback, "");
     addField("CollisionCallback", TypeBool, Offset(mCollisionCallback, SceneObject), &writeCollisionCallback, "");
     addField("SleepingCallback", TypeBool, Offset(mSleepingCallback, SceneObject), &writeSleepingCallback, "");
 
@@ -536,6 +540,9 @@ void SceneObject::resetTickSpatials( const bool resize )
 
     // Flag spatial changed.
     mSpatialDirty = true;
+
+    // Make sure the change is ticked.
+    activateTick();
 }
 
 //-----------------------------------------------------------------------------
@@ -658,6 +665,22 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::canTickPassive( void ) const
+{
+    // Not if the spatials are still changing.
+    if ( mSpatialDirty )
+        return false;
+
+    // Not if the body can still move.
+    if ( mpBody->GetType() != b2_staticBody && mpBody->IsAwake() )
+        return false;
+
+    // Not if anything needs updating each tick.
+    return !mLifetimeActive && !mUpdateCallback && mpAttachedGui == NULL && mpAttachedCamera == NULL && !hasComponents();
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::interpolateObject( const F32 timeDelta )
 {
     // Debug Profiling.
@@ -831,6 +854,10 @@ void SceneObject::setEnabled( const bool enabled )
     {
         mpBody->SetActive( enabled );
     }
+
+    // Make sure we're ticked if enabled.
+    if ( enabled )
+        activateTick();
 }
 
 //-----------------------------------------------------------------------------
@@ -848,6 +875,9 @@ void SceneObject::setLifetime( const F32 lifetime )
     {
         // Yes, so set to incoming lifetime.
         mLifetime = lifetime;
+
+        // Make sure the lifetime is ticked.
+        activateTick();
     }
     else
     {
@@ -2674,6 +2704,9 @@ void SceneObject::attachGui( GuiControl* pGuiControl, SceneWindow* pSceneWindow,
     // Attach SceneWindow.
     mpAttachedGuiSceneWindow = pSceneWindow;
 
+    // Make sure the attached GUI is updated.
+    activateTick();
+
     // Set Size Gui Flag.
     mAttachedGuiSizeControl = sizeControl;
 
@@ -3260,6 +3293,20 @@ void SceneObject::notifyComponentsRemoveFromScene( void )
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::addComponent( SimComponent* pComponent )
+{
+    // Call parent.
+    if ( !Parent::addComponent( pComponent ) )
+        return false;
+
+    // Components are updated each tick.
+    activateTick();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::notifyComponentsUpdate( void )
 {
     // Debug Profiling.
@@ -111,6 +111,7 @@ public:
     friend class DebugDraw;
     friend class SceneObjectMoveToEvent;
     friend class SceneObjectRotateToEvent;
+    friend class ScenePrefab;
 
 protected:
     /// Scene.
@@ -152,6 +153,10 @@ protected:
     F32                     mRenderAngle;
     bool                    mSpatialDirty;
 
+    /// Tick activity.
+    S32                     mTickIndex;
+    bool                    mTickPassive;
+
     /// Body.
     b2Body*                 mpBody;
     b2BodyDef               mBodyDefinition;
@@ -256,6 +261,12 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Tick activity.
+    virtual bool            canTickPassive( void ) const;
+    inline bool             getTickPassive( void ) const                { return mTickPassive; }
+    inline S32              getTickIndex( void ) const                  { return mTickIndex; }
+    inline void             activateTick( void )                        { if ( mTickPassive && mpScene ) mpScene->activateSceneObject( this ); }
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -266,6 +277,7 @@ public:
     
     /// Render Output.
     virtual bool            canPrepareRender( void ) const { return false; }
+    virtual bool            canPrepareRenderConcurrently( void ) const { return false; }
     virtual void            scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) {}
     virtual void            sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
     virtual void            sceneRenderFallback( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
@@ -506,7 +518,7 @@ public:
     virtual void            onInputEvent( StringTableEntry name, const GuiEvent& event, const Vector2& worldMousePoint );
 
     // Script callbacks.
-    inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; }
+    inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; if ( status ) activateTick(); }
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setCollisionCallback( const bool status )   { mCollisionCallback = status; }
     inline bool             getCollisionCallback(void) const            { return mCollisionCallback; }
@@ -519,7 +531,7 @@ public:
     inline U32              getDebugMask( void ) const                  { return mDebugMask; }
 
     /// Camera mounting.
-    inline void             addCameraMountReference( SceneWindow* pAttachedCamera ) { mpAttachedCamera = pAttachedCamera; }
+    inline void             addCameraMountReference( SceneWindow* pAttachedCamera ) { mpAttachedCamera = pAttachedCamera; activateTick(); }
     inline void             removeCameraMountReference( void )          { mpAttachedCamera = NULL; }
     inline void             dismountCamera( void )                      { if ( mpAttachedCamera ) mpAttachedCamera->dismountMe( this ); }
 
@@ -549,6 +561,7 @@ public:
     void                    processDestroyNotifications( void );
 
     /// Component notifications.
+    virtual bool            addComponent( SimComponent* pComponent );
     void                    notifyComponentsAddToScene( void );
     void                    notifyComponentsRemoveFromScene( void );
     void                    notifyComponentsUpdate( void );
@@ -706,6 +719,7 @@ protected:
     static bool             writePickingAllowed( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getPickingAllowed() == false; }    
 
     /// Script callbacks.
+    static bool             setUpdateCallback(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setUpdateCallback(dAtob(data)); return false; }
     static bool             writeUpdateCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getUpdateCallback() == true; }
     static bool             writeCollisionCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getCollisionCallback() == true; }
     static bool             writeSleepingCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSleepingCallback() == true; }
@@ -440,6 +440,14 @@ void b2Body::SetTransform(const b2Vec2& position, float32 angle)
 	m_world->m_contactManager.FindNewContacts();
 }
 
+void b2Body::Awoken()
+{
+	if (m_world->m_wakeListener)
+	{
+		m_world->m_wakeListener->BodyAwoken(this);
+	}
+}
+
 void b2Body::SynchronizeFixtures()
 {
 	b2Transform xf1;
@@ -421,6 +421,9 @@ private:
 	void SynchronizeFixtures();
 	void SynchronizeTransform();
 
+	// Notify the world wake listener that this body was woken.
+	void Awoken();
+
 	// This is used to prevent connected bodies from colliding.
 	// It may lie, depending on the collideConnected flag.
 	bool ShouldCollide(const b2Body* other) const;
@@ -638,6 +641,7 @@ inline void b2Body::SetAwake(bool flag)
 		{
 			m_flags |= e_awakeFlag;
 			m_sleepTime = 0.0f;
+			Awoken();
 		}
 	}
 	else
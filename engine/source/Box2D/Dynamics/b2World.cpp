@@ -37,6 +37,7 @@
 b2World::b2World(const b2Vec2& gravity)
 {
 	m_destructionListener = NULL;
+	m_wakeListener = NULL;
 	m_debugDraw = NULL;
 
 	m_bodyList = NULL;
@@ -94,6 +95,11 @@ void b2World::SetContactFilter(b2ContactFilter* filter)
 	m_contactManager.m_contactFilter = filter;
 }
 
+void b2World::SetWakeListener(b2WakeListener* listener)
+{
+	m_wakeListener = listener;
+}
+
 void b2World::SetContactListener(b2ContactListener* listener)
 {
 	m_contactManager.m_contactListener = listener;
@@ -52,6 +52,10 @@ public:
 	/// remain in scope.
 	void SetDestructionListener(b2DestructionListener* listener);
 
+	/// Register a wake listener. The listener is owned by you and must
+	/// remain in scope.
+	void SetWakeListener(b2WakeListener* listener);
+
 	/// Register a contact filter to provide specific control over collision.
 	/// Otherwise the default filter is used (b2_defaultFilter). The listener is
 	/// owned by you and must remain in scope. 
@@ -247,6 +251,7 @@ private:
 	bool m_allowSleep;
 
 	b2DestructionListener* m_destructionListener;
+	b2WakeListener* m_wakeListener;
 	b2Draw* m_debugDraw;
 
 	// This is used to compute the time step ratio to
@@ -47,6 +47,18 @@ public:
 	virtual void SayGoodbye(b2Fixture* fixture) = 0;
 };
 
+/// Implement this listener to be notified when a sleeping body is woken,
+/// either by the world during a time step or by a call on the body.
+/// @warning You cannot create/destroy Box2D entities inside this callback.
+class b2WakeListener
+{
+public:
+	virtual ~b2WakeListener() {}
+
+	/// Called when a body transitions from asleep to awake.
+	virtual void BodyAwoken(b2Body* body) = 0;
+};
+
 /// Implement this class to provide collision filtering. In other words, you can implement
 /// this class if you want finer control over contact creation.
 class b2ContactFilter
@@ -54,6 +54,17 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _TAML_XMLPARSER_H_
+#include "persistence/taml/xml/tamlXmlParser.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_WORKERPOOL_H_
+#include "platform/threads/workerPool.h"
+#endif
+
+// Miscellaneous.
+#include "memory/safeDelete.h"
+
 // Script bindings.
 #include "assetManager_ScriptBinding.h"
 
@@ -76,7 +87,10 @@ AssetManager::AssetManager() :
     mMaxLoadedPrivateAssetsCount( 0 ),
     mAcquiredReferenceCount( 0 ),
     mEchoInfo( false ),
-    mIgnoreAutoUnload( false )
+    mIgnoreAutoUnload( false ),
+    mScanCacheEnabled( true ),
+    mScanCacheLoaded( false ),
+    mScanCacheFile( StringTable->EmptyString )
 {
 }
 
@@ -95,6 +109,14 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Save the declared asset scan cache if it has changed.
+    if ( mScanCacheEnabled && mScanCache.getDirty() )
+        mScanCache.save( getScanCacheFilePath() );
+
+    // Clear the declared asset scan cache.
+    mScanCache.clear();
+    mScanCacheLoaded = false;
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -115,6 +137,8 @@ void AssetManager::initPersistFields()
 
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, AssetManager), "Whether the asset manager echos extra information to the console or not." );
     addField( "IgnoreAutoUnload", TypeBool, Offset(mIgnoreAutoUnload, AssetManager), "Whether the asset manager should ignore unloading of auto-unload assets or not." );
+    addField( "ScanCache", TypeBool, Offset(mScanCacheEnabled, AssetManager), "Whether the asset manager caches the scans of declared asset files between launches or not." );
+    addField( "ScanCacheFile", TypeString, Offset(mScanCacheFile, AssetManager), "The file used to cache the scans of declared asset files.  Uses the preferences path if not specified." );
 }
 
 //-----------------------------------------------------------------------------
@@ -2306,6 +2330,67 @@ S32 AssetManager::findAssetLooseFile( AssetQuery* pAssetQuery, const char* pLoos
 
 //-----------------------------------------------------------------------------
 
+struct DeclaredAssetFile
+{
+    StringTableEntry    mFilePath;
+    U32                 mFileSize;
+    FileTime            mModifyTime;
+    bool                mHasModifyTime;
+    bool                mCached;
+    bool                mXmlFormat;
+    bool                mDocumentLoaded;
+    TamlXmlDocument*    mpDocument;
+};
+
+static const U32 DeclaredAssetPreloadBatchSize = 256;
+
+//-----------------------------------------------------------------------------
+
+static void preloadDeclaredAssetFile( void* pContext, const U32 index )
+{
+    // Fetch asset file.
+    DeclaredAssetFile* pAssetFile = ((DeclaredAssetFile**)pContext)[index];
+
+    FileStream stream;
+
+    // Load the document if the file opens.
+    // NOTE: This is called on a worker thread so it must not use the console.
+    if ( stream.open( pAssetFile->mFilePath, FileStream::Read ) )
+    {
+        pAssetFile->mDocumentLoaded = pAssetFile->mpDocument->load( stream );
+        stream.close();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void preloadDeclaredAssetFiles( Vector<DeclaredAssetFile>& assetFiles, const U32 batchStart )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_PreloadDeclaredAssetFiles);
+
+    // Fetch the batch end.
+    const U32 batchEnd = getMin( batchStart + DeclaredAssetPreloadBatchSize, (U32)assetFiles.size() );
+
+    // Create documents for the uncached XML files in the batch.
+    Vector<DeclaredAssetFile*> preloadFiles;
+    for ( U32 fileIndex = batchStart; fileIndex < batchEnd; ++fileIndex )
+    {
+        DeclaredAssetFile& assetFile = assetFiles[fileIndex];
+
+        if ( assetFile.mCached || !assetFile.mXmlFormat )
+            continue;
+
+        assetFile.mpDocument = new TamlXmlDocument();
+        preloadFiles.push_back( &assetFile );
+    }
+
+    // Load the documents.
+    WorkerPool::process( preloadDeclaredAssetFile, preloadFiles.address(), preloadFiles.size() );
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition )
 {
     // Debug Profiling.
@@ -2351,7 +2436,15 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
     // Fetch module assets.
     ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
 
-    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+    // Load the scan cache if needed.
+    if ( mScanCacheEnabled && !mScanCacheLoaded )
+    {
+        mScanCache.load( getScanCacheFilePath() );
+        mScanCacheLoaded = true;
+    }
+
+    Vector<DeclaredAssetFile> assetFiles;
+    assetFiles.reserve( files.size() );
 
     // Iterate files.
     for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
@@ -2373,21 +2466,71 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         if ( dStricmp( pFilename + filenameLength - extensionLength, pExtension ) != 0 )
             continue;
 
-        // Clear declared assets.
-        assetDeclaredVisitor.clear();
-
         // Format full file-path.
         char assetFileBuffer[1024];
+        char assetFilePathBuffer[1024];
         dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
+        Con::expandPath( assetFilePathBuffer, sizeof(assetFilePathBuffer), assetFileBuffer );
 
-        // Parse the filename.
-        if ( !mTaml.parse( assetFileBuffer, assetDeclaredVisitor ) )
+#ifdef TORQUE_OS_ANDROID
+        if ( dStrlen( assetFileBuffer ) > dStrlen( assetFilePathBuffer ) )
+            dStrcpy( assetFilePathBuffer, assetFileBuffer );
+#endif
+
+        // Add asset file.
+        assetFiles.increment();
+        DeclaredAssetFile& assetFile = assetFiles.last();
+        assetFile.mFilePath = StringTable->insert( assetFilePathBuffer );
+        assetFile.mFileSize = fileInfo.fileSize;
+        assetFile.mXmlFormat = mTaml.getFileAutoFormatMode( assetFilePathBuffer ) == Taml::XmlFormat;
+        assetFile.mpDocument = NULL;
+        assetFile.mDocumentLoaded = false;
+
+        // Is the file scan cached?
+        assetFile.mHasModifyTime = mScanCacheEnabled && Platform::getFileTimes( assetFilePathBuffer, NULL, &assetFile.mModifyTime );
+        assetFile.mCached = assetFile.mHasModifyTime && mScanCache.isValid( assetFile.mFilePath, assetFile.mModifyTime, assetFile.mFileSize );
+    }
+
+    TamlXmlParser xmlParser;
+    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+
+    // Iterate asset files.
+    for ( U32 fileIndex = 0; fileIndex < (U32)assetFiles.size(); ++fileIndex )
+    {
+        // Preload the next batch of asset files on the worker pool if needed.
+        if ( fileIndex % DeclaredAssetPreloadBatchSize == 0 )
+            preloadDeclaredAssetFiles( assetFiles, fileIndex );
+
+        // Fetch asset file.
+        DeclaredAssetFile& assetFile = assetFiles[fileIndex];
+
+        // Clear declared assets.
+        assetDeclaredVisitor.clear();
+
+        // Restore the cached scan or parse the file.
+        bool parsed;
+        if ( assetFile.mCached )
+            parsed = mScanCache.restore( assetFile.mFilePath, assetFile.mModifyTime, assetFile.mFileSize, assetDeclaredVisitor );
+        else if ( assetFile.mDocumentLoaded )
+            parsed = xmlParser.accept( assetFile.mFilePath, *assetFile.mpDocument, assetDeclaredVisitor );
+        else
+            parsed = mTaml.parse( assetFile.mFilePath, assetDeclaredVisitor );
+
+        // Release any preloaded document.
+        SAFE_DELETE( assetFile.mpDocument );
+
+        // Did we parse the file?
+        if ( !parsed )
         {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
+            // No, so warn.
+            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFile.mFilePath );
             continue;
         }
 
+        // Update the scan cache.
+        if ( !assetFile.mCached && assetFile.mHasModifyTime )
+            mScanCache.store( assetFile.mFilePath, assetFile.mModifyTime, assetFile.mFileSize, assetDeclaredVisitor );
+
         // Fetch asset definition.
         AssetDefinition& foundAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
 
@@ -2395,7 +2538,7 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         if ( foundAssetDefinition.mAssetName == StringTable->EmptyString )
         {
             // No, so warn.
-            Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", assetFileBuffer );
+            Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", assetFile.mFilePath );
             continue;
         }
 
@@ -2510,6 +2653,23 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
 
 //-----------------------------------------------------------------------------
 
+const char* AssetManager::getScanCacheFilePath( void )
+{
+    // Use the specified file if available.
+    if ( mScanCacheFile != StringTable->EmptyString )
+    {
+        // Expand the file-path.
+        char filePathBuffer[1024];
+        Con::expandPath( filePathBuffer, sizeof(filePathBuffer), mScanCacheFile );
+        return StringTable->insert( filePathBuffer );
+    }
+
+    // Use the preferences path.
+    return Platform::getPrefsPath( "assetScanCache.bin" );
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse )
 {
     // Debug Profiling.
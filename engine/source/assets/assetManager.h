@@ -59,6 +59,10 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _ASSET_SCAN_CACHE_H_
+#include "assets/assetScanCache.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -111,6 +115,12 @@ private:
     U32                                 mMaxLoadedPrivateAssetsCount;
     Taml                                mTaml;
 
+    /// Declared asset scan cache.
+    AssetScanCache                      mScanCache;
+    bool                                mScanCacheEnabled;
+    bool                                mScanCacheLoaded;
+    StringTableEntry                    mScanCacheFile;
+
 public:
     AssetManager();
     virtual ~AssetManager() {}
@@ -153,6 +163,9 @@ public:
         // Sanity!
         AssertFatal( pAssetId != NULL, "Cannot acquire NULL asset Id." );
 
+        // Memory Tagging.
+        MemoryTagScope memoryTagScope( MemoryTag_Assets );
+
         // Is this an empty asset Id?
         if ( *pAssetId == 0 )
         {
@@ -373,6 +386,7 @@ public:
 private:
     bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition );
     bool scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse );
+    const char* getScanCacheFilePath( void );
     AssetDefinition* findAsset( const char* pAssetId );
     void addReferencedAsset( StringTableEntry assetId, StringTableEntry referenceFilePath );
     void renameAssetReferences( StringTableEntry assetIdFrom, StringTableEntry assetIdTo );
@@ -0,0 +1,287 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assets/assetScanCache.h"
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+static const U32 ScanCacheSignature = 0x43534154;   // "TASC"
+static const U32 ScanCacheVersion = 1;
+static const U32 ScanCacheMaxStringLength = 4096;
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry readCacheString( Stream& stream )
+{
+    char stringBuffer[ScanCacheMaxStringLength+1];
+    stringBuffer[0] = 0;
+    stream.readLongString( ScanCacheMaxStringLength, stringBuffer );
+    return StringTable->insert( stringBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::load( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetScanCache_Load);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot load asset scan cache with NULL file-path." );
+
+    // Clear any existing entries.
+    clear();
+
+    // Finish if there's no cache file.
+    if ( !Platform::isFile( pCacheFilePath ) )
+        return false;
+
+    FileStream stream;
+
+    // File open for read?
+    if ( !stream.open( pCacheFilePath, FileStream::Read ) )
+        return false;
+
+    // Read the header.
+    U32 signature = 0;
+    U32 version = 0;
+    U32 entryCount = 0;
+    stream.read( &signature );
+    stream.read( &version );
+    stream.read( &entryCount );
+
+    // Finish if the cache is not the current version.
+    if ( stream.getStatus() != Stream::Ok || signature != ScanCacheSignature || version != ScanCacheVersion )
+    {
+        stream.close();
+        return false;
+    }
+
+    // Read the entries.
+    for ( U32 entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+    {
+        Entry* pEntry = new Entry();
+
+        StringTableEntry assetFilePath = readCacheString( stream );
+        stream.read( sizeof(FileTime), &pEntry->mModifyTime );
+        stream.read( &pEntry->mFileSize );
+        pEntry->mAssetName = readCacheString( stream );
+        pEntry->mAssetDescription = readCacheString( stream );
+        pEntry->mAssetCategory = readCacheString( stream );
+        pEntry->mAssetType = readCacheString( stream );
+        stream.read( &pEntry->mAssetAutoUnload );
+        stream.read( &pEntry->mAssetInternal );
+
+        U32 dependencyCount = 0;
+        stream.read( &dependencyCount );
+        for ( U32 index = 0; index < dependencyCount && stream.getStatus() == Stream::Ok; ++index )
+            pEntry->mAssetDependencies.push_back( readCacheString( stream ) );
+
+        U32 looseFileCount = 0;
+        stream.read( &looseFileCount );
+        for ( U32 index = 0; index < looseFileCount && stream.getStatus() == Stream::Ok; ++index )
+            pEntry->mAssetLooseFiles.push_back( readCacheString( stream ) );
+
+        // Is the cache truncated or corrupt?
+        if ( stream.getStatus() != Stream::Ok )
+        {
+            // Yes, so discard it all.
+            delete pEntry;
+            stream.close();
+            clear();
+            return false;
+        }
+
+        // Replace any duplicate.
+        typeEntryHash::iterator entryItr = mEntries.find( assetFilePath );
+        if ( entryItr != mEntries.end() )
+        {
+            delete entryItr->value;
+            entryItr->value = pEntry;
+            continue;
+        }
+
+        mEntries.insert( assetFilePath, pEntry );
+    }
+
+    stream.close();
+
+    // Flag as not dirty.
+    mDirty = false;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::save( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetScanCache_Save);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot save asset scan cache with NULL file-path." );
+
+    FileStream stream;
+
+    // File open for write?
+    if ( !stream.open( pCacheFilePath, FileStream::Write ) )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Scan Cache: Could not open file '%s' for write.", pCacheFilePath );
+        return false;
+    }
+
+    // Write the header.
+    stream.write( ScanCacheSignature );
+    stream.write( ScanCacheVersion );
+    stream.write( (U32)mEntries.size() );
+
+    // Write the entries.
+    for( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+    {
+        const Entry* pEntry = entryItr->value;
+
+        stream.writeLongString( ScanCacheMaxStringLength, entryItr->key );
+        stream.write( sizeof(FileTime), &pEntry->mModifyTime );
+        stream.write( pEntry->mFileSize );
+        stream.writeLongString( ScanCacheMaxStringLength, pEntry->mAssetName );
+        stream.writeLongString( ScanCacheMaxStringLength, pEntry->mAssetDescription );
+        stream.writeLongString( ScanCacheMaxStringLength, pEntry->mAssetCategory );
+        stream.writeLongString( ScanCacheMaxStringLength, pEntry->mAssetType );
+        stream.write( pEntry->mAssetAutoUnload );
+        stream.write( pEntry->mAssetInternal );
+
+        stream.write( (U32)pEntry->mAssetDependencies.size() );
+        for ( U32 index = 0; index < (U32)pEntry->mAssetDependencies.size(); ++index )
+            stream.writeLongString( ScanCacheMaxStringLength, pEntry->mAssetDependencies[index] );
+
+        stream.write( (U32)pEntry->mAssetLooseFiles.size() );
+        for ( U32 index = 0; index < (U32)pEntry->mAssetLooseFiles.size(); ++index )
+            stream.writeLongString( ScanCacheMaxStringLength, pEntry->mAssetLooseFiles[index] );
+    }
+
+    const bool status = stream.getStatus() == Stream::Ok;
+
+    stream.close();
+
+    // Flag as not dirty.
+    if ( status )
+        mDirty = false;
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetScanCache::clear( void )
+{
+    // Delete the entries.
+    for( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+        delete entryItr->value;
+
+    mEntries.clear();
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::isValid( StringTableEntry assetFilePath, const FileTime& modifyTime, const U32 fileSize ) const
+{
+    // Find the entry.
+    typeEntryHash::const_iterator entryItr = mEntries.find( assetFilePath );
+
+    // Finish if not found.
+    if ( entryItr == mEntries.end() )
+        return false;
+
+    // Fetch entry.
+    const Entry* pEntry = entryItr->value;
+
+    // Valid only if the file is unchanged.
+    return pEntry->mFileSize == fileSize && Platform::compareFileTimes( pEntry->mModifyTime, modifyTime ) == 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::restore( StringTableEntry assetFilePath, const FileTime& modifyTime, const U32 fileSize, TamlAssetDeclaredVisitor& visitor ) const
+{
+    // Finish if the file has no valid scan.
+    if ( !isValid( assetFilePath, modifyTime, fileSize ) )
+        return false;
+
+    // Fetch entry.
+    const Entry* pEntry = mEntries.find( assetFilePath )->value;
+
+    // Restore the asset definition.
+    visitor.clear();
+    AssetDefinition& assetDefinition = visitor.getAssetDefinition();
+    assetDefinition.mAssetBaseFilePath = assetFilePath;
+    assetDefinition.mAssetName = pEntry->mAssetName;
+    assetDefinition.mAssetDescription = pEntry->mAssetDescription;
+    assetDefinition.mAssetCategory = pEntry->mAssetCategory;
+    assetDefinition.mAssetType = pEntry->mAssetType;
+    assetDefinition.mAssetAutoUnload = pEntry->mAssetAutoUnload;
+    assetDefinition.mAssetInternal = pEntry->mAssetInternal;
+
+    // Restore the dependencies and loose files.
+    visitor.getAssetDependencies() = pEntry->mAssetDependencies;
+    visitor.getAssetLooseFiles() = pEntry->mAssetLooseFiles;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetScanCache::store( StringTableEntry assetFilePath, const FileTime& modifyTime, const U32 fileSize, TamlAssetDeclaredVisitor& visitor )
+{
+    // Find any existing entry.
+    typeEntryHash::iterator entryItr = mEntries.find( assetFilePath );
+
+    // Fetch or create the entry.
+    Entry* pEntry = entryItr != mEntries.end() ? entryItr->value : mEntries.insert( assetFilePath, new Entry() )->value;
+
+    // Fetch asset definition.
+    const AssetDefinition& assetDefinition = visitor.getAssetDefinition();
+
+    // Store the scan.
+    pEntry->mModifyTime = modifyTime;
+    pEntry->mFileSize = fileSize;
+    pEntry->mAssetName = assetDefinition.mAssetName;
+    pEntry->mAssetDescription = assetDefinition.mAssetDescription;
+    pEntry->mAssetCategory = assetDefinition.mAssetCategory;
+    pEntry->mAssetType = assetDefinition.mAssetType;
+    pEntry->mAssetAutoUnload = assetDefinition.mAssetAutoUnload;
+    pEntry->mAssetInternal = assetDefinition.mAssetInternal;
+    pEntry->mAssetDependencies = visitor.getAssetDependencies();
+    pEntry->mAssetLooseFiles = visitor.getAssetLooseFiles();
+
+    // Flag as dirty.
+    mDirty = true;
+}
@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_SCAN_CACHE_H_
+#define _ASSET_SCAN_CACHE_H_
+
+#ifndef _TAML_ASSET_DECLARED_VISITOR_H_
+#include "assets/tamlAssetDeclaredVisitor.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A persistent cache of the results of parsing declared asset files.
+///
+/// Entries are keyed by the asset file-path and are only valid whilst the file modification
+/// time and size are unchanged so an unchanged file does not need to be parsed again on the
+/// next launch.  The cache is a plain binary file that is simply discarded if its version
+/// does not match.
+class AssetScanCache
+{
+private:
+    struct Entry
+    {
+        FileTime                                        mModifyTime;
+        U32                                             mFileSize;
+        StringTableEntry                                mAssetName;
+        StringTableEntry                                mAssetDescription;
+        StringTableEntry                                mAssetCategory;
+        StringTableEntry                                mAssetType;
+        bool                                            mAssetAutoUnload;
+        bool                                            mAssetInternal;
+        TamlAssetDeclaredVisitor::typeAssetIdVector     mAssetDependencies;
+        TamlAssetDeclaredVisitor::typeLooseFileVector   mAssetLooseFiles;
+    };
+
+    typedef HashMap<StringTableEntry, Entry*> typeEntryHash;
+
+    typeEntryHash   mEntries;
+    bool            mDirty;
+
+public:
+    AssetScanCache() : mDirty( false ) {}
+    ~AssetScanCache() { clear(); }
+
+    /// Load the cache replacing any current entries.
+    bool load( const char* pCacheFilePath );
+
+    /// Save the cache.
+    bool save( const char* pCacheFilePath );
+
+    void clear( void );
+
+    /// Whether the asset file has a cached scan and is unchanged.
+    bool isValid( StringTableEntry assetFilePath, const FileTime& modifyTime, const U32 fileSize ) const;
+
+    /// Restore the cached scan of the asset file into the visitor if the file is unchanged.
+    bool restore( StringTableEntry assetFilePath, const FileTime& modifyTime, const U32 fileSize, TamlAssetDeclaredVisitor& visitor ) const;
+
+    /// Store the scan of the asset file from the visitor.
+    void store( StringTableEntry assetFilePath, const FileTime& modifyTime, const U32 fileSize, TamlAssetDeclaredVisitor& visitor );
+
+    inline U32 getEntryCount( void ) const { return mEntries.size(); }
+    inline bool getDirty( void ) const { return mDirty; }
+};
+
+#endif // _ASSET_SCAN_CACHE_H_
@@ -28,6 +28,7 @@
 #include "game/gameConnection.h"
 #include "io/fileStream.h"
 #include "audio/audioStreamSourceFactory.h"
+#include "audio/audioStreamThread.h"
 
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/SoundEngine.h"
@@ -642,6 +643,8 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    if (!mContext)
       return NULL_AUDIOHANDLE;
 
+   MemoryTagScope memoryTagScope(MemoryTag_Audio);
+
    if( filename == NULL || filename == StringTable->EmptyString )
       return NULL_AUDIOHANDLE;
 
@@ -2123,6 +2126,8 @@ void alxUpdateMaxDistance()
 //--------------------------------------------------------------------------
 void alxUpdate()
 {
+   MemoryTagScope memoryTagScope(MemoryTag_Audio);
+
    //if(mForceMaxDistanceUpdate)
       alxUpdateMaxDistance();
 
@@ -2551,6 +2556,9 @@ void OpenALShutdown()
 {
    alxStopAll();
 
+   // Stop the streaming thread now all the streams are stopped.
+   AudioStreamThread::shutdown();
+
    //if(mInitialized)
    {
       alxEnvironmentDestroy();
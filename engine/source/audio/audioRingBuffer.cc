@@ -0,0 +1,157 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioRingBuffer.h"
+#include "platform/threads/atomic.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+AudioRingBuffer::AudioRingBuffer() :
+    mpBuffer( NULL ),
+    mCapacity( 0 ),
+    mReadPosition( 0 ),
+    mWritePosition( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+AudioRingBuffer::~AudioRingBuffer()
+{
+    free();
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioRingBuffer::allocate( const U32 capacity )
+{
+    // Round the capacity up to a power of two.
+    U32 powerCapacity = 1;
+    while ( powerCapacity < capacity )
+        powerCapacity <<= 1;
+
+    // Reset if the capacity is unchanged.
+    if ( powerCapacity == mCapacity )
+    {
+        reset();
+        return;
+    }
+
+    free();
+
+    mpBuffer = (U8*)dMalloc( powerCapacity );
+    mCapacity = powerCapacity;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioRingBuffer::free( void )
+{
+    if ( mpBuffer != NULL )
+    {
+        dFree( mpBuffer );
+        mpBuffer = NULL;
+    }
+
+    mCapacity = 0;
+    reset();
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioRingBuffer::reset( void )
+{
+    mReadPosition = 0;
+    mWritePosition = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioRingBuffer::getReadAvailable( void ) const
+{
+    AudioRingBuffer* pThis = const_cast<AudioRingBuffer*>( this );
+    return dAtomicLoadAcquire( pThis->mWritePosition ) - dAtomicLoadAcquire( pThis->mReadPosition );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioRingBuffer::getWriteAvailable( void ) const
+{
+    return mCapacity - getReadAvailable();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioRingBuffer::write( const void* pData, const U32 size )
+{
+    // Fetch the positions.
+    const U32 writePosition = mWritePosition;
+    const U32 readPosition = dAtomicLoadAcquire( mReadPosition );
+
+    // Clamp to the free space.
+    const U32 writeSize = getMin( size, mCapacity - (writePosition - readPosition) );
+
+    // Finish if nothing to write.
+    if ( writeSize == 0 )
+        return 0;
+
+    // Copy the data, wrapping at the end of the buffer.
+    const U32 writeOffset = writePosition & (mCapacity - 1);
+    const U32 firstSize = getMin( writeSize, mCapacity - writeOffset );
+    dMemcpy( mpBuffer + writeOffset, pData, firstSize );
+    if ( firstSize < writeSize )
+        dMemcpy( mpBuffer, (const U8*)pData + firstSize, writeSize - firstSize );
+
+    // Publish the data.
+    dAtomicStoreRelease( mWritePosition, writePosition + writeSize );
+
+    return writeSize;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioRingBuffer::read( void* pData, const U32 size )
+{
+    // Fetch the positions.
+    const U32 readPosition = mReadPosition;
+    const U32 writePosition = dAtomicLoadAcquire( mWritePosition );
+
+    // Clamp to the available data.
+    const U32 readSize = getMin( size, writePosition - readPosition );
+
+    // Finish if nothing to read.
+    if ( readSize == 0 )
+        return 0;
+
+    // Copy the data, wrapping at the end of the buffer.
+    const U32 readOffset = readPosition & (mCapacity - 1);
+    const U32 firstSize = getMin( readSize, mCapacity - readOffset );
+    dMemcpy( pData, mpBuffer + readOffset, firstSize );
+    if ( firstSize < readSize )
+        dMemcpy( (U8*)pData + firstSize, mpBuffer, readSize - firstSize );
+
+    // Release the space.
+    dAtomicStoreRelease( mReadPosition, readPosition + readSize );
+
+    return readSize;
+}
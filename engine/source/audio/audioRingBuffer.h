@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIORINGBUFFER_H_
+#define _AUDIORINGBUFFER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A lock-free single-producer/single-consumer byte ring buffer.
+///
+/// One thread may write whilst another reads without any locking; the read and write
+/// positions only ever increase (wrapping at 2^32) and are published with release semantics.
+/// Allocating and resetting the buffer is not thread-safe and must only be done when neither
+/// side is using it.
+class AudioRingBuffer
+{
+public:
+    AudioRingBuffer();
+    ~AudioRingBuffer();
+
+    /// Allocate the buffer with at least the specified capacity (rounded up to a power of two).
+    void allocate( const U32 capacity );
+
+    /// Free the buffer.
+    void free( void );
+
+    /// Empty the buffer.
+    void reset( void );
+
+    inline U32 getCapacity( void ) const { return mCapacity; }
+
+    /// Fetch the number of bytes available to read.
+    U32 getReadAvailable( void ) const;
+
+    /// Fetch the number of bytes available to write.
+    U32 getWriteAvailable( void ) const;
+
+    /// Write up to "size" bytes returning the number written.  Producer only.
+    U32 write( const void* pData, const U32 size );
+
+    /// Read up to "size" bytes returning the number read.  Consumer only.
+    U32 read( void* pData, const U32 size );
+
+private:
+    U8*             mpBuffer;
+    U32             mCapacity;
+    volatile U32    mReadPosition;
+    volatile U32    mWritePosition;
+};
+
+#endif // _AUDIORINGBUFFER_H_
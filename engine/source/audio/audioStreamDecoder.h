@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIOSTREAMDECODER_H_
+#define _AUDIOSTREAMDECODER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+#ifndef _PLATFORMAL_H_
+#include "platform/platformAL.h"
+#endif
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Decodes a stream into PCM for a streaming audio source.
+///
+/// The decoder is opened on the main thread but is then only read (and rewound) on the audio
+/// streaming thread so it must not use the console, the resource manager or anything else that
+/// is not thread-safe whilst reading.  New formats are added by registering a decoder for a
+/// file extension with AudioStreamSourceFactory::registerDecoder().
+class AudioStreamDecoder
+{
+public:
+    AudioStreamDecoder() :
+        mFormat( AL_FORMAT_MONO16 ),
+        mFrequency( 0 ),
+        mBlockAlign( 1 ),
+        mBytesPerSecond( 0 ),
+        mTotalBytes( 0 )
+    {}
+    virtual ~AudioStreamDecoder() {}
+
+    /// Open the decoder on the stream which is positioned at the start of the file.
+    virtual bool open( Stream* pStream ) = 0;
+
+    /// Decode up to "size" bytes of PCM returning the number of bytes decoded.
+    /// Zero is returned at the end of the stream.  The size is always a multiple of the block alignment.
+    virtual U32 read( void* pBuffer, const U32 size ) = 0;
+
+    /// Rewind to the start of the PCM data.
+    virtual bool rewind( void ) = 0;
+
+    inline ALenum getFormat( void ) const           { return mFormat; }
+    inline ALsizei getFrequency( void ) const       { return mFrequency; }
+    inline U32 getBlockAlign( void ) const          { return mBlockAlign; }
+    inline U32 getBytesPerSecond( void ) const      { return mBytesPerSecond; }
+
+    /// The total size of the PCM data or zero if it is unknown.
+    inline U32 getTotalBytes( void ) const          { return mTotalBytes; }
+
+protected:
+    ALenum      mFormat;
+    ALsizei     mFrequency;
+    U32         mBlockAlign;
+    U32         mBytesPerSecond;
+    U32         mTotalBytes;
+};
+
+#endif // _AUDIOSTREAMDECODER_H_
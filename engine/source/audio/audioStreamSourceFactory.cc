@@ -29,13 +29,74 @@
 
 #include "audio/audioStreamSourceFactory.h"
 
-#include "audio/wavStreamSource.h"
+#include "audio/bufferedStreamSource.h"
+#include "audio/wavStreamDecoder.h"
 
-AudioStreamSource* AudioStreamSourceFactory::getNewInstance(const char *filename)
+struct DecoderRegistration
+{
+	StringTableEntry											mExtension;
+	AudioStreamSourceFactory::DecoderCreateFunction		mCreateFunction;
+};
+
+static Vector<DecoderRegistration>& getDecoderRegistrations()
 {
+	static Vector<DecoderRegistration> registrations;
+
+	// Register the built-in decoders.
+	if(registrations.size() == 0)
+	{
+		DecoderRegistration registration;
+		registration.mExtension = StringTable->insert(".wav");
+		registration.mCreateFunction = WavStreamDecoder::create;
+		registrations.push_back(registration);
+	}
+
+	return registrations;
+}
+
+void AudioStreamSourceFactory::registerDecoder(const char* extension, DecoderCreateFunction createFunction)
+{
+	AssertFatal(extension != NULL && createFunction != NULL, "AudioStreamSourceFactory::registerDecoder() - Invalid decoder registration.");
+
+	Vector<DecoderRegistration>& registrations = getDecoderRegistrations();
+	StringTableEntry extensionEntry = StringTable->insert(extension);
+
+	// Replace any existing registration.
+	for(S32 i = 0; i < registrations.size(); i++)
+	{
+		if(registrations[i].mExtension == extensionEntry)
+		{
+			registrations[i].mCreateFunction = createFunction;
+			return;
+		}
+	}
+
+	DecoderRegistration registration;
+	registration.mExtension = extensionEntry;
+	registration.mCreateFunction = createFunction;
+	registrations.push_back(registration);
+}
+
+AudioStreamDecoder* AudioStreamSourceFactory::createDecoder(const char *filename)
+{
+	Vector<DecoderRegistration>& registrations = getDecoderRegistrations();
+
 	S32 len = dStrlen(filename);
-	if(len > 3 && !dStricmp(filename + len - 4, ".wav"))
-		return new WavStreamSource(filename);
+	for(S32 i = 0; i < registrations.size(); i++)
+	{
+		S32 extensionLen = dStrlen(registrations[i].mExtension);
+		if(len > extensionLen && !dStricmp(filename + len - extensionLen, registrations[i].mExtension))
+			return registrations[i].mCreateFunction();
+	}
+
+	return NULL;
+}
+
+AudioStreamSource* AudioStreamSourceFactory::getNewInstance(const char *filename)
+{
+	AudioStreamDecoder* decoder = createDecoder(filename);
+	if(decoder != NULL)
+		return new BufferedStreamSource(filename, decoder);
 	
 	return NULL;
 }
@@ -42,11 +42,23 @@
 #ifndef _AUDIOSTREAMSOURCE_H_
 #include "audio/audioStreamSource.h"
 #endif
+#ifndef _AUDIOSTREAMDECODER_H_
+#include "audio/audioStreamDecoder.h"
+#endif
 
 class AudioStreamSourceFactory
 {
 	public:
+		typedef AudioStreamDecoder* (*DecoderCreateFunction)();
+
 		static AudioStreamSource* getNewInstance(const char* filename);
+
+		/// Register a decoder for streaming files with the specified extension (e.g. ".ogg").
+		/// A decoder registered for an existing extension replaces it.
+		static void registerDecoder(const char* extension, DecoderCreateFunction createFunction);
+
+		/// Create a decoder for the file or NULL if the format is not supported.
+		static AudioStreamDecoder* createDecoder(const char* filename);
 };
 
 #endif // _AUDIOSTREAMSOURCEFACTORY_H_
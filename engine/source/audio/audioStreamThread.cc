@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioStreamThread.h"
+#include "audio/bufferedStreamSource.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/mutex.h"
+#include "platform/threads/atomic.h"
+
+//-----------------------------------------------------------------------------
+
+// How long the streaming thread sleeps between filling the sources.
+#define AUDIO_STREAM_THREAD_SLEEP_MS   5
+
+static Thread* sgStreamThread = NULL;
+static Mutex* sgStreamMutex = NULL;
+static Vector<BufferedStreamSource*> sgStreamSources;
+static volatile U32 sgStreamThreadStopping = 0;
+
+//-----------------------------------------------------------------------------
+
+static void audioStreamThreadFunction( void* )
+{
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Audio );
+
+    while ( dAtomicLoadAcquire( sgStreamThreadStopping ) == 0 )
+    {
+        // Fill all the sources.
+        sgStreamMutex->lock();
+        for ( S32 index = 0; index < sgStreamSources.size(); ++index )
+            sgStreamSources[index]->fillRingBuffer();
+        sgStreamMutex->unlock();
+
+        Platform::sleep( AUDIO_STREAM_THREAD_SLEEP_MS );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool AudioStreamThread::add( BufferedStreamSource* pSource )
+{
+#ifdef TORQUE_OS_EMSCRIPTEN
+    // No threads are available.
+    return false;
+#else
+    // Start the thread if needed.
+    if ( sgStreamThread == NULL )
+    {
+        sgStreamMutex = new Mutex();
+        sgStreamThreadStopping = 0;
+        sgStreamThread = new Thread( audioStreamThreadFunction, NULL, true );
+    }
+
+    sgStreamMutex->lock();
+    sgStreamSources.push_back( pSource );
+    sgStreamMutex->unlock();
+
+    return true;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioStreamThread::remove( BufferedStreamSource* pSource )
+{
+    // Finish if the thread is not running.
+    if ( sgStreamThread == NULL )
+        return;
+
+    sgStreamMutex->lock();
+    for ( S32 index = 0; index < sgStreamSources.size(); ++index )
+    {
+        if ( sgStreamSources[index] == pSource )
+        {
+            sgStreamSources.erase_fast( index );
+            break;
+        }
+    }
+    sgStreamMutex->unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioStreamThread::shutdown( void )
+{
+    // Finish if the thread is not running.
+    if ( sgStreamThread == NULL )
+        return;
+
+    // Stop the thread.
+    dAtomicStoreRelease( sgStreamThreadStopping, 1 );
+    sgStreamThread->join();
+
+    delete sgStreamThread;
+    delete sgStreamMutex;
+    sgStreamThread = NULL;
+    sgStreamMutex = NULL;
+    sgStreamSources.clear();
+}
@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIOSTREAMTHREAD_H_
+#define _AUDIOSTREAMTHREAD_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+class BufferedStreamSource;
+
+//-----------------------------------------------------------------------------
+
+/// A dedicated thread that decodes streaming audio ahead of playback.
+///
+/// Sources added to the thread have their ring buffers filled by it so that disk reads and
+/// decoding never happen on the main thread; the main thread only moves the decoded PCM from
+/// the ring buffers into OpenAL buffers.  The thread is started when the first source is added.
+class AudioStreamThread
+{
+public:
+    /// Add a source for the thread to fill.
+    /// Returns false if there is no streaming thread in which case the source must fill itself.
+    static bool add( BufferedStreamSource* pSource );
+
+    /// Remove a source, blocking until the thread is no longer filling it.
+    static void remove( BufferedStreamSource* pSource );
+
+    /// Stop the streaming thread.
+    static void shutdown( void );
+};
+
+#endif // _AUDIOSTREAMTHREAD_H_
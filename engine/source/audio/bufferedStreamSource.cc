@@ -0,0 +1,373 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/bufferedStreamSource.h"
+#include "audio/audioStreamThread.h"
+#include "platform/threads/atomic.h"
+#include "console/console.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+#define BUFFERSIZE 32768
+
+// The ring buffer holds half the queue so decoding stays well ahead of playback.
+#define RINGBUFFERSIZE (BUFFERSIZE * NUMBUFFERS / 2)
+
+//-----------------------------------------------------------------------------
+
+BufferedStreamSource::BufferedStreamSource(const char *filename, AudioStreamDecoder* pDecoder)
+{
+    AssertFatal( pDecoder != NULL, "BufferedStreamSource() - Cannot create a stream source with a NULL decoder." );
+
+    mpDecoder = pDecoder;
+    mpStream = NULL;
+    mThreaded = false;
+    bIsValid = false;
+    bReady = false;
+    bBuffersAllocated = false;
+    mBufferList[0] = 0;
+    clear();
+
+    mFilename = filename;
+    mPosition = Point3F(0.f,0.f,0.f);
+}
+
+//-----------------------------------------------------------------------------
+
+BufferedStreamSource::~BufferedStreamSource()
+{
+    if(bReady && bIsValid)
+        freeStream();
+
+    delete mpDecoder;
+}
+
+//-----------------------------------------------------------------------------
+
+void BufferedStreamSource::clear()
+{
+    if(mpStream)
+        freeStream();
+
+    mHandle           = NULL_AUDIOHANDLE;
+    mSource           = NULL;
+
+    if(mBufferList[0] != 0)
+        alDeleteBuffers(NUMBUFFERS, mBufferList);
+    for(int i = 0; i < NUMBUFFERS; i++)
+        mBufferList[i] = 0;
+
+    dMemset(&mDescription, 0, sizeof(Audio::Description));
+    mEnvironment = 0;
+    mPosition.set(0.f,0.f,0.f);
+    mDirection.set(0.f,1.f,0.f);
+    mPitch = 1.f;
+    mScore = 0.f;
+    mCullTime = 0;
+
+    mDecodeFinished = 0;
+    mLooping = false;
+    mFreeBufferCount = 0;
+    mQueuedBufferCount = 0;
+    mBytesPlayed = 0;
+
+    bReady = false;
+    bFinishedPlaying = false;
+    bIsValid = false;
+    bBuffersAllocated = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BufferedStreamSource::initStream()
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BufferedStreamSource_InitStream);
+
+    // Release any existing stream.
+    if(mpStream != NULL)
+        freeStream();
+
+    bFinishedPlaying = false;
+
+    alSourceStop(mSource);
+    alSourcei(mSource, AL_BUFFER, 0);
+
+    // Open the stream.
+    mpStream = ResourceManager->openStream(mFilename);
+    if(mpStream == NULL)
+        return false;
+
+    // Open the decoder.
+    if(!mpDecoder->open(mpStream))
+    {
+        Con::warnf("BufferedStreamSource::initStream() - Could not decode stream '%s'.", mFilename);
+        freeStream();
+        return false;
+    }
+
+    mLooping = mDescription.mIsLooping;
+    mDecodeFinished = 0;
+    mBytesPlayed = 0;
+    mRingBuffer.allocate(RINGBUFFERSIZE);
+
+    // Clear Error Code
+    alGetError();
+
+    alGenBuffers(NUMBUFFERS, mBufferList);
+    if (alGetError() != AL_NO_ERROR)
+    {
+        freeStream();
+        return false;
+    }
+
+    bBuffersAllocated = true;
+
+    // All the buffers are free.
+    for(int i = 0; i < NUMBUFFERS; i++)
+        mFreeBuffers[i] = mBufferList[i];
+    mFreeBufferCount = NUMBUFFERS;
+    mQueuedBufferCount = 0;
+
+    // Prime the ring buffer and the queue before playback starts.
+    fillRingBuffer();
+    if(!queueBuffers())
+    {
+        freeStream();
+        return false;
+    }
+
+    alSourcei(mSource, AL_LOOPING, AL_FALSE);
+
+    // Hand the decoding over to the streaming thread.
+    mThreaded = AudioStreamThread::add(this);
+
+    bReady = true;
+    bIsValid = true;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BufferedStreamSource::updateBuffers()
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BufferedStreamSource_UpdateBuffers);
+
+    // don't do anything if buffer isn't initialized
+    if(!bIsValid)
+        return false;
+
+    // Decode here if there's no streaming thread.
+    if(!mThreaded)
+        fillRingBuffer();
+
+    // reset AL error code
+    alGetError();
+
+    // Get status
+    ALint processed = 0;
+    alGetSourcei(mSource, AL_BUFFERS_PROCESSED, &processed);
+
+    // Unqueue the played buffers.
+    while (processed > 0)
+    {
+        ALuint bufferId;
+        alSourceUnqueueBuffers(mSource, 1, &bufferId);
+        if (alGetError() != AL_NO_ERROR)
+            return false;
+
+        // Track the played size.
+        ALint bufferSize = 0;
+        alGetBufferi(bufferId, AL_SIZE, &bufferSize);
+        mBytesPlayed += bufferSize;
+
+        mFreeBuffers[mFreeBufferCount++] = bufferId;
+        mQueuedBufferCount--;
+        processed--;
+    }
+
+    // Queue any decoded audio.
+    if(!queueBuffers())
+        return false;
+
+    // Has everything been played?
+    if(mQueuedBufferCount == 0)
+    {
+        if(dAtomicLoadAcquire(mDecodeFinished) != 0 && mRingBuffer.getReadAvailable() == 0)
+        {
+            bFinishedPlaying = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    // Restart the source if it ran dry whilst waiting for the decoder.
+    ALint state;
+    alGetSourcei(mSource, AL_SOURCE_STATE, &state);
+    if(state == AL_STOPPED)
+        alSourcePlay(mSource);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BufferedStreamSource::queueBuffers()
+{
+    char data[BUFFERSIZE];
+
+    while(mFreeBufferCount > 0)
+    {
+        // Fetch the decode state before the available size so that no data is missed.
+        const bool decodeFinished = dAtomicLoadAcquire(mDecodeFinished) != 0;
+        const U32 available = mRingBuffer.getReadAvailable();
+
+        // Wait for a whole buffer unless the decoding has finished or the source is starving.
+        if(available == 0 || (available < BUFFERSIZE && !decodeFinished && mQueuedBufferCount > 0))
+            break;
+
+        const U32 size = mRingBuffer.read(data, BUFFERSIZE);
+
+        const ALuint bufferId = mFreeBuffers[--mFreeBufferCount];
+        alBufferData(bufferId, mpDecoder->getFormat(), data, size, mpDecoder->getFrequency());
+        if (alGetError() != AL_NO_ERROR)
+            return false;
+
+        // Queue buffer
+        alSourceQueueBuffers(mSource, 1, &bufferId);
+        if (alGetError() != AL_NO_ERROR)
+            return false;
+
+        mQueuedBufferCount++;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BufferedStreamSource::fillRingBuffer()
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BufferedStreamSource_FillRingBuffer);
+
+    char data[BUFFERSIZE];
+
+    // Only decode whole blocks.
+    const U32 blockAlign = mpDecoder->getBlockAlign();
+    const U32 readSize = BUFFERSIZE - (BUFFERSIZE % blockAlign);
+
+    bool rewound = false;
+
+    while(dAtomicLoadAcquire(mDecodeFinished) == 0 && mRingBuffer.getWriteAvailable() >= readSize)
+    {
+        const U32 decodedSize = mpDecoder->read(data, readSize);
+
+        // End of the stream?
+        if(decodedSize == 0)
+        {
+            // Yes, so loop back to the start if looping (unless the stream is empty).
+            if(mLooping && !rewound && mpDecoder->rewind())
+            {
+                rewound = true;
+                continue;
+            }
+
+            dAtomicStoreRelease(mDecodeFinished, 1);
+            break;
+        }
+
+        rewound = false;
+        mRingBuffer.write(data, decodedSize);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BufferedStreamSource::freeStream()
+{
+    // Stop the streaming thread using the stream.
+    if(mThreaded)
+    {
+        AudioStreamThread::remove(this);
+        mThreaded = false;
+    }
+
+    bReady = false;
+    bIsValid = false;
+
+    if(mpStream != NULL)
+        ResourceManager->closeStream(mpStream);
+    mpStream = NULL;
+
+    if(bBuffersAllocated)
+    {
+        if(mBufferList[0] != 0)
+            alDeleteBuffers(NUMBUFFERS, mBufferList);
+        for(int i = 0; i < NUMBUFFERS; i++)
+            mBufferList[i] = 0;
+
+        bBuffersAllocated = false;
+    }
+
+    mFreeBufferCount = 0;
+    mQueuedBufferCount = 0;
+    mRingBuffer.reset();
+}
+
+//-----------------------------------------------------------------------------
+
+F32 BufferedStreamSource::getElapsedTime()
+{
+    // Finish if not playing or the rate is unknown.
+    if(!bIsValid || mpDecoder->getBytesPerSecond() == 0)
+        return -1.f;
+
+    // Fetch the position within the queued buffers.
+    ALint byteOffset = 0;
+    alGetSourcei(mSource, AL_BYTE_OFFSET, &byteOffset);
+
+    U32 bytesPlayed = mBytesPlayed + byteOffset;
+
+    // Wrap when looping.
+    if(mLooping && mpDecoder->getTotalBytes() > 0)
+        bytesPlayed %= mpDecoder->getTotalBytes();
+
+    return (F32)bytesPlayed / (F32)mpDecoder->getBytesPerSecond();
+}
+
+//-----------------------------------------------------------------------------
+
+F32 BufferedStreamSource::getTotalTime()
+{
+    // Finish if the length is unknown.
+    if(!bIsValid || mpDecoder->getBytesPerSecond() == 0 || mpDecoder->getTotalBytes() == 0)
+        return -1.f;
+
+    return (F32)mpDecoder->getTotalBytes() / (F32)mpDecoder->getBytesPerSecond();
+}
@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BUFFEREDSTREAMSOURCE_H_
+#define _BUFFEREDSTREAMSOURCE_H_
+
+#ifndef _AUDIOSTREAMSOURCE_H_
+#include "audio/audioStreamSource.h"
+#endif
+#ifndef _AUDIOSTREAMDECODER_H_
+#include "audio/audioStreamDecoder.h"
+#endif
+#ifndef _AUDIORINGBUFFER_H_
+#include "audio/audioRingBuffer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A streaming source that plays PCM decoded ahead of playback into a ring buffer.
+///
+/// The audio streaming thread reads and decodes the stream into the ring buffer whilst the
+/// main thread only moves decoded PCM from the ring buffer into the OpenAL buffer queue.
+class BufferedStreamSource: public AudioStreamSource
+{
+    public:
+        BufferedStreamSource(const char *filename, AudioStreamDecoder* pDecoder);
+        virtual ~BufferedStreamSource();
+
+        virtual bool initStream();
+        virtual bool updateBuffers();
+        virtual void freeStream();
+        virtual F32 getElapsedTime();
+        virtual F32 getTotalTime();
+
+        /// Decode ahead into the ring buffer.
+        /// Called on the audio streaming thread or on the main thread if there is no streaming thread.
+        void fillRingBuffer();
+
+    private:
+        AudioStreamDecoder*     mpDecoder;
+        Stream*                 mpStream;
+        AudioRingBuffer         mRingBuffer;
+        volatile U32            mDecodeFinished;
+        bool                    mLooping;
+        bool                    mThreaded;
+
+        ALuint                  mBufferList[NUMBUFFERS];
+        ALuint                  mFreeBuffers[NUMBUFFERS];
+        U32                     mFreeBufferCount;
+        U32                     mQueuedBufferCount;
+        U32                     mBytesPlayed;
+
+        bool                    bReady;
+        bool                    bBuffersAllocated;
+
+        void clear();
+        bool queueBuffers();
+};
+
+#endif // _BUFFEREDSTREAMSOURCE_H_
@@ -0,0 +1,163 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/wavStreamDecoder.h"
+#include "io/stream.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+#define WAV_FORMAT_PCM          0x0001
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+
+//-----------------------------------------------------------------------------
+
+WavStreamDecoder::WavStreamDecoder() :
+    mpStream( NULL ),
+    mDataStart( 0 ),
+    mDataLeft( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+bool WavStreamDecoder::open( Stream* pStream )
+{
+    AssertFatal( pStream != NULL, "WavStreamDecoder::open() - Cannot open a NULL stream." );
+
+    mpStream = pStream;
+
+    // Read the RIFF header.
+    U8  riffId[4];
+    U32 riffSize;
+    U8  waveId[4];
+    mpStream->read( 4, riffId );
+    mpStream->read( &riffSize );
+    mpStream->read( 4, waveId );
+
+    // Finish if this is not a WAV file.
+    if ( dStrncmp( (const char*)riffId, "RIFF", 4 ) != 0 || dStrncmp( (const char*)waveId, "WAVE", 4 ) != 0 )
+        return false;
+
+    bool foundFormat = false;
+
+    // Iterate the chunks until the data is found.
+    while ( mpStream->getStatus() == Stream::Ok )
+    {
+        U8  chunkId[4];
+        U32 chunkSize;
+        mpStream->read( 4, chunkId );
+        mpStream->read( &chunkSize );
+
+        if ( mpStream->getStatus() != Stream::Ok )
+            break;
+
+        // Fetch the next chunk position (chunks are word aligned).
+        const U32 nextChunk = mpStream->getPosition() + chunkSize + (chunkSize & 1);
+
+        // Format chunk?
+        if ( dStrncmp( (const char*)chunkId, "fmt ", 4 ) == 0 )
+        {
+            U16 format;
+            U16 channels;
+            U32 samplesPerSec;
+            U32 bytesPerSec;
+            U16 blockAlign;
+            U16 bitsPerSample;
+            mpStream->read( &format );
+            mpStream->read( &channels );
+            mpStream->read( &samplesPerSec );
+            mpStream->read( &bytesPerSec );
+            mpStream->read( &blockAlign );
+            mpStream->read( &bitsPerSample );
+
+            // Finish if the format is not supported.
+            if ( (format != WAV_FORMAT_PCM && format != WAV_FORMAT_EXTENSIBLE) || channels == 0 || channels > 2 || (bitsPerSample != 8 && bitsPerSample != 16) )
+                return false;
+
+            mFormat = channels == 1 ?
+                (bitsPerSample == 8 ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16) :
+                (bitsPerSample == 8 ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16);
+            mFrequency = samplesPerSec;
+            mBlockAlign = channels * (bitsPerSample / 8);
+            mBytesPerSecond = samplesPerSec * mBlockAlign;
+            foundFormat = true;
+        }
+        // Data chunk?
+        else if ( dStrncmp( (const char*)chunkId, "data", 4 ) == 0 )
+        {
+            // Finish if the data comes before the format.
+            if ( !foundFormat )
+                return false;
+
+            // Only use whole blocks.
+            mTotalBytes = chunkSize - (chunkSize % mBlockAlign);
+            mDataStart = mpStream->getPosition();
+            mDataLeft = mTotalBytes;
+            return true;
+        }
+
+        // Move to the next chunk.
+        if ( !mpStream->setPosition( nextChunk ) )
+            break;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WavStreamDecoder::read( void* pBuffer, const U32 size )
+{
+    // Clamp the read to the remaining whole blocks.
+    U32 readSize = getMin( size, mDataLeft );
+    readSize -= readSize % mBlockAlign;
+
+    // Finish if nothing left.
+    if ( readSize == 0 )
+        return 0;
+
+    // Read the data.
+    if ( !mpStream->read( readSize, pBuffer ) )
+    {
+        // Treat a failed read as the end of the stream.
+        mDataLeft = 0;
+        return 0;
+    }
+
+    mDataLeft -= readSize;
+
+    return readSize;
+}
+
+//-----------------------------------------------------------------------------
+
+bool WavStreamDecoder::rewind( void )
+{
+    // Move to the start of the data.
+    if ( !mpStream->setPosition( mDataStart ) )
+        return false;
+
+    mDataLeft = mTotalBytes;
+
+    return true;
+}
@@ -20,47 +20,32 @@
 // IN THE SOFTWARE.
 //-----------------------------------------------------------------------------
 
-#ifndef _WAVSTREAMSOURCE_H_
-#define _WAVSTREAMSOURCE_H_
+#ifndef _WAVSTREAMDECODER_H_
+#define _WAVSTREAMDECODER_H_
 
-#ifndef _AUDIOSTREAMSOURCE_H_
-#include "audio/audioStreamSource.h"
+#ifndef _AUDIOSTREAMDECODER_H_
+#include "audio/audioStreamDecoder.h"
 #endif
 
-class WavStreamSource: public AudioStreamSource
-{
-    public:
-        WavStreamSource(const char *filename);
-        virtual ~WavStreamSource();
-
-        virtual bool initStream();
-        virtual bool updateBuffers();
-        virtual void freeStream();
-      virtual F32 getElapsedTime();
-      virtual F32 getTotalTime();
-
-    private:
-        ALuint				    mBufferList[NUMBUFFERS];
-        S32						mNumBuffers;
-        S32						mBufferSize;
-        Stream				   *stream;
-
-        bool					bReady;
-        bool					bFinished;
+//-----------------------------------------------------------------------------
 
-        ALenum  format;
-        ALsizei size;
-        ALsizei freq;
+/// Decodes uncompressed 8 or 16-bit PCM WAV files.
+class WavStreamDecoder : public AudioStreamDecoder
+{
+public:
+    WavStreamDecoder();
+    virtual ~WavStreamDecoder() {}
 
-        ALuint			DataSize;
-        ALuint			DataLeft;
-        ALuint			dataStart;
-        ALuint			buffersinqueue;
+    virtual bool open( Stream* pStream );
+    virtual U32 read( void* pBuffer, const U32 size );
+    virtual bool rewind( void );
 
-        bool			bBuffersAllocated;
+    static AudioStreamDecoder* create( void ) { return new WavStreamDecoder(); }
 
-        void clear();
-        void resetStream();
+private:
+    Stream*     mpStream;
+    U32         mDataStart;
+    U32         mDataLeft;
 };
 
-#endif // _AUDIOSTREAMSOURCE_H_
+#endif // _WAVSTREAMDECODER_H_
@@ -0,0 +1,303 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SMALLVECTOR_H_
+#define _SMALLVECTOR_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+/// A dynamic array class with inline storage for a small number of elements.
+///
+/// Up to "N" elements are stored inside the object itself so a short-lived
+/// SmallVector on the stack does not touch the heap at all unless it outgrows
+/// its inline storage.  When it does, the elements are relocated to the heap
+/// with a bitwise copy and the capacity grows geometrically as with Vector.
+///
+/// The interface is a subset of Vector and carries the same warning i.e. it is
+/// intended for simple structures that need no construction or destruction.
+///
+/// Use it for collections that are usually small and are created often or held
+/// per-item.  Long-lived collections that routinely hold many elements and keep
+/// their capacity between uses, such as the scene tick list or the world query
+/// results, gain nothing from it and should remain a Vector.
+///
+/// @nosubgrouping
+template<class T, U32 N>
+class SmallVector
+{
+  protected:
+   U32 mElementCount;
+   U32 mArraySize;
+   T*  mArray;
+
+   union
+   {
+      U8    mBytes[N * sizeof(T)];
+      F64   mAlignF64;
+      U64   mAlignU64;
+      void* mAlignPointer;
+   } mInlineStorage;
+
+   void  grow(U32);   ///< Grows the capacity to hold at least the count, relocating to the heap if required.
+   T*    getInlineArray() { return (T*)mInlineStorage.mBytes; }
+
+  public:
+   SmallVector();
+   SmallVector(const SmallVector&);
+   ~SmallVector();
+
+   /// @name STL interface
+   /// @{
+
+   typedef T        value_type;
+   typedef T&       reference;
+   typedef const T& const_reference;
+
+   typedef T*       iterator;
+   typedef const T* const_iterator;
+   typedef S32      difference_type;
+   typedef U32      size_type;
+
+   SmallVector& operator=(const SmallVector& p);
+
+   iterator       begin()        { return mArray; }
+   const_iterator begin() const  { return mArray; }
+   iterator       end()          { return mArray + mElementCount; }
+   const_iterator end() const    { return mArray + mElementCount; }
+
+   S32  size() const             { return (S32)mElementCount; }
+   bool empty() const            { return mElementCount == 0; }
+   bool contains(const T&) const;
+
+   void push_back(const T&);
+   void pop_back();
+
+   T&       operator[](U32);
+   const T& operator[](U32) const;
+
+   T& operator[](S32 i)              { return operator[](U32(i)); }
+   const T& operator[](S32 i ) const { return operator[](U32(i)); }
+
+   void reserve(U32);
+   U32  capacity() const         { return mArraySize; }
+
+   /// @}
+
+   /// @name Extended interface
+   /// @{
+
+   U32  memSize() const          { return mArraySize * sizeof(T); }
+   T*   address() const          { return mArray; }
+   bool isInline() const         { return mArray == (const T*)mInlineStorage.mBytes; }
+   U32  setSize(U32);
+   void increment(U32 = 1);
+   void decrement(U32 = 1);
+   void erase(U32);
+   void erase_fast(U32);
+   void clear()                  { mElementCount = 0; }
+   T& first();
+   T& last();
+   const T& first() const;
+   const T& last() const;
+
+   /// @}
+};
+
+template<class T, U32 N> inline SmallVector<T,N>::SmallVector()
+{
+   mElementCount = 0;
+   mArraySize    = N;
+   mArray        = getInlineArray();
+}
+
+template<class T, U32 N> inline SmallVector<T,N>::SmallVector(const SmallVector& p)
+{
+   mElementCount = 0;
+   mArraySize    = N;
+   mArray        = getInlineArray();
+
+   *this = p;
+}
+
+template<class T, U32 N> inline SmallVector<T,N>::~SmallVector()
+{
+   if (!isInline())
+      dFree(mArray);
+}
+
+template<class T, U32 N> inline SmallVector<T,N>& SmallVector<T,N>::operator=(const SmallVector& p)
+{
+   if (p.mElementCount > mArraySize)
+      grow(p.mElementCount);
+
+   mElementCount = p.mElementCount;
+   if (mElementCount)
+      dMemcpy(mArray, p.mArray, mElementCount * sizeof(T));
+
+   return *this;
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::grow(U32 count)
+{
+   const U32 newSize = VectorGrowSize(mArraySize, count);
+
+   T* pArray;
+   if (isInline())
+   {
+      // Relocate the inline elements to the heap.
+      pArray = (T*)dMalloc(newSize * sizeof(T));
+      AssertFatal(pArray != NULL, "SmallVector<T>::grow - Failed to allocate the array.");
+      dMemcpy(pArray, mArray, mElementCount * sizeof(T));
+   }
+   else
+   {
+      pArray = (T*)dRealloc(mArray, newSize * sizeof(T));
+      AssertFatal(pArray != NULL, "SmallVector<T>::grow - Failed to reallocate the array.");
+   }
+
+   mArray = pArray;
+   mArraySize = newSize;
+}
+
+template<class T, U32 N> inline bool SmallVector<T,N>::contains(const T& x) const
+{
+   for (U32 i = 0; i < mElementCount; i++)
+   {
+      if (mArray[i] == x)
+         return true;
+   }
+
+   return false;
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::push_back(const T& x)
+{
+   if (mElementCount == mArraySize)
+      grow(mElementCount + 1);
+
+   constructInPlace(&mArray[mElementCount++], &x);
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::pop_back()
+{
+   AssertFatal(mElementCount != 0, "SmallVector<T>::pop_back - cannot pop the back of a zero-length vector.");
+   decrement();
+}
+
+template<class T, U32 N> inline T& SmallVector<T,N>::operator[](U32 index)
+{
+   AssertFatal(index < mElementCount, "SmallVector<T>::operator[] - out of bounds array access!");
+   return mArray[index];
+}
+
+template<class T, U32 N> inline const T& SmallVector<T,N>::operator[](U32 index) const
+{
+   AssertFatal(index < mElementCount, "SmallVector<T>::operator[] - out of bounds array access!");
+   return mArray[index];
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::reserve(U32 size)
+{
+   if (size > mArraySize)
+      grow(size);
+}
+
+template<class T, U32 N> inline U32 SmallVector<T,N>::setSize(U32 size)
+{
+   if (size > mArraySize)
+      grow(size);
+
+   mElementCount = size;
+   return mElementCount;
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::increment(U32 delta)
+{
+   const U32 count = mElementCount;
+   if (count + delta > mArraySize)
+      grow(count + delta);
+
+   mElementCount += delta;
+   for (U32 i = count; i < mElementCount; i++)
+      constructInPlace(&mArray[i]);
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::decrement(U32 delta)
+{
+   AssertFatal(mElementCount != 0, "SmallVector<T>::decrement - cannot decrement zero-length vector.");
+
+   const U32 newCount = mElementCount > delta ? mElementCount - delta : 0;
+   for (U32 i = newCount; i < mElementCount; i++)
+      destructInPlace(&mArray[i]);
+
+   mElementCount = newCount;
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::erase(U32 index)
+{
+   AssertFatal(index < mElementCount, "SmallVector<T>::erase - out of bounds index!");
+
+   if (index < (mElementCount - 1))
+      dMemmove(&mArray[index], &mArray[index + 1], (mElementCount - index - 1) * sizeof(T));
+
+   mElementCount--;
+}
+
+template<class T, U32 N> inline void SmallVector<T,N>::erase_fast(U32 index)
+{
+   AssertFatal(index < mElementCount, "SmallVector<T>::erase_fast - out of bounds index.");
+
+   // CAUTION: this operator does NOT maintain list order.
+   if (index < (mElementCount - 1))
+      dMemcpy(&mArray[index], &mArray[mElementCount - 1], sizeof(T));
+
+   mElementCount--;
+}
+
+template<class T, U32 N> inline T& SmallVector<T,N>::first()
+{
+   AssertFatal(mElementCount != 0, "SmallVector<T>::first - Error, no first element of a zero sized array!");
+   return mArray[0];
+}
+
+template<class T, U32 N> inline const T& SmallVector<T,N>::first() const
+{
+   AssertFatal(mElementCount != 0, "SmallVector<T>::first - Error, no first element of a zero sized array! (const)");
+   return mArray[0];
+}
+
+template<class T, U32 N> inline T& SmallVector<T,N>::last()
+{
+   AssertFatal(mElementCount != 0, "SmallVector<T>::last - Error, no last element of a zero sized array!");
+   return mArray[mElementCount - 1];
+}
+
+template<class T, U32 N> inline const T& SmallVector<T,N>::last() const
+{
+   AssertFatal(mElementCount != 0, "SmallVector<T>::last - Error, no last element of a zero sized array! (const)");
+   return mArray[mElementCount - 1];
+}
+
+#endif //_SMALLVECTOR_H_
@@ -48,6 +48,8 @@ bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount, U32 el
          *arrayPtr = dMalloc_r(mem_size, pUseFileName, useLineNum);
       }
 
+      AssertFatal(*arrayPtr != NULL, "VectorResize - Failed to allocate the array.");
+
       *aCount = newCount;
       *aSize = blocks * VectorBlockSize;
       return true;
@@ -75,6 +77,7 @@ bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount, U32 el
       S32 mem_size = blocks * VectorBlockSize * elemSize;
       *arrayPtr = *arrayPtr ? dRealloc(*arrayPtr,mem_size) :
          dMalloc(mem_size);
+      AssertFatal(*arrayPtr != NULL, "VectorResize - Failed to allocate the array.");
 
       *aCount = newCount;
       *aSize = blocks * VectorBlockSize;
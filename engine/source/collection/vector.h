@@ -33,6 +33,14 @@
 /// Size of memory blocks to allocate at a time for vectors.
 const static S32 VectorBlockSize = 16;
 
+/// Fetch the capacity a vector should grow to when it needs room for "newCount" elements.
+/// The capacity grows geometrically so that repeatedly appending elements is amortised O(1).
+inline U32 VectorGrowSize(const U32 arraySize, const U32 newCount)
+{
+   const U32 growSize = arraySize + (arraySize >> 1);
+   return growSize > newCount ? growSize : newCount;
+}
+
 #ifdef TORQUE_DEBUG
 extern bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount, U32 elemSize,
                          const char* fileName,
@@ -53,9 +61,11 @@ extern bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount,
 /// A dynamic array class.
 ///
 /// The vector grows as you insert or append
-/// elements.  Insertion is fastest at the end of the array.  Resizing
-/// of the array can be avoided by pre-allocating space using the
-/// reserve() method.
+/// elements.  Insertion is fastest at the end of the array.  The capacity
+/// grows geometrically so appending is amortised O(1) however resizing
+/// of the array can be avoided entirely by pre-allocating space using the
+/// reserve() method.  Elements are relocated with a bitwise copy when the
+/// array is resized.
 ///
 /// <b>***WARNING***</b>
 ///
@@ -80,6 +90,7 @@ class Vector
 #endif
 
    bool  resize(U32); // resizes, but does no construction/destruction
+   bool  grow(U32);   // resizes geometrically to hold at least the count, but does no construction/destruction
    void  destroy(U32 start, U32 end);   ///< Destructs elements from <i>start</i> to <i>end-1</i>
    void  construct(U32 start, U32 end); ///< Constructs elements from <i>start</i> to <i>end-1</i>
    void  construct(U32 start, U32 end, const T* array);
@@ -240,7 +251,9 @@ template<class T> inline Vector<T>::Vector(const Vector& p)
    mLineAssociation = p.mLineAssociation;
 #endif
 
-   mArray = 0;
+   mArray        = 0;
+   mElementCount = 0;
+   mArraySize    = 0;
    resize(p.mElementCount);
    if (p.mElementCount)
       dMemcpy(mArray,p.mArray,mElementCount * sizeof(value_type));
@@ -296,7 +309,7 @@ template<class T> inline T* Vector<T>::address() const
 template<class T> inline U32 Vector<T>::setSize(U32 size)
 {
    if (size > mArraySize)
-      resize(size);
+      grow(size);
    else
       mElementCount = size;
    return mElementCount;
@@ -306,7 +319,7 @@ template<class T> inline void Vector<T>::increment( U32 delta)
 {
     U32 count = mElementCount;
     if ((mElementCount += delta) > mArraySize)
-        resize(mElementCount);
+        grow(mElementCount);
     construct(count, mElementCount);
 }
 
@@ -314,7 +327,7 @@ template<class T> inline void Vector<T>::increment(const T* array, U32 delta)
 {
    U32 count = mElementCount;
    if ((mElementCount += delta) > mArraySize)
-      resize(mElementCount);
+      grow(mElementCount);
     construct(count, mElementCount, array);
 }
 
@@ -419,7 +432,12 @@ template<class T> inline void Vector<T>::sort(compare_func f)
 
 template<class T> inline Vector<T>& Vector<T>::operator=(const Vector<T>& p)
 {
-   resize(p.mElementCount);
+   // Only reallocate if the existing capacity is too small.
+   if (p.mElementCount > mArraySize)
+      resize(p.mElementCount);
+   else
+      mElementCount = p.mElementCount;
+
    if (p.mElementCount)
       dMemcpy(mArray,p.mArray,mElementCount * sizeof(value_type));
 
@@ -624,13 +642,21 @@ template<class T> inline bool Vector<T>::resize(U32 ecount)
 #endif
 }
 
+template<class T> inline bool Vector<T>::grow(U32 ecount)
+{
+   // Resize to the grown capacity then restore the requested count.
+   const bool result = resize(VectorGrowSize(mArraySize, ecount));
+   mElementCount = ecount;
+   return result;
+}
+
 template<class T> inline void Vector<T>::merge(const Vector& p)
 {
    if (!p.size())
       return;
 
    const S32 oldsize = size();
-   resize(oldsize + p.size());
+   grow(oldsize + p.size());
    dMemcpy( &mArray[oldsize], p.address(), p.size() * sizeof(T) );
 }
 
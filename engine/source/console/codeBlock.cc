@@ -22,8 +22,11 @@
 #include "console/console.h"
 #include "console/compiler.h"
 #include "console/codeBlock.h"
+#include "console/consoleNamespace.h"
 #include "io/resource/resourceManager.h"
 #include "math/mMath.h"
+#include "algorithm/crc.h"
+#include "collection/hashTable.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -38,6 +41,27 @@ U32            CodeBlock::smBreakLineCount = 0;
 CodeBlock *    CodeBlock::smCodeBlockList = NULL;
 CodeBlock *    CodeBlock::smCurrentCodeBlock = NULL;
 ConsoleParser *CodeBlock::smCurrentParser = NULL;
+S32            CodeBlock::smExecCacheSize = 256;
+U32            CodeBlock::smExecCacheHits = 0;
+U32            CodeBlock::smExecCacheMisses = 0;
+U32            CodeBlock::smExecCacheEvictions = 0;
+U32            CodeBlock::smExecCacheInvalidations = 0;
+
+/// A compiled anonymous script held in the exec cache.
+struct ExecCacheEntry
+{
+   ExecCacheEntry *prev;
+   ExecCacheEntry *next;
+   U32 hash;
+   U32 length;
+   char *script;
+   CodeBlock *code;
+   U32 functionSequence;
+};
+
+static HashMap<U32, ExecCacheEntry*> sgExecCache;
+static ExecCacheEntry *sgExecCacheHead = NULL;
+static ExecCacheEntry *sgExecCacheTail = NULL;
 
 //-------------------------------------------------------------------------
 
@@ -348,7 +372,7 @@ void CodeBlock::calcBreakList()
        pRemoteDebugger->addCodeBlock( this );
 }
 
-bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+void CodeBlock::setFileName(StringTableEntry fileName)
 {
    const StringTableEntry exePath = Platform::getMainDotCsDir();
    const StringTableEntry cwd = Platform::getCurrentDirectory();
@@ -390,6 +414,11 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
 
    //
    addToCodeList();
+}
+
+bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+{
+   setFileName(fileName);
 
    U32 globalSize,size,i;
    st.read(&size);
@@ -474,6 +503,95 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
    return true;
 }
 
+static inline U32 readImageU32(const U8 *&image)
+{
+   U32 value;
+   dMemcpy(&value, image, sizeof(value));
+   image += sizeof(value);
+   return convertLEndianToHost(value);
+}
+
+bool CodeBlock::read(StringTableEntry fileName, const U8 *image, const StringTableEntry *identifiers)
+{
+   setFileName(fileName);
+
+   // The image is laid out exactly as the code-block wants it in memory so
+   // each table is a single copy.  Only the identifiers need patching.
+   U32 size;
+   size = readImageU32(image);
+   if(size)
+   {
+      globalStrings = new char[size];
+      dMemcpy(globalStrings, image, size);
+      image += size;
+   }
+   size = readImageU32(image);
+   if(size)
+   {
+      functionStrings = new char[size];
+      dMemcpy(functionStrings, image, size);
+      image += size;
+   }
+   size = readImageU32(image);
+   if(size)
+   {
+      globalFloats = new F64[size];
+      dMemcpy(globalFloats, image, size * sizeof(F64));
+      image += size * sizeof(F64);
+#ifdef TORQUE_BIG_ENDIAN
+      for(U32 i = 0; i < size; i++)
+         globalFloats[i] = convertLEndianToHost(globalFloats[i]);
+#endif
+   }
+   size = readImageU32(image);
+   if(size)
+   {
+      functionFloats = new F64[size];
+      dMemcpy(functionFloats, image, size * sizeof(F64));
+      image += size * sizeof(F64);
+#ifdef TORQUE_BIG_ENDIAN
+      for(U32 i = 0; i < size; i++)
+         functionFloats[i] = convertLEndianToHost(functionFloats[i]);
+#endif
+   }
+   codeSize = readImageU32(image);
+   lineBreakPairCount = readImageU32(image);
+
+   U32 totSize = codeSize + lineBreakPairCount * 2;
+   code = new U32[totSize];
+   dMemcpy(code, image, totSize * sizeof(U32));
+   image += totSize * sizeof(U32);
+#ifdef TORQUE_BIG_ENDIAN
+   for(U32 i = 0; i < totSize; i++)
+      code[i] = convertLEndianToHost(code[i]);
+#endif
+
+   lineBreakPairs = code + codeSize;
+
+   // Patch in the image identifiers.
+   U32 identCount = readImageU32(image);
+   while(identCount--)
+   {
+      StringTableEntry ste = identifiers[readImageU32(image)];
+
+      U32 count = readImageU32(image);
+      while(count--)
+      {
+         U32 ip = readImageU32(image);
+#ifdef TORQUE_64
+         *(U64*)(code+ip) = (U64)ste;
+#else
+         code[ip] = (U32)ste;
+#endif
+      }
+   }
+
+   if(lineBreakPairCount)
+      calcBreakList();
+
+   return true;
+}
+
 
 bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, const char *script)
 {
@@ -570,6 +688,17 @@ bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, con
 }
 
 const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string, bool noCalls, int setFrame)
+{
+   if(!compileScript(fileName, string))
+   {
+      delete this;
+      return "";
+   }
+
+   return exec(0, fileName, NULL, 0, 0, noCalls, NULL, setFrame);
+}
+
+bool CodeBlock::compileScript(StringTableEntry fileName, const char *string)
 {
    STEtoCode = evalSTEtoCode;
    consoleAllocReset();
@@ -615,10 +744,7 @@ const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string
    smCurrentParser->parse();
 
    if(!statementList)
-   {
-      delete this;
-      return "";
-   }
+      return false;
 
    resetTables();
 
@@ -650,7 +776,128 @@ const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string
    if(lastIp != codeSize)
       Con::warnf(ConsoleLogEntry::General, "precompile size mismatch");
 
-   return exec(0, fileName, NULL, 0, 0, noCalls, NULL, setFrame);
+   return true;
+}
+
+//-------------------------------------------------------------------------
+
+static void unlinkExecCacheEntry(ExecCacheEntry *entry)
+{
+   if(entry->prev)
+      entry->prev->next = entry->next;
+   else
+      sgExecCacheHead = entry->next;
+
+   if(entry->next)
+      entry->next->prev = entry->prev;
+   else
+      sgExecCacheTail = entry->prev;
+
+   entry->prev = entry->next = NULL;
+}
+
+static void linkExecCacheEntry(ExecCacheEntry *entry)
+{
+   entry->prev = NULL;
+   entry->next = sgExecCacheHead;
+   if(sgExecCacheHead)
+      sgExecCacheHead->prev = entry;
+   else
+      sgExecCacheTail = entry;
+   sgExecCacheHead = entry;
+}
+
+static void releaseExecCacheEntry(ExecCacheEntry *entry)
+{
+   unlinkExecCacheEntry(entry);
+   sgExecCache.erase(entry->hash);
+
+   // NOTE: The code-block stays alive if it's executing or it defined any functions.
+   entry->code->decRefCount();
+   delete [] entry->script;
+   delete entry;
+}
+
+const char *CodeBlock::compileExecCached(const char *string, bool noCalls, int setFrame)
+{
+   // Skip the cache if it's disabled.
+   if(smExecCacheSize <= 0)
+   {
+      CodeBlock *newCodeBlock = new CodeBlock();
+      return newCodeBlock->compileExec(NULL, string, noCalls, setFrame);
+   }
+
+   const U32 length = dStrlen(string);
+   const U32 hash = calculateCRC(string, length);
+
+   // Do we have the script cached?
+   ExecCacheEntry *entry = NULL;
+   HashMap<U32, ExecCacheEntry*>::iterator cacheItr = sgExecCache.find(hash);
+   if(cacheItr != sgExecCache.end())
+   {
+      entry = cacheItr->value;
+
+      // Yes, so discard it if the functions it may have resolved have changed or it's a different script with the same hash.
+      if(entry->functionSequence != Namespace::mFunctionSequence)
+      {
+         smExecCacheInvalidations++;
+         releaseExecCacheEntry(entry);
+         entry = NULL;
+      }
+      else if(entry->length != length || dStrcmp(entry->script, string) != 0)
+      {
+         releaseExecCacheEntry(entry);
+         entry = NULL;
+      }
+   }
+
+   if(entry)
+   {
+      smExecCacheHits++;
+
+      // Move to the front of the cache.
+      unlinkExecCacheEntry(entry);
+      linkExecCacheEntry(entry);
+   }
+   else
+   {
+      smExecCacheMisses++;
+
+      CodeBlock *newCodeBlock = new CodeBlock();
+      if(!newCodeBlock->compileScript(NULL, string))
+      {
+         delete newCodeBlock;
+         return "";
+      }
+
+      // Evict the least recently used scripts.
+      while(sgExecCacheTail && (S32)sgExecCache.size() >= smExecCacheSize)
+      {
+         smExecCacheEvictions++;
+         releaseExecCacheEntry(sgExecCacheTail);
+      }
+
+      entry = new ExecCacheEntry;
+      entry->hash = hash;
+      entry->length = length;
+      entry->script = new char[length + 1];
+      dMemcpy(entry->script, string, length + 1);
+      entry->code = newCodeBlock;
+      entry->code->incRefCount();
+      linkExecCacheEntry(entry);
+      sgExecCache.insert(hash, entry);
+   }
+
+   // NOTE: Calls are resolved in-place as the code executes so we note the function state before executing.
+   entry->functionSequence = Namespace::mFunctionSequence;
+
+   return entry->code->exec(0, NULL, NULL, 0, 0, noCalls, NULL, setFrame);
+}
+
+void CodeBlock::clearExecCache()
+{
+   while(sgExecCacheHead)
+      releaseExecCacheEntry(sgExecCacheHead);
 }
 
 //-------------------------------------------------------------------------
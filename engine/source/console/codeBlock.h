@@ -104,7 +104,15 @@ public:
    void getFunctionArgs(char buffer[1024], U32 offset);
    const char *getFileLine(U32 ip);
 
+   void setFileName(StringTableEntry fileName);
+   bool compileScript(StringTableEntry fileName, const char *script);
    bool read(StringTableEntry fileName, Stream &st);
+
+   /// Reads a code-block from a script image.
+   /// @param fileName The file name of the script the code-block was compiled from.
+   /// @param image The code-block data within the script image.
+   /// @param identifiers The de-duplicated identifiers of the script image.
+   bool read(StringTableEntry fileName, const U8 *image, const StringTableEntry *identifiers);
    bool compile(const char *dsoName, StringTableEntry fileName, const char *script);
 
    void incRefCount();
@@ -128,6 +136,26 @@ public:
    const char *compileExec(StringTableEntry fileName, const char *script, 
       bool noCalls, int setFrame = -1 );
 
+   /// Compiles and executes a block of anonymous script like compileExec() but
+   /// re-uses the compiled code of an identical script executed recently.  The
+   /// cache holds up to smExecCacheSize scripts and discards the least recently
+   /// used.  Cached scripts are discarded when any function is (re)defined.
+   ///
+   /// @param script The script code to compile and execute.
+   /// @param noCalls Skips calling functions from the script.
+   /// @param setFrame A zero based index of the stack frame to execute the code 
+   /// with or -1 for a new frame.
+   static const char *compileExecCached(const char *script, bool noCalls, int setFrame = -1);
+
+   /// Discards all the cached compiled scripts.
+   static void clearExecCache();
+
+   static S32 smExecCacheSize;
+   static U32 smExecCacheHits;
+   static U32 smExecCacheMisses;
+   static U32 smExecCacheEvictions;
+   static U32 smExecCacheInvalidations;
+
    /// Executes the existing code in the CodeBlock. The return string is any 
    /// result of the code executed, if any, or an empty string.
    ///
@@ -456,6 +456,8 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    static char traceBuffer[1024];
    U32 i;
 
+   MemoryTagScope memoryTagScope(MemoryTag_Script);
+
    incRefCount();
    F64 *curFloatTable;
    char *curStringTable;
@@ -1232,7 +1234,7 @@ breakContinue:
 
          case OP_LOADFIELD_UINT:
             if(curObject)
-               intStack[UINT+1] = U32(dAtoi(curObject->getDataField(curField, curFieldArray)));
+               intStack[UINT+1] = U32(curObject->getDataFieldInt(curField, curFieldArray));
             else
             {
                // The field is not being retrieved from an object. Maybe it's
@@ -1246,7 +1248,7 @@ breakContinue:
 
          case OP_LOADFIELD_FLT:
             if(curObject)
-               floatStack[FLT+1] = dAtof(curObject->getDataField(curField, curFieldArray));
+               floatStack[FLT+1] = curObject->getDataFieldFloat(curField, curFieldArray);
             else
             {
                // The field is not being retrieved from an object. Maybe it's
@@ -34,6 +34,7 @@
 #include "debug/telnetDebugger.h"
 #include "sim/simBase.h"
 #include "console/compiler.h"
+#include "console/scriptImage.h"
 #include "string/stringStack.h"
 #include "component/dynamicConsoleMethodComponent.h"
 #include "memory/safeDelete.h"
@@ -253,6 +254,7 @@ void init()
    addVariable("Con::logBufferEnabled", TypeBool, &logBufferEnabled);
    addVariable("Con::printLevel", TypeS32, &printLevel);
    addVariable("Con::warnUndefinedVariables", TypeBool, &gWarnUndefinedScriptVariables);
+   addVariable("Con::execCacheSize", TypeS32, &CodeBlock::smExecCacheSize);
 
    // Current script file name and root
    Con::addVariable( "Con::File", TypeString, &gCurrentFile );
@@ -273,6 +275,8 @@ void shutdown()
    active = false;
 
    consoleLogFile.close();
+   ScriptImage::unloadAll();
+   CodeBlock::clearExecCache();
    Namespace::shutdown();
 
    SAFE_DELETE( sLogMutex );
@@ -942,8 +946,12 @@ const char *evaluate(const char* string, bool echo, const char *fileName)
    if(fileName)
       fileName = StringTable->insert(fileName);
 
+   // Anonymous scripts are compiled once and cached.
+   if(!fileName)
+      return CodeBlock::compileExecCached(string, false, 0);
+
    CodeBlock *newCodeBlock = new CodeBlock();
-   return newCodeBlock->compileExec(fileName, string, false, fileName ? -1 : 0);
+   return newCodeBlock->compileExec(fileName, string, false, -1);
 }
 
 //------------------------------------------------------------------------------
@@ -958,8 +966,7 @@ const char *evaluatef(const char* string, ...)
       dVsprintf(buffer, 4096, string, args);
       va_end (args);
 
-      CodeBlock *newCodeBlock = new CodeBlock();
-      result = newCodeBlock->compileExec(NULL, buffer, false, 0);
+      result = CodeBlock::compileExecCached(buffer, false, 0);
 
       delete [] buffer;
       buffer = NULL;
@@ -37,6 +37,7 @@
 #include "consoleNamespace_ScriptBinding.h"
 
 U32 Namespace::mCacheSequence = 0;
+U32 Namespace::mFunctionSequence = 0;
 DataChunker Namespace::mCacheAllocator;
 DataChunker Namespace::mAllocator;
 Namespace *Namespace::mNamespaceList = NULL;
@@ -165,7 +166,10 @@ bool Namespace::unlinkClass(Namespace *parent)
    mRefCountToParent--;
 
    if(mRefCountToParent == 0)
+   {
       walk->mParent = NULL;
+      mFunctionSequence++;
+   }
 
    trashCache();
 
@@ -186,6 +190,8 @@ bool Namespace::classLinkTo(Namespace *parent)
       return false;
    }
    mRefCountToParent++;
+   if(walk->mParent != parent)
+      mFunctionSequence++;
    walk->mParent = parent;
 
    trashCache();
@@ -349,6 +355,7 @@ void Namespace::addFunction(StringTableEntry name, CodeBlock *cb, U32 functionOf
 {
    Entry *ent = createLocalEntry(name);
    trashCache();
+   mFunctionSequence++;
 
    ent->mUsage = usage;
    ent->mCode = cb;
@@ -361,6 +368,7 @@ void Namespace::addCommand(StringTableEntry name,StringCallback cb, const char *
 {
    Entry *ent = createLocalEntry(name);
    trashCache();
+   mFunctionSequence++;
 
    ent->mUsage = usage;
    ent->mMinArgs = minArgs;
@@ -374,6 +382,7 @@ void Namespace::addCommand(StringTableEntry name,IntCallback cb, const char *usa
 {
    Entry *ent = createLocalEntry(name);
    trashCache();
+   mFunctionSequence++;
 
    ent->mUsage = usage;
    ent->mMinArgs = minArgs;
@@ -387,6 +396,7 @@ void Namespace::addCommand(StringTableEntry name,VoidCallback cb, const char *us
 {
    Entry *ent = createLocalEntry(name);
    trashCache();
+   mFunctionSequence++;
 
    ent->mUsage = usage;
    ent->mMinArgs = minArgs;
@@ -400,6 +410,7 @@ void Namespace::addCommand(StringTableEntry name,FloatCallback cb, const char *u
 {
    Entry *ent = createLocalEntry(name);
    trashCache();
+   mFunctionSequence++;
 
    ent->mUsage = usage;
    ent->mMinArgs = minArgs;
@@ -413,6 +424,7 @@ void Namespace::addCommand(StringTableEntry name,BoolCallback cb, const char *us
 {
    Entry *ent = createLocalEntry(name);
    trashCache();
+   mFunctionSequence++;
 
    ent->mUsage = usage;
    ent->mMinArgs = minArgs;
@@ -539,6 +551,7 @@ void Namespace::activatePackage(StringTableEntry name)
 
    // kill the cache
    trashCache();
+   mFunctionSequence++;
 
    // find all the package namespaces...
    for(Namespace *walk = mNamespaceList; walk; walk = walk->mNext)
@@ -576,6 +589,7 @@ void Namespace::deactivatePackage(StringTableEntry name)
       return;
 
    trashCache();
+   mFunctionSequence++;
 
    for(j = mNumActivePackages - 1; j >= i; j--)
    {
@@ -136,6 +136,7 @@ public:
     const char *tabComplete(const char *prevText, S32 baseLen, bool fForward);
 
     static U32 mCacheSequence;
+    static U32 mFunctionSequence; ///< Incremented whenever the function a call resolves to may have changed.
     static DataChunker mCacheAllocator;
     static DataChunker mAllocator;
     static void trashCache();
@@ -27,6 +27,11 @@
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "console/scriptImage.h"
+
+#ifdef TORQUE_ALLOW_JOURNALING
+#include "game/gameInterface.h"
+#endif //TORQUE_ALLOW_JOURNALING
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
 #include <ifaddrs.h>
@@ -38,6 +43,10 @@ static char pathBuffer[1024];
 
 static U32 execDepth = 0;
 
+#ifdef TORQUE_ALLOW_JOURNALING
+static U32 journalDepth = 1;
+#endif //TORQUE_ALLOW_JOURNALING
+
 extern S32 QSORT_CALLBACK ACRCompare(const void *aptr, const void *bptr);
 
 ConsoleFunctionGroupBegin(MetaScripting, "Functions that let you manipulate the scripting engine programmatically.");
@@ -189,6 +198,50 @@ ConsoleFunctionWithDocs(compilePath, ConsoleString, 2, 2, ( path ))
    return result;
 }
 
+/*! Compiles all the scripts matching the path expression and links them into a single script image.
+    A loaded script image is used by exec in preference to individual DSOs.
+    @param imageFile The script image file to write.
+    @param path The path expression of the scripts to include in the image e.g. "^modules/\*.cs".
+    @return Returns the number of scripts that failed and the total number of scripts found as "failed total" or "-1 0" if the image could not be written.
+    @sa loadScriptImage
+*/
+ConsoleFunctionWithDocs(buildScriptImage, ConsoleString, 3, 3, ( imageFile, path ))
+{
+   U32 scriptCount;
+   U32 failedCount;
+   if ( !ScriptImage::build( argv[1], argv[2], scriptCount, failedCount ) )
+      return "-1 0";
+
+   char* result = Con::getReturnBuffer(32);
+   dSprintf( result, 32, "%d %d", failedCount, scriptCount );
+   return result;
+}
+
+/*! Loads a script image so that exec uses its compiled scripts.
+    @param imageFile The script image file to load.
+    @return Returns true if the image was loaded, false otherwise.
+    @sa buildScriptImage
+*/
+ConsoleFunctionWithDocs(loadScriptImage, ConsoleBool, 2, 2, ( imageFile ))
+{
+   const U32 startTime = Platform::getRealMilliseconds();
+
+   if ( !ScriptImage::load( argv[1] ) )
+      return false;
+
+   Con::printf( "Loaded script image '%s' in %d ms (%d scripts in %d images).", argv[1], Platform::getRealMilliseconds() - startTime, ScriptImage::getLoadedScriptCount(), ScriptImage::getLoadedImageCount() );
+   return true;
+}
+
+/*! Unloads a script image.
+    @param imageFile The script image file to unload.
+    @return Returns true if the image was unloaded, false if it was not loaded.
+*/
+ConsoleFunctionWithDocs(unloadScriptImage, ConsoleBool, 2, 2, ( imageFile ))
+{
+   return ScriptImage::unload( argv[1] );
+}
+
 static bool scriptExecutionEcho = false;
 /*! Whether to echo script file execution or not.
 */
@@ -384,6 +437,26 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
    }
 #endif //TORQUE_ALLOW_JOURNALING
 
+   // Is the compiled script available from a loaded script image?
+   if(compiled)
+   {
+      F32 st1 = (F32)Platform::getRealMilliseconds();
+
+      CodeBlock *code = ScriptImage::readCodeBlock(scriptFileName);
+      if(code)
+      {
+         code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+
+         F32 et1 = (F32)Platform::getRealMilliseconds();
+
+         if ( scriptExecutionEcho )
+            Con::printf("Loaded image script %s. Took %.0f ms", scriptFileName, et1 - st1);
+
+         execDepth--;
+         return true;
+      }
+   }
+
    // Ok, we let's try to load and compile the script.
    ResourceObject *rScr = ResourceManager->find(scriptFileName);
    ResourceObject *rCom = NULL;
@@ -622,6 +695,31 @@ ConsoleFunctionWithDocs(eval, ConsoleString, 2, 2, ( script ))
    return Con::evaluate(argv[1], false, NULL);
 }
 
+/*! Gets the statistics of the cache of compiled anonymous scripts used by eval and string commands.
+    The cache size is controlled by $Con::execCacheSize (zero disables the cache).
+    @return Returns the statistics as "hits misses evictions invalidations".
+    @sa clearExecCache
+*/
+ConsoleFunctionWithDocs(getExecCacheStats, ConsoleString, 1, 1, ())
+{
+   char* result = Con::getReturnBuffer(64);
+   dSprintf( result, 64, "%d %d %d %d", CodeBlock::smExecCacheHits, CodeBlock::smExecCacheMisses, CodeBlock::smExecCacheEvictions, CodeBlock::smExecCacheInvalidations );
+   return result;
+}
+
+/*! Discards all the cached compiled anonymous scripts and resets the cache statistics.
+    @return No return value.
+    @sa getExecCacheStats
+*/
+ConsoleFunctionWithDocs(clearExecCache, ConsoleVoid, 1, 1, ())
+{
+   CodeBlock::clearExecCache();
+   CodeBlock::smExecCacheHits = 0;
+   CodeBlock::smExecCacheMisses = 0;
+   CodeBlock::smExecCacheEvictions = 0;
+   CodeBlock::smExecCacheInvalidations = 0;
+}
+
 /*! Grabs the relevant data for the variable represented by the given string
     @param varName A String representing the variable to check
     @return Returns a string containing component data for the requested variable or an empty string if not found.
@@ -0,0 +1,474 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "console/scriptImage.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _CODEBLOCK_H_
+#include "console/codeBlock.h"
+#endif
+
+#ifndef _RESMANAGER_H_
+#include "io/resource/resourceManager.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+Vector<ScriptImage*> ScriptImage::smImages;
+ScriptImage::typeScriptHash ScriptImage::smScripts;
+
+//-----------------------------------------------------------------------------
+
+static void getCompiledFileName( const char* pScriptFile, char* pBuffer, U32 bufferSize )
+{
+   // NOTE:-   This must match the compiled file name used by "compile".
+   const char* pExtension = dStrrchr( pScriptFile, '.' );
+   bool isEditorScript = false;
+   if ( pExtension != NULL && (pExtension - pScriptFile) >= 3 )
+   {
+      if ( dStricmp( pExtension, ".cs" ) == 0 )
+         isEditorScript = dStricmp( pExtension - 3, ".ed.cs" ) == 0;
+      else if ( dStricmp( pExtension, ".gui" ) == 0 )
+         isEditorScript = dStricmp( pExtension - 3, ".ed.gui" ) == 0;
+   }
+
+   dStrcpyl( pBuffer, bufferSize, pScriptFile, isEditorScript ? ".edso" : ".dso", NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeImageString( Stream& stream, const char* pString )
+{
+   const U32 length = dStrlen( pString );
+   stream.write( length );
+   stream.write( length, pString );
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readImageU32( const U8*& pImage, const U8* pImageEnd, U32& value )
+{
+   if ( pImage + sizeof(U32) > pImageEnd )
+      return false;
+
+   dMemcpy( &value, pImage, sizeof(U32) );
+   value = convertLEndianToHost( value );
+   pImage += sizeof(U32);
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readImageString( const U8*& pImage, const U8* pImageEnd, StringTableEntry& string )
+{
+   U32 length;
+   if ( !readImageU32( pImage, pImageEnd, length ) || pImage + length > pImageEnd )
+      return false;
+
+   string = StringTable->insertn( (const char*)pImage, length );
+   pImage += length;
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptImage::ScriptImage( StringTableEntry imageFile ) :
+   mImageFile( imageFile ),
+   mpImageBuffer( NULL ),
+   mImageSize( 0 )
+{
+   VECTOR_SET_ASSOCIATION( mIdentifiers );
+   VECTOR_SET_ASSOCIATION( mScriptFiles );
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptImage::~ScriptImage()
+{
+   // Remove any scripts that are still located in this image.
+   for ( Vector<StringTableEntry>::iterator scriptItr = mScriptFiles.begin(); scriptItr != mScriptFiles.end(); ++scriptItr )
+   {
+      typeScriptHash::iterator locationItr = smScripts.find( *scriptItr );
+      if ( locationItr != smScripts.end() && locationItr->value.mpImage == this )
+         smScripts.erase( locationItr );
+   }
+
+   delete [] mpImageBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptImage::linkCodeBlock( Stream& compiledStream, Stream& imageStream, HashMap<StringTableEntry, U32>& identifierIndices, Vector<StringTableEntry>& identifiers )
+{
+   // NOTE:-   This reads the DSO in exactly the same order as "CodeBlock::read()" and writes
+   //          it in the order expected by the script image overload of "CodeBlock::read()".
+   U32 size, index;
+   Vector<char> globalStrings;
+   Vector<char> functionStrings;
+
+   // Copy the string tables.
+   compiledStream.read( &size );
+   globalStrings.setSize( size );
+   if ( size > 0 && !compiledStream.read( size, globalStrings.address() ) )
+      return false;
+   imageStream.write( size );
+   imageStream.write( size, globalStrings.address() );
+
+   compiledStream.read( &size );
+   functionStrings.setSize( size );
+   if ( size > 0 && !compiledStream.read( size, functionStrings.address() ) )
+      return false;
+   imageStream.write( size );
+   imageStream.write( size, functionStrings.address() );
+
+   // Copy the float tables.
+   for ( U32 tableIndex = 0; tableIndex < 2; ++tableIndex )
+   {
+      compiledStream.read( &size );
+      imageStream.write( size );
+      for ( index = 0; index < size; ++index )
+      {
+         F64 value;
+         compiledStream.read( &value );
+         imageStream.write( value );
+      }
+   }
+
+   // Expand the code stream.
+   U32 codeSize, lineBreakPairCount;
+   compiledStream.read( &codeSize );
+   compiledStream.read( &lineBreakPairCount );
+   imageStream.write( codeSize );
+   imageStream.write( lineBreakPairCount );
+
+   for ( index = 0; index < codeSize; ++index )
+   {
+      U8 byteCode;
+      U32 code;
+      compiledStream.read( &byteCode );
+      if ( byteCode == 0xFF )
+         compiledStream.read( &code );
+      else
+         code = byteCode;
+      imageStream.write( code );
+   }
+
+   for ( index = 0; index < lineBreakPairCount * 2; ++index )
+   {
+      U32 lineBreak;
+      compiledStream.read( &lineBreak );
+      imageStream.write( lineBreak );
+   }
+
+   // Link the identifiers into the image identifier table.
+   U32 identCount;
+   if ( !compiledStream.read( &identCount ) )
+      return false;
+   imageStream.write( identCount );
+
+   while ( identCount-- )
+   {
+      U32 offset;
+      compiledStream.read( &offset );
+
+      StringTableEntry identifier = offset < (U32)globalStrings.size() ? StringTable->insert( globalStrings.address() + offset ) : StringTable->EmptyString;
+
+      // Find the identifier index, adding it if it's new.
+      HashMap<StringTableEntry, U32>::iterator identifierItr = identifierIndices.find( identifier );
+      if ( identifierItr == identifierIndices.end() )
+      {
+         identifierItr = identifierIndices.insert( identifier, (U32)identifiers.size() );
+         identifiers.push_back( identifier );
+      }
+      imageStream.write( identifierItr->value );
+
+      U32 count;
+      compiledStream.read( &count );
+      imageStream.write( count );
+      while ( count-- )
+      {
+         U32 ip;
+         compiledStream.read( &ip );
+         imageStream.write( ip );
+      }
+   }
+
+   return compiledStream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptImage::build( const char* pImageFile, const char* pPathExpression, U32& scriptCount, U32& failedCount )
+{
+   scriptCount = 0;
+   failedCount = 0;
+
+   // Open the image file.
+   char imagePathBuffer[1024];
+   Con::expandPath( imagePathBuffer, sizeof(imagePathBuffer), pImageFile );
+   FileStream imageStream;
+   if ( !ResourceManager->openFileForWrite( imageStream, imagePathBuffer ) )
+   {
+      Con::warnf( "ScriptImage::build() - Could not open script image '%s' for write.", imagePathBuffer );
+      return false;
+   }
+
+   // Write the header.
+   imageStream.write( Signature );
+   imageStream.write( DSO_VERSION );
+
+   HashMap<StringTableEntry, U32> identifierIndices;
+   Vector<StringTableEntry> identifiers;
+   Vector<StringTableEntry> scriptFiles;
+   Vector<U32> scriptOffsets;
+
+   char pathExpressionBuffer[1024];
+   Con::expandPath( pathExpressionBuffer, sizeof(pathExpressionBuffer), pPathExpression );
+
+   ResourceObject* pMatch = NULL;
+   const char* pMatchFile = NULL;
+   while ( (pMatch = ResourceManager->findMatch( pathExpressionBuffer, &pMatchFile, pMatch )) )
+   {
+      scriptCount++;
+
+      // Compile the script.
+      char scriptFileBuffer[1024];
+      dStrcpy( scriptFileBuffer, pMatchFile );
+      Con::executef( 2, "compile", scriptFileBuffer );
+
+      // Open the compiled script.
+      char compiledFileBuffer[1024];
+      getCompiledFileName( scriptFileBuffer, compiledFileBuffer, sizeof(compiledFileBuffer) );
+      FileStream compiledStream;
+      U32 version = 0;
+      if ( !compiledStream.open( compiledFileBuffer, FileStream::Read ) || !compiledStream.read( &version ) || version != DSO_VERSION )
+      {
+         Con::warnf( "ScriptImage::build() - Could not read the compiled script '%s'.", compiledFileBuffer );
+         failedCount++;
+         continue;
+      }
+
+      // Link the compiled script into the image.
+      const U32 scriptOffset = imageStream.getPosition();
+      if ( !linkCodeBlock( compiledStream, imageStream, identifierIndices, identifiers ) )
+      {
+         // The partial code-block is left in the image but it is never referenced.
+         Con::warnf( "ScriptImage::build() - Could not link the compiled script '%s'.", compiledFileBuffer );
+         failedCount++;
+         continue;
+      }
+
+      // Store the script relative to the main script directory so the image is relocatable.
+      scriptFiles.push_back( Platform::makeRelativePathName( scriptFileBuffer, Platform::getMainDotCsDir() ) );
+      scriptOffsets.push_back( scriptOffset );
+   }
+
+   // Write the directory.
+   const U32 directoryOffset = imageStream.getPosition();
+
+   imageStream.write( (U32)identifiers.size() );
+   for ( Vector<StringTableEntry>::iterator identifierItr = identifiers.begin(); identifierItr != identifiers.end(); ++identifierItr )
+      writeImageString( imageStream, *identifierItr );
+
+   imageStream.write( (U32)scriptFiles.size() );
+   for ( S32 index = 0; index < scriptFiles.size(); ++index )
+   {
+      writeImageString( imageStream, scriptFiles[index] );
+      imageStream.write( scriptOffsets[index] );
+   }
+
+   // Write the directory offset last so the image can be written in a single pass.
+   imageStream.write( directoryOffset );
+
+   const bool status = imageStream.getStatus() == Stream::Ok;
+   imageStream.close();
+
+   return status;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptImage::parseDirectory( void )
+{
+   const U8* pImageEnd = mpImageBuffer + mImageSize;
+
+   // Check the header.
+   U32 signature, version, directoryOffset;
+   const U8* pImage = mpImageBuffer;
+   if ( !readImageU32( pImage, pImageEnd, signature ) || signature != Signature )
+   {
+      Con::warnf( "ScriptImage::load() - '%s' is not a script image.", mImageFile );
+      return false;
+   }
+   if ( !readImageU32( pImage, pImageEnd, version ) || version != DSO_VERSION )
+   {
+      Con::warnf( "ScriptImage::load() - Found an old script image (%s, ver %d < %d), ignoring.", mImageFile, version, DSO_VERSION );
+      return false;
+   }
+
+   // Fetch the directory.
+   pImage = pImageEnd - sizeof(U32);
+   if ( mImageSize < sizeof(U32) * 3 || !readImageU32( pImage, pImageEnd, directoryOffset ) || directoryOffset >= mImageSize )
+      return false;
+   pImage = mpImageBuffer + directoryOffset;
+
+   // Intern the identifiers.
+   U32 count;
+   if ( !readImageU32( pImage, pImageEnd, count ) )
+      return false;
+   mIdentifiers.setSize( count );
+   for ( U32 index = 0; index < count; ++index )
+   {
+      if ( !readImageString( pImage, pImageEnd, mIdentifiers[index] ) )
+         return false;
+   }
+
+   // Register the scripts.
+   if ( !readImageU32( pImage, pImageEnd, count ) )
+      return false;
+   mScriptFiles.reserve( count );
+   for ( U32 index = 0; index < count; ++index )
+   {
+      StringTableEntry relativeScriptFile;
+      U32 offset;
+      if ( !readImageString( pImage, pImageEnd, relativeScriptFile ) || !readImageU32( pImage, pImageEnd, offset ) || offset >= directoryOffset )
+         return false;
+
+      char scriptFileBuffer[1024];
+      Platform::makeFullPathName( relativeScriptFile, scriptFileBuffer, sizeof(scriptFileBuffer), Platform::getMainDotCsDir() );
+      StringTableEntry scriptFile = StringTable->insert( scriptFileBuffer );
+      mScriptFiles.push_back( scriptFile );
+
+      ScriptLocation& location = smScripts[scriptFile];
+      location.mpImage = this;
+      location.mOffset = offset;
+   }
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptImage::load( const char* pImageFile )
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(ScriptImage_Load);
+
+   char imagePathBuffer[1024];
+   Con::expandPath( imagePathBuffer, sizeof(imagePathBuffer), pImageFile );
+   StringTableEntry imageFile = StringTable->insert( imagePathBuffer );
+
+   // Replace any image already loaded from this file.
+   unload( imageFile );
+
+   ResourceObject* pResource = ResourceManager->find( imageFile );
+   Stream* pStream = pResource == NULL ? NULL : ResourceManager->openStream( pResource );
+   if ( pStream == NULL )
+   {
+      Con::warnf( "ScriptImage::load() - Could not open script image '%s'.", imageFile );
+      return false;
+   }
+
+   // Read the whole image in one go.
+   ScriptImage* pScriptImage = new ScriptImage( imageFile );
+   pResource->getFileTimes( NULL, &pScriptImage->mModifyTime );
+   pScriptImage->mImageSize = ResourceManager->getSize( imageFile );
+   pScriptImage->mpImageBuffer = new U8[pScriptImage->mImageSize];
+   const bool imageRead = pStream->read( pScriptImage->mImageSize, pScriptImage->mpImageBuffer );
+   ResourceManager->closeStream( pStream );
+
+   if ( !imageRead || !pScriptImage->parseDirectory() )
+   {
+      Con::warnf( "ScriptImage::load() - Could not read script image '%s'.", imageFile );
+      delete pScriptImage;
+      return false;
+   }
+
+   smImages.push_back( pScriptImage );
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptImage::unload( const char* pImageFile )
+{
+   char imagePathBuffer[1024];
+   Con::expandPath( imagePathBuffer, sizeof(imagePathBuffer), pImageFile );
+   StringTableEntry imageFile = StringTable->insert( imagePathBuffer );
+
+   for ( Vector<ScriptImage*>::iterator imageItr = smImages.begin(); imageItr != smImages.end(); ++imageItr )
+   {
+      if ( (*imageItr)->mImageFile != imageFile )
+         continue;
+
+      delete *imageItr;
+      smImages.erase( imageItr );
+      return true;
+   }
+
+   return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptImage::unloadAll( void )
+{
+   while ( smImages.size() > 0 )
+   {
+      delete smImages.last();
+      smImages.pop_back();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+CodeBlock* ScriptImage::readCodeBlock( StringTableEntry scriptFile )
+{
+   // Finish if the script isn't in a loaded image.
+   typeScriptHash::iterator locationItr = smScripts.find( scriptFile );
+   if ( locationItr == smScripts.end() )
+      return NULL;
+
+   ScriptImage* pScriptImage = locationItr->value.mpImage;
+
+   // Ignore the image if the script source has changed since it was built.
+   ResourceObject* pScriptResource = ResourceManager->find( scriptFile );
+   if ( pScriptResource != NULL )
+   {
+      FileTime scriptModifyTime;
+      pScriptResource->getFileTimes( NULL, &scriptModifyTime );
+      if ( Platform::compareFileTimes( pScriptImage->mModifyTime, scriptModifyTime ) < 0 )
+         return NULL;
+   }
+
+   CodeBlock* pCodeBlock = new CodeBlock();
+   pCodeBlock->read( scriptFile, pScriptImage->mpImageBuffer + locationItr->value.mOffset, pScriptImage->mIdentifiers.address() );
+   return pCodeBlock;
+}
@@ -0,0 +1,103 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCRIPT_IMAGE_H_
+#define _SCRIPT_IMAGE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+class CodeBlock;
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// A script image bundles the compiled code-blocks of many scripts into a single file.
+///
+/// The identifiers of every code-block are de-duplicated into a single table which is
+/// interned into the string table once when the image is loaded.  Each code-block is
+/// stored exactly as it is laid out in memory so reading it is a handful of copies
+/// followed by patching its identifier references.
+///
+/// Scripts found in a loaded image are used by "exec" in preference to their DSO as
+/// long as the script source is not newer than the image.
+class ScriptImage
+{
+public:
+   /// The signature of a script image file ("TSIM").
+   static const U32 Signature = 0x4D495354;
+
+private:
+   struct ScriptLocation
+   {
+      ScriptImage*   mpImage;
+      U32            mOffset;
+   };
+
+   typedef HashMap<StringTableEntry, ScriptLocation> typeScriptHash;
+
+   static Vector<ScriptImage*>   smImages;
+   static typeScriptHash         smScripts;
+
+   StringTableEntry              mImageFile;
+   FileTime                      mModifyTime;
+   U8*                           mpImageBuffer;
+   U32                           mImageSize;
+   Vector<StringTableEntry>      mIdentifiers;
+   Vector<StringTableEntry>      mScriptFiles;
+
+   ScriptImage( StringTableEntry imageFile );
+   ~ScriptImage();
+
+   bool parseDirectory( void );
+   static bool linkCodeBlock( Stream& compiledStream, Stream& imageStream, HashMap<StringTableEntry, U32>& identifierIndices, Vector<StringTableEntry>& identifiers );
+
+public:
+   /// Compiles every script matching the path expression and links them into a script image.
+   /// @return Whether the image was written.
+   static bool build( const char* pImageFile, const char* pPathExpression, U32& scriptCount, U32& failedCount );
+
+   /// Loads a script image, replacing any image already loaded from the same file.
+   static bool load( const char* pImageFile );
+
+   /// Unloads a script image.
+   static bool unload( const char* pImageFile );
+   static void unloadAll( void );
+
+   /// Reads the code-block of a script from the loaded images.
+   /// @return The code-block or NULL if the script is not in a loaded image or the image is out-of-date.
+   static CodeBlock* readCodeBlock( StringTableEntry scriptFile );
+
+   static inline U32 getLoadedImageCount( void ) { return (U32)smImages.size(); }
+   static inline U32 getLoadedScriptCount( void ) { return (U32)smScripts.size(); }
+};
+
+#endif // _SCRIPT_IMAGE_H_
@@ -537,6 +537,10 @@ void Profiler::dump()
       char depthBuffer[MaxStackDepth * 2 + 1];
       depthBuffer[0] = 0;
       profilerDataDumpRecurse(mCurrentProfilerData, depthBuffer, 0, totalTime);
+
+      Con::printf("");
+      dDumpMemoryTags();
+
       mEnabled = enableSave;
       mStackDepth--;
    }
@@ -577,6 +581,17 @@ void Profiler::dump()
       char depthBuffer[MaxStackDepth * 2 + 1];
       depthBuffer[0] = 0;
       profilerDataDumpRecurseFile(mCurrentProfilerData, depthBuffer, 0, totalTime, fws);
+
+      dStrcpy(buffer, "\nMemory Tags:\nTag      Live Bytes   Peak Bytes   Allocs #\n");
+      fws.write(dStrlen(buffer), buffer);
+      for(U32 tag = 0; tag < MemoryTag_Count; tag++)
+      {
+         MemoryTagStats stats;
+         dGetMemoryTagStats((MemoryTag)tag, stats);
+         dSprintf(buffer, 1023, "%-8s %10u %12u %10u\n", dGetMemoryTagName((MemoryTag)tag), stats.mLiveBytes, stats.mPeakBytes, stats.mAllocationCount);
+         fws.write(dStrlen(buffer), buffer);
+      }
+
       mEnabled = enableSave;
       mStackDepth--;
 
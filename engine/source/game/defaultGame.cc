@@ -58,6 +58,8 @@
 #include "platform/nativeDialogs/msgBox.h"
 #include "platform/nativeDialogs/fileDialog.h"
 #include "memory/safeDelete.h"
+#include "platform/threads/workerPool.h"
+#include "game/frameScheduler.h"
 
 #include <stdio.h>
 
@@ -151,6 +153,8 @@ bool initializeLibraries()
 #endif	
    
     Platform::initConsole();
+    WorkerPool::init();
+    FrameScheduler::init();
     NetStringTable::create();
    
     TelnetConsole::create();
@@ -179,6 +183,12 @@ void shutdownLibraries()
     if (ResourceManager)
         ResourceManager->purge();
 
+    // Stop the worker threads.
+    WorkerPool::shutdown();
+
+    // Remove the idle tasks.
+    FrameScheduler::shutdown();
+
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
 
@@ -247,6 +257,9 @@ bool initializeGame(int argc, const char **argv)
         argc -= 2;
     }
 
+    // Start any journal before the scripts run.
+    Game->processJournalCommandLine(argc, argv);
+
     // Scan executable location and all sub-directories.
     ResourceManager->setWriteablePath(Platform::getCurrentDirectory());
     ResourceManager->addPath( Platform::getCurrentDirectory() );
@@ -576,6 +589,7 @@ void DefaultGame::processQuitEvent()
 void DefaultGame::processTimeEvent(TimeEvent *event)
 {
     PROFILE_START(ProcessTimeEvent);
+   const U32 frameStartTime = Platform::getRealMilliseconds();
    U32 elapsedTime = event->elapsedTime;
 
    if(elapsedTime > 1024)
@@ -595,6 +609,9 @@ void DefaultGame::processTimeEvent(TimeEvent *event)
        elapsedTime = elapsedTime;
    }
 
+   // Limit the catch-up ticks so that a slow frame does not cause slower ones.
+   elapsedTime = FrameScheduler::limitElapsedTime(elapsedTime);
+
    Platform::advanceTime(elapsedTime);
    bool tickPass;
 
@@ -671,8 +688,12 @@ AndroidProfilerStart("SERVER_PROC");
    PROFILE_START(ClientNetProcess);
       GNet->processClient();
    PROFILE_END();
+
+   const U32 renderStartTime = Platform::getRealMilliseconds();
+   FrameScheduler::recordTiming(FrameScheduler::TickTiming, renderStartTime - frameStartTime);
     
-   if(Canvas && TextureManager::mDGLRender)
+   // A headless journal playback only measures the simulation.
+   if(Canvas && TextureManager::mDGLRender && !isJournalHeadless())
    {
 #ifdef TORQUE_OS_IOS_PROFILE	   
 iPhoneProfilerStart("GL_RENDER");
@@ -688,6 +709,7 @@ AndroidProfilerStart("GL_RENDER");
       Canvas->renderFrame(preRenderOnly);
       PROFILE_END();
       gFrameCount++;
+      FrameScheduler::recordTiming(FrameScheduler::RenderTiming, Platform::getRealMilliseconds() - renderStartTime);
 #ifdef TORQUE_OS_IOS_PROFILE
 iPhoneProfilerEnd("GL_RENDER");
 #endif
@@ -700,6 +722,13 @@ AndroidProfilerEnd("GL_RENDER");
 #ifdef TORQUE_ALLOW_MUSICPLAYER
     updateVolume();
 #endif
+
+   // Spend any spare time in the frame on background work.
+   PROFILE_START(IdleTasks);
+   FrameScheduler::processIdleTasks(frameStartTime);
+   PROFILE_END();
+
+   FrameScheduler::recordTiming(FrameScheduler::FrameTiming, Platform::getRealMilliseconds() - frameStartTime);
    PROFILE_END();
 }
 
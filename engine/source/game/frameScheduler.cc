@@ -0,0 +1,333 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "game/frameScheduler.h"
+#include "game/gameInterface.h"
+#include "platform/platform.h"
+#include "platform/Tickable.h"
+#include "collection/vector.h"
+#include "console/console.h"
+#include "console/consoleTypes.h"
+#include "sim/simBase.h"
+#include "sim/simConsoleEvent.h"
+
+// Script binding.
+#include "game/frameScheduler_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+static S32 sgMaxCatchUpTicks = 8;
+static S32 sgFrameBudget = 16;
+static S32 sgJournalIdleSlices = 1;
+
+static Vector<FrameIdleTask*> sgIdleTasks;
+static U32 sgNextIdleTask = 0;
+
+static U32 sgTimingHistograms[FrameScheduler::TimingCategoryCount][FrameScheduler::HistogramBucketCount];
+static U32 sgFrameCount = 0;
+static U32 sgDroppedTime = 0;
+
+static const char* sgTimingCategoryNames[FrameScheduler::TimingCategoryCount] = { "Tick", "Render", "Idle", "Frame" };
+
+//-----------------------------------------------------------------------------
+
+struct IdleEvent
+{
+   SimObjectId mObjectId;
+   SimEvent*   mpEvent;
+};
+
+static Vector<IdleEvent> sgIdleEvents;
+static U32 sgNextIdleEvent = 0;
+
+//-----------------------------------------------------------------------------
+
+/// Processes the posted idle events, one per slice.
+class IdleEventTask : public FrameIdleTask
+{
+public:
+   virtual bool processIdleTask( void )
+   {
+      if ( sgNextIdleEvent >= (U32)sgIdleEvents.size() )
+         return false;
+
+      // Fetch the next event.
+      IdleEvent idleEvent = sgIdleEvents[sgNextIdleEvent++];
+
+      // Process it if the object still exists.
+      // NOTE: Processing may post further idle events.
+      SimObject* pObject = Sim::findObject( idleEvent.mObjectId );
+      if ( pObject != NULL )
+         idleEvent.mpEvent->process( pObject );
+
+      delete idleEvent.mpEvent;
+
+      // Reset the queue when it is empty.
+      if ( sgNextIdleEvent >= (U32)sgIdleEvents.size() )
+      {
+         sgIdleEvents.clear();
+         sgNextIdleEvent = 0;
+         return false;
+      }
+
+      return true;
+   }
+};
+
+static IdleEventTask sgIdleEventTask;
+
+//-----------------------------------------------------------------------------
+
+/// Delete the pending idle events whose objects have been deleted so that they
+/// do not accumulate whilst there is no idle time to process them.  The events
+/// already processed are discarded too.
+static void pruneIdleEvents( void )
+{
+   U32 keepCount = 0;
+   for ( U32 index = sgNextIdleEvent; index < (U32)sgIdleEvents.size(); ++index )
+   {
+      IdleEvent& idleEvent = sgIdleEvents[index];
+
+      if ( Sim::findObject( idleEvent.mObjectId ) == NULL )
+      {
+         delete idleEvent.mpEvent;
+         continue;
+      }
+
+      // Keep the event order.
+      sgIdleEvents[keepCount++] = idleEvent;
+   }
+
+   sgIdleEvents.setSize( keepCount );
+   sgNextIdleEvent = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::init( void )
+{
+   Con::addVariable( "pref::Game::MaxCatchUpTicks", TypeS32, &sgMaxCatchUpTicks );
+   Con::addVariable( "pref::Game::FrameBudget", TypeS32, &sgFrameBudget );
+   Con::addVariable( "pref::Game::JournalIdleSlices", TypeS32, &sgJournalIdleSlices );
+
+   resetTimings();
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::shutdown( void )
+{
+   sgIdleTasks.clear();
+   sgNextIdleTask = 0;
+
+   // Delete any pending idle events.
+   for ( U32 index = sgNextIdleEvent; index < (U32)sgIdleEvents.size(); ++index )
+      delete sgIdleEvents[index].mpEvent;
+
+   sgIdleEvents.clear();
+   sgNextIdleEvent = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameScheduler::limitElapsedTime( const U32 elapsedTime )
+{
+   // A non-positive limit disables it.
+   if ( sgMaxCatchUpTicks <= 0 )
+      return elapsedTime;
+
+   const U32 maxElapsedTime = (U32)sgMaxCatchUpTicks * Tickable::smTickMs;
+   if ( elapsedTime <= maxElapsedTime )
+      return elapsedTime;
+
+   // Drop the time we cannot catch up with.
+   sgDroppedTime += elapsedTime - maxElapsedTime;
+   return maxElapsedTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::addIdleTask( FrameIdleTask* pIdleTask )
+{
+   AssertFatal( pIdleTask != NULL, "FrameScheduler::addIdleTask() - Cannot add a NULL idle task." );
+
+   for ( S32 index = 0; index < sgIdleTasks.size(); ++index )
+   {
+      if ( sgIdleTasks[index] == pIdleTask )
+         return;
+   }
+
+   sgIdleTasks.push_back( pIdleTask );
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::removeIdleTask( FrameIdleTask* pIdleTask )
+{
+   for ( S32 index = 0; index < sgIdleTasks.size(); ++index )
+   {
+      if ( sgIdleTasks[index] == pIdleTask )
+      {
+         sgIdleTasks.erase( index );
+         return;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::processIdleTasks( const U32 frameStartTime )
+{
+   const U32 idleStartTime = Platform::getRealMilliseconds();
+
+   pruneIdleEvents();
+
+   // Journaled sessions must not depend on the time taken.
+   const bool fixedSlices = Game->isJournalReading() || Game->isJournalWriting();
+
+   U32 slices = 0;
+   U32 tasksWithoutWork = 0;
+   while ( sgIdleTasks.size() > 0 )
+   {
+      // Always perform a slice so that the idle tasks cannot starve.
+      if ( fixedSlices )
+      {
+         if ( slices >= (U32)getMax( sgJournalIdleSlices, 1 ) )
+            break;
+      }
+      else if ( slices > 0 && (S32)(Platform::getRealMilliseconds() - frameStartTime) >= sgFrameBudget )
+      {
+         break;
+      }
+
+      // Fetch the next task.
+      if ( sgNextIdleTask >= (U32)sgIdleTasks.size() )
+         sgNextIdleTask = 0;
+      FrameIdleTask* pIdleTask = sgIdleTasks[sgNextIdleTask++];
+
+      slices++;
+
+      // Finish when none of the tasks have any work.
+      if ( pIdleTask->processIdleTask() )
+         tasksWithoutWork = 0;
+      else if ( ++tasksWithoutWork >= (U32)sgIdleTasks.size() )
+         break;
+   }
+
+   recordTiming( IdleTiming, Platform::getRealMilliseconds() - idleStartTime );
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::postIdleEvent( SimObject* pObject, SimEvent* pEvent )
+{
+   AssertFatal( pObject != NULL && pEvent != NULL, "FrameScheduler::postIdleEvent() - Invalid object or event." );
+
+   IdleEvent idleEvent;
+   idleEvent.mObjectId = pObject->getId();
+   idleEvent.mpEvent = pEvent;
+   sgIdleEvents.push_back( idleEvent );
+
+   addIdleTask( &sgIdleEventTask );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameScheduler::getIdleEventCount( void )
+{
+   return (U32)sgIdleEvents.size() - sgNextIdleEvent;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::recordTiming( const TimingCategory category, const U32 milliseconds )
+{
+   AssertFatal( category < TimingCategoryCount, "FrameScheduler::recordTiming() - Invalid timing category." );
+
+   // Find the power-of-two bucket.
+   U32 bucket = 0;
+   U32 bucketLimit = 1;
+   while ( bucket < HistogramBucketCount-1 && milliseconds >= bucketLimit )
+   {
+      bucket++;
+      bucketLimit <<= 1;
+   }
+
+   sgTimingHistograms[category][bucket]++;
+
+   if ( category == FrameTiming )
+      sgFrameCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameScheduler::getHistogramCount( const TimingCategory category, const U32 bucket )
+{
+   AssertFatal( category < TimingCategoryCount && bucket < HistogramBucketCount, "FrameScheduler::getHistogramCount() - Invalid histogram bucket." );
+
+   return sgTimingHistograms[category][bucket];
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameScheduler::getFrameCount( void )
+{
+   return sgFrameCount;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameScheduler::getDroppedTime( void )
+{
+   return sgDroppedTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameScheduler::resetTimings( void )
+{
+   dMemset( sgTimingHistograms, 0, sizeof(sgTimingHistograms) );
+   sgFrameCount = 0;
+   sgDroppedTime = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* FrameScheduler::getTimingCategoryName( const TimingCategory category )
+{
+   AssertFatal( category < TimingCategoryCount, "FrameScheduler::getTimingCategoryName() - Invalid timing category." );
+
+   return sgTimingCategoryNames[category];
+}
+
+//-----------------------------------------------------------------------------
+
+FrameScheduler::TimingCategory FrameScheduler::getTimingCategoryEnum( const char* pName )
+{
+   for ( U32 index = 0; index < TimingCategoryCount; ++index )
+   {
+      if ( dStricmp( pName, sgTimingCategoryNames[index] ) == 0 )
+         return (TimingCategory)index;
+   }
+
+   return TimingCategoryCount;
+}
@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _FRAME_SCHEDULER_H_
+#define _FRAME_SCHEDULER_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+class SimObject;
+class SimEvent;
+
+//-----------------------------------------------------------------------------
+
+/// Background work that is performed in small slices using the spare time in a frame.
+class FrameIdleTask
+{
+public:
+   virtual ~FrameIdleTask() {}
+
+   /// Perform a small slice of work.
+   /// @return Whether more work remains.
+   virtual bool processIdleTask( void ) = 0;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Schedules the work within each main-loop frame.
+///
+/// The time the simulation is advanced by in a single frame is limited to
+/// "$pref::Game::MaxCatchUpTicks" ticks so that a slow frame cannot cause an ever
+/// increasing number of catch-up ticks.  The time taken by the ticks and the
+/// rendering is recorded and any time left within "$pref::Game::FrameBudget"
+/// milliseconds is spent on the registered idle tasks.
+///
+/// When journaling, the idle tasks are given a fixed number of slices per frame
+/// so that playback remains deterministic.
+class FrameScheduler
+{
+public:
+   enum TimingCategory
+   {
+      TickTiming,
+      RenderTiming,
+      IdleTiming,
+      FrameTiming,
+
+      TimingCategoryCount
+   };
+
+   /// Histogram buckets are in milliseconds: <1, <2, <4, <8, <16, <32, <64 and 64+.
+   enum { HistogramBucketCount = 8 };
+
+   /// Register the console preferences.
+   static void init( void );
+
+   /// Remove all the idle tasks.
+   static void shutdown( void );
+
+   /// Limit the elapsed time of a frame to the maximum number of catch-up ticks.
+   static U32 limitElapsedTime( const U32 elapsedTime );
+
+   /// Idle tasks.
+   static void addIdleTask( FrameIdleTask* pIdleTask );
+   static void removeIdleTask( FrameIdleTask* pIdleTask );
+
+   /// Spend the remaining frame budget on the idle tasks.
+   static void processIdleTasks( const U32 frameStartTime );
+
+   /// Process a Sim event on an object when there is idle time.  The event is
+   /// deleted once processed or if the object is deleted first.
+   static void postIdleEvent( SimObject* pObject, SimEvent* pEvent );
+
+   /// The number of idle events waiting to be processed.
+   static U32 getIdleEventCount( void );
+
+   /// Timing.
+   static void recordTiming( const TimingCategory category, const U32 milliseconds );
+   static U32 getHistogramCount( const TimingCategory category, const U32 bucket );
+   static U32 getFrameCount( void );
+   static U32 getDroppedTime( void );
+   static void resetTimings( void );
+   static const char* getTimingCategoryName( const TimingCategory category );
+   static TimingCategory getTimingCategoryEnum( const char* pName );
+};
+
+#endif // _FRAME_SCHEDULER_H_
@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup FrameSchedulerFunctions Frame Scheduler
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets the histogram of the time taken by part of each frame.
+    The buckets are in milliseconds: <1, <2, <4, <8, <16, <32, <64 and 64+.
+    @param category The part of the frame i.e. Tick, Render, Idle or Frame.
+    @return The number of frames in each bucket separated by spaces.
+    @sa getFrameTimingStats, resetFrameTimings
+*/
+ConsoleFunctionWithDocs( getFrameTimingHistogram, ConsoleString, 2, 2, (category) )
+{
+    // Fetch the timing category.
+    const FrameScheduler::TimingCategory category = FrameScheduler::getTimingCategoryEnum( argv[1] );
+
+    if ( category == FrameScheduler::TimingCategoryCount )
+    {
+        Con::warnf( "getFrameTimingHistogram() - Invalid timing category '%s'.", argv[1] );
+        return StringTable->EmptyString;
+    }
+
+    const U32 bufferSize = 128;
+    char* pBuffer = Con::getReturnBuffer( bufferSize );
+    U32 bufferOffset = 0;
+    for ( U32 bucket = 0; bucket < FrameScheduler::HistogramBucketCount; ++bucket )
+    {
+        bufferOffset += dSprintf( pBuffer + bufferOffset, bufferSize - bufferOffset, bucket == 0 ? "%u" : " %u", FrameScheduler::getHistogramCount( category, bucket ) );
+    }
+
+    return pBuffer;
+}
+
+/*! Gets the frame scheduler statistics.
+    @return The number of frames timed and the total milliseconds dropped by limiting the catch-up ticks, separated by a space.
+    @sa getFrameTimingHistogram, resetFrameTimings
+*/
+ConsoleFunctionWithDocs( getFrameTimingStats, ConsoleString, 1, 1, () )
+{
+    char* pBuffer = Con::getReturnBuffer( 32 );
+    dSprintf( pBuffer, 32, "%u %u", FrameScheduler::getFrameCount(), FrameScheduler::getDroppedTime() );
+    return pBuffer;
+}
+
+/*! Resets the frame timing histograms and statistics.
+    @return No return value.
+    @sa getFrameTimingHistogram, getFrameTimingStats
+*/
+ConsoleFunctionWithDocs( resetFrameTimings, ConsoleVoid, 1, 1, () )
+{
+    FrameScheduler::resetTimings();
+}
+
+/*! Schedules a function to be called when there is spare time in a frame.
+    Idle calls are made in the order they were scheduled, using the time left in "$pref::Game::FrameBudget".
+    @param objID The object the call depends on or 0.  The call is not made if the object is deleted first.
+    @param functionName The function to call.
+    @param arg0...argN The arguments to pass to the function.
+    @return No return value.
+    @sa schedule
+*/
+ConsoleFunctionWithDocs( scheduleIdle, ConsoleVoid, 3, 0, ( objID || 0 , functionName, arg0, ... , argN ) )
+{
+    SimObject* pRefObject = Sim::findObject( argv[1] );
+    if ( pRefObject == NULL )
+    {
+        if ( argv[1][0] != '0' )
+            return;
+
+        pRefObject = Sim::getRootGroup();
+    }
+
+    FrameScheduler::postIdleEvent( pRefObject, new SimConsoleEvent( argc - 2, argv + 2, false ) );
+}
+
+/*! @} */ // group FrameSchedulerFunctions
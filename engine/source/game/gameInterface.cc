@@ -26,6 +26,7 @@
 #include "io/fileStream.h"
 #include "console/console.h"
 #include "platform/threads/mutex.h"
+#include "math/mRandom.h"
 
 // Script binding.
 #include "game/gameInterface_ScriptBinding.h"
@@ -33,6 +34,11 @@
 GameInterface *Game = NULL;
 void *gGameEventQueueMutex = NULL;
 FileStream gJournalStream;
+static FileStream gJournalTimingStream;
+
+// Journal identification.
+static const U32 JournalMagic = 0x4C4E4A54; // "TJNL"
+static const U32 JournalVersion = 2;
 
 #ifdef TORQUE_DEBUG
 static U32 sReentrantCount = 0;
@@ -52,6 +58,13 @@ GameInterface::GameInterface()
    AssertFatal(Game == NULL, "ERROR: Multiple games declared.");
    Game = this;
    mJournalMode = JournalOff;
+   mJournalBreak = false;
+   mJournalHeadless = false;
+   mJournalFrameCount = 0;
+   mJournalTotalTime = 0;
+   mJournalMaxFrameTime = 0;
+   mJournalFrameStartTime = 0;
+   mJournalFrameStarted = false;
    mRunning = true;
    mRequiresRestart = false;
    if(!gGameEventQueueMutex)
@@ -74,6 +87,20 @@ void GameInterface::processEvent(Event *event)
    AssertFatal(sReentrantCount == 1, "Error! ProcessEvent is NOT re-entrant.");
 #endif
 
+#ifdef TORQUE_ALLOW_JOURNALING
+   // Record the event as it is processed so that any values read whilst
+   // processing it follow it in the journal.
+   if(mJournalMode == JournalSave)
+   {
+      AssertFatal(event->type <= U8_MAX && event->size >= sizeof(Event), "GameInterface::processEvent() - Invalid event.");
+      const U16 payloadSize = U16(event->size - sizeof(Event));
+      gJournalStream.write(U8(JournalRecordEvent));
+      gJournalStream.write(U8(event->type));
+      gJournalStream.write(payloadSize);
+      gJournalStream.write(payloadSize, ((const U8*)event) + sizeof(Event));
+   }
+#endif //TORQUE_ALLOW_JOURNALING
+
    switch(event->type)
    {
       case PacketReceiveEventType:
@@ -125,14 +152,6 @@ void GameInterface::postEvent(Event &event)
    // Only one thread can post at a time.
    Mutex::lockMutex(gGameEventQueueMutex);
 
-#ifdef TORQUE_ALLOW_JOURNALING
-   if(mJournalMode == JournalSave)
-   {
-      gJournalStream.write(event.size, &event);
-      gJournalStream.flush();
-   }
-#endif //TORQUE_ALLOW_JOURNALING 
-
    // Create a deep copy of event, and save a pointer to the copy in a vector.
    Event* copy = (Event*)dMalloc(event.size);
    dMemcpy(copy, &event, event.size);
@@ -172,44 +191,242 @@ void GameInterface::processEvents()
 void GameInterface::journalProcess()
 {
 #ifdef TORQUE_ALLOW_JOURNALING
-   if(mJournalMode == JournalPlay)
-   {
-      ReadEvent journalReadEvent;
-// used to be:
-//      if(gJournalStream.read(&journalReadEvent.type))
-//        if(gJournalStream.read(&journalReadEvent.size))
-// for proper non-endian stream handling, the read-ins should match the write-out by using bytestreams read:
-      if(gJournalStream.read(sizeof(Event), &journalReadEvent))
-      {
-         if(gJournalStream.read(journalReadEvent.size - sizeof(Event), &journalReadEvent.data))
-         {
-            if(gJournalStream.getPosition() == gJournalStream.getStreamSize() && mJournalBreak)
-               Platform::debugBreak();
-            processEvent(&journalReadEvent);
-            return;
-         }
-      }
+   if(mJournalMode == JournalSave)
+   {
+      // Mark the start of the frame.  The previous frame is flushed so little is lost if we crash.
+      gJournalStream.write(U8(JournalRecordFrame));
+      gJournalStream.Flush();
+      return;
+   }
+
+   if(mJournalMode != JournalPlay)
+      return;
+
+   // A frame runs from the start of its events until the next call so it also covers the
+   // tick and render that followed them.  Time the previous frame now that it has finished.
+   const U32 currentTime = Platform::getRealMilliseconds();
+   if(mJournalFrameStarted)
+      recordJournalFrameTime(currentTime - mJournalFrameStartTime);
+
+   // Each frame starts with its marker.  The journal ends when there are no more frames.
+   U8 record;
+   if(!gJournalStream.read(&record))
+   {
       // JournalBreak is used for debugging, so halt all game
       // events if we get this far.
       if(mJournalBreak)
          mRunning = false;
-      else
-         mJournalMode = JournalOff;
+
+      stopJournal();
+      return;
+   }
+
+   if(record != JournalRecordFrame)
+   {
+      Con::errorf("GameInterface::journalProcess() - The journal does not match the execution, stopping playback.");
+      stopJournal();
+      return;
+   }
+
+   mJournalFrameStarted = true;
+   mJournalFrameStartTime = currentTime;
+
+   // Process the events of the frame.  Anything else is left for the rest of the frame to read.
+   ReadEvent journalReadEvent;
+   while(gJournalStream.read(&record))
+   {
+      if(record != JournalRecordEvent)
+      {
+         gJournalStream.setPosition(gJournalStream.getPosition() - 1);
+         return;
+      }
+
+      U8 eventType;
+      U16 payloadSize;
+      if(!gJournalStream.read(&eventType) ||
+         !gJournalStream.read(&payloadSize) ||
+         payloadSize > sizeof(journalReadEvent.data) ||
+         !gJournalStream.read(payloadSize, journalReadEvent.data))
+      {
+         Con::errorf("GameInterface::journalProcess() - The journal does not match the execution, stopping playback.");
+         stopJournal();
+         return;
+      }
+
+      journalReadEvent.type = eventType;
+      journalReadEvent.size = U16(sizeof(Event) + payloadSize);
+
+      if(gJournalStream.getPosition() == gJournalStream.getStreamSize() && mJournalBreak)
+         Platform::debugBreak();
+
+      processEvent(&journalReadEvent);
+
+      // Processing the event may have stopped the playback.
+      if(mJournalMode != JournalPlay)
+         return;
    }
 #endif //TORQUE_ALLOW_JOURNALING
 }
 
+void GameInterface::recordJournalFrameTime(U32 frameTime)
+{
+   if(gJournalTimingStream.getStatus() != Stream::Closed)
+   {
+      char buffer[64];
+      dSprintf(buffer, sizeof(buffer), "%u,%u\n", mJournalFrameCount, frameTime);
+      gJournalTimingStream.write(dStrlen(buffer), buffer);
+   }
+
+   mJournalFrameCount++;
+   mJournalTotalTime += frameTime;
+   if(frameTime > mJournalMaxFrameTime)
+      mJournalMaxFrameTime = frameTime;
+}
+
+void GameInterface::stopJournal()
+{
+   if(mJournalMode == JournalPlay && mJournalFrameCount > 0)
+   {
+      Con::printf("Journal playback: %u frames in %u ms (%.2f ms average, %u ms maximum).",
+         mJournalFrameCount, mJournalTotalTime, F32(mJournalTotalTime) / F32(mJournalFrameCount), mJournalMaxFrameTime);
+   }
+
+   // A headless playback has nothing left to do.
+   if(isJournalHeadless())
+      mRunning = false;
+
+   mJournalMode = JournalOff;
+   mJournalHeadless = false;
+   gJournalStream.close();
+   gJournalTimingStream.close();
+}
+
+bool GameInterface::readJournalRecord(U8 expectedRecord)
+{
+   U8 record;
+   if(gJournalStream.read(&record) && record == expectedRecord)
+      return true;
+
+   Con::errorf("GameInterface - The journal does not match the execution, stopping playback.");
+   stopJournal();
+   return false;
+}
+
 void GameInterface::saveJournal(const char *fileName)
 {
+   if(mJournalMode != JournalOff)
+      stopJournal();
+
+   if(!gJournalStream.open(fileName, FileStream::Write))
+   {
+      Con::errorf("GameInterface::saveJournal() - Could not open journal '%s'.", fileName);
+      return;
+   }
+
    mJournalMode = JournalSave;
-   gJournalStream.open(fileName, FileStream::Write);
+   gJournalStream.write(JournalMagic);
+   gJournalStream.write(JournalVersion);
+
+   // Record the random state so that playback produces the same sequences.
+   gJournalStream.write(U32(gRandGen.getSeed()));
+   gJournalStream.write(RandomGeneratorBase::getSeedGeneratorState());
 }
 
 void GameInterface::playJournal(const char *fileName,bool journalBreak)
 {
+   if(mJournalMode != JournalOff)
+      stopJournal();
+
+   if(!gJournalStream.open(fileName, FileStream::Read))
+   {
+      Con::errorf("GameInterface::playJournal() - Could not open journal '%s'.", fileName);
+      return;
+   }
+
+   U32 magic = 0;
+   U32 version = 0;
+   U32 randomSeed = 0;
+   U32 seedGeneratorState = 0;
+   gJournalStream.read(&magic);
+   gJournalStream.read(&version);
+   gJournalStream.read(&randomSeed);
+   gJournalStream.read(&seedGeneratorState);
+   if(magic != JournalMagic || version != JournalVersion || gJournalStream.getStatus() != Stream::Ok)
+   {
+      Con::errorf("GameInterface::playJournal() - '%s' is not a valid journal.", fileName);
+      gJournalStream.close();
+      return;
+   }
+
    mJournalMode = JournalPlay;
    mJournalBreak = journalBreak;
-   gJournalStream.open(fileName, FileStream::Read);
+   mJournalHeadless = false;
+   mJournalFrameCount = 0;
+   mJournalTotalTime = 0;
+   mJournalMaxFrameTime = 0;
+   mJournalFrameStartTime = 0;
+   mJournalFrameStarted = false;
+
+   // Restore the random state.
+   gRandGen.setSeed(S32(randomSeed));
+   RandomGeneratorBase::setSeedGeneratorState(seedGeneratorState);
+}
+
+void GameInterface::replayJournal(const char *fileName, const char *timingFileName)
+{
+   playJournal(fileName);
+
+   // There is nothing to run without the journal.
+   if(mJournalMode != JournalPlay)
+   {
+      mRunning = false;
+      return;
+   }
+
+   mJournalHeadless = true;
+
+   if(timingFileName != NULL && *timingFileName)
+   {
+      if(gJournalTimingStream.open(timingFileName, FileStream::Write))
+      {
+         const char* pHeader = "frame,milliseconds\n";
+         gJournalTimingStream.write(dStrlen(pHeader), pHeader);
+      }
+      else
+      {
+         Con::warnf("GameInterface::replayJournal() - Could not open timing file '%s'.", timingFileName);
+      }
+   }
+}
+
+void GameInterface::processJournalCommandLine(int &argc, const char **&argv)
+{
+#ifdef TORQUE_ALLOW_JOURNALING
+   while(argc > 2)
+   {
+      if(dStricmp(argv[1], "-jSave") == 0)
+      {
+         saveJournal(argv[2]);
+      }
+      else if(dStricmp(argv[1], "-jPlay") == 0)
+      {
+         playJournal(argv[2]);
+      }
+      else if(dStricmp(argv[1], "-jReplay") == 0)
+      {
+         char timingFileName[1024];
+         dSprintf(timingFileName, sizeof(timingFileName), "%s.csv", argv[2]);
+         replayJournal(argv[2], timingFileName);
+      }
+      else
+      {
+         break;
+      }
+
+      argv += 2;
+      argc -= 2;
+   }
+#endif //TORQUE_ALLOW_JOURNALING
 }
 
 FileStream *GameInterface::getJournalStream( void )
@@ -219,21 +436,41 @@ FileStream *GameInterface::getJournalStream( void )
 
 void GameInterface::journalRead(U32 *val)
 {
+   if(!readJournalRecord(JournalRecordValue))
+   {
+      *val = 0;
+      return;
+   }
    gJournalStream.read(val);
 }
 
 void GameInterface::journalWrite(U32 val)
 {
+   gJournalStream.write(U8(JournalRecordValue));
    gJournalStream.write(val);
 }
 
 void GameInterface::journalRead(U32 size, void *buffer)
 {
-   gJournalStream.read(size, buffer);
+   U32 recordedSize = 0;
+   if(readJournalRecord(JournalRecordData))
+   {
+      gJournalStream.read(&recordedSize);
+      if(recordedSize == size)
+      {
+         gJournalStream.read(size, buffer);
+         return;
+      }
+
+      Con::errorf("GameInterface::journalRead() - The journal does not match the execution, stopping playback.");
+      stopJournal();
+   }
+   dMemset(buffer, 0, size);
 }
 
 void GameInterface::journalWrite(U32 size, const void *buffer)
 {
+   gJournalStream.write(U8(JournalRecordData));
+   gJournalStream.write(size);
    gJournalStream.write(size, buffer);
 }
-
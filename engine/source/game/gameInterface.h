@@ -36,11 +36,31 @@ private:
       JournalSave,
       JournalPlay,
    };
+   /// Journal record types.  Every record starts with its type so playback
+   /// can detect when the journal no longer matches the execution.
+   enum JournalRecord {
+      JournalRecordFrame = 1,
+      JournalRecordEvent,
+      JournalRecordValue,
+      JournalRecordData,
+   };
    JournalMode mJournalMode;
    bool mRunning;
    bool mJournalBreak;
+   bool mJournalHeadless;
    bool mRequiresRestart;
 
+   /// Journal playback frame timing.
+   U32 mJournalFrameCount;
+   U32 mJournalTotalTime;
+   U32 mJournalMaxFrameTime;
+   U32 mJournalFrameStartTime;
+   bool mJournalFrameStarted;
+
+   bool readJournalRecord(U8 expectedRecord);
+   void recordJournalFrameTime(U32 frameTime);
+   void stopJournal();
+
    /// Events are stored here by any thread, for processing by the main thread.
    Vector<Event*> eventQueue1, eventQueue2, *eventQueue;
    
@@ -111,14 +131,24 @@ public:
    ///
    /// Actually enabling journaling may be different in different distributions
    /// if the developers decided to change how it works.  However, by default,
-   /// run the program with the "-jSave filename" command argument.  The filename
+   /// run the program with the "-jSave filename" command argument.  Journaling
+   /// must be enabled with the TORQUE_ALLOW_JOURNALING pre-processor definition.  The filename
    /// does not need an extension, and only requires write access.  If the file
    /// does not exist, it will be created.  In order to play back a journal,
    /// use the "-jPlay filename" command argument, and just watch the magic happen.
+   /// To reproduce a performance problem, use the "-jReplay filename" command
+   /// argument which plays the journal back as fast as possible without rendering
+   /// and writes the time taken by each frame to "filename.csv".
+   ///
+   /// The journal is a compact binary stream of frame markers, the events processed
+   /// in each frame and the values (random seeds, socket handles etc.) the engine
+   /// read from the platform.  Events are recorded when they are processed rather
+   /// than posted so the values they read are recorded in the same order.
    /// Examples:
    /// @code
    /// torqueDemo_DEBUG.exe -jSave crash
    /// torqueDemo_DEBUG.exe -jPlay crash
+   /// torqueDemo_DEBUG.exe -jReplay crash
    /// @endcode
    /// @{
 
@@ -138,6 +168,18 @@ public:
    /// @param  journalBreak   Should we break execution after we're done?
    void playJournal(const char *fileName, bool journalBreak = false);
 
+   /// Play back the specified journal as fast as possible without rendering,
+   /// quitting when it has finished.  This is intended for reproducing
+   /// performance problems on a build machine.
+   ///
+   /// @param  fileName       Journal file to play back.
+   /// @param  timingFileName Optional file to write the time taken by each frame to (CSV).
+   void replayJournal(const char *fileName, const char *timingFileName = NULL);
+
+   /// Process any journal command-line arguments ("-jSave", "-jPlay" or "-jReplay"),
+   /// removing them from the arguments.
+   void processJournalCommandLine(int &argc, const char **&argv);
+
    JournalMode getJournalMode() { return mJournalMode; };
 
    /// Are we reading back from the journal?
@@ -146,6 +188,9 @@ public:
    /// Are we writing to the journal?
    inline bool isJournalWriting( void ) const { return mJournalMode == JournalSave; }
 
+   /// Are we playing back the journal without rendering?
+   inline bool isJournalHeadless( void ) const { return mJournalMode == JournalPlay && mJournalHeadless; }
+
    void journalRead(U32 *val);                     ///< Read a U32 from the journal.
    void journalWrite(U32 val);                     ///< Write a U32 to the journal.
    void journalRead(U32 size, void *buffer);       ///< Read a block of data from the journal.
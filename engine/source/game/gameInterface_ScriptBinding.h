@@ -45,4 +45,16 @@ ConsoleFunctionWithDocs( playJournal, ConsoleVoid, 2, 3, ( namedFile , doBreak )
    Game->playJournal(argv[1],jBreak);
 }
 
+/*! Use the replayJournal function to play back a journal from namedFile as fast as possible without rendering, quitting when it has finished.
+    This allows a performance problem captured with saveJournal to be reproduced exactly on another machine.
+    @param namedFile A full path to a valid journal file. Usually, journal names end with the extension .jrn.
+    @param timingFile An optional full path to a file to write the time taken by each frame to, in CSV format.
+    @return No return value.
+    @sa saveJournal, playJournal
+*/
+ConsoleFunctionWithDocs( replayJournal, ConsoleVoid, 2, 3, ( namedFile , [timingFile]? ))
+{
+   Game->replayJournal(argv[1], (argc > 2)? argv[2]: NULL);
+}
+
 #endif //TORQUE_ALLOW_JOURNALING
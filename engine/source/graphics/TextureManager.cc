@@ -33,6 +33,12 @@
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
 #include "math/mMath.h"
+#include "io/fileStream.h"
+#include "io/memstream.h"
+#include "platform/threads/workerPool.h"
+#include "debug/profiler.h"
+#include "string/stringUnit.h"
+#include "game/frameScheduler.h"
 
 #include "TextureManager_ScriptBinding.h"
 
@@ -86,6 +92,61 @@ static U32                        sgCurrCallbackKey = 0;
 
 static Vector<EventCallbackEntry> sgEventCallbacks(__FILE__, __LINE__);
 
+static Vector<TextureHandle>      sgPreloadedTextures(__FILE__, __LINE__);
+
+struct QueuedPreload
+{
+    StringTableEntry    mTextureKey;
+    bool                mClampToEdge;
+};
+
+static Vector<QueuedPreload>      sgQueuedPreloads(__FILE__, __LINE__);
+static U32                        sgNextQueuedPreload = 0;
+
+// The most bitmaps decoded together on the worker pool.
+static const U32                  MaximumDecodeBatch = 16;
+
+/// Preloads the queued textures, one batch per slice.
+class TexturePreloadTask : public FrameIdleTask
+{
+public:
+    virtual bool processIdleTask( void )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(TextureManager_TexturePreloadTask);
+
+        const U32 queuedCount = (U32)sgQueuedPreloads.size();
+        if ( sgNextQueuedPreload >= queuedCount )
+            return false;
+
+        // Take a batch with the same edge clamping that keeps the worker threads busy.
+        const bool clampToEdge = sgQueuedPreloads[sgNextQueuedPreload].mClampToEdge;
+        const char* textureKeys[MaximumDecodeBatch];
+        const U32 batchLimit = getMin( WorkerPool::getThreadCount() + 1, MaximumDecodeBatch );
+
+        U32 batchCount = 0;
+        while ( sgNextQueuedPreload < queuedCount && batchCount < batchLimit && sgQueuedPreloads[sgNextQueuedPreload].mClampToEdge == clampToEdge )
+            textureKeys[batchCount++] = sgQueuedPreloads[sgNextQueuedPreload++].mTextureKey;
+
+        TextureManager::preloadTextures( textureKeys, batchCount, clampToEdge );
+
+        // Reset the queue when it is empty.
+        if ( sgNextQueuedPreload >= (U32)sgQueuedPreloads.size() )
+        {
+            sgQueuedPreloads.clear();
+            sgNextQueuedPreload = 0;
+            return false;
+        }
+
+        return true;
+    }
+};
+
+static TexturePreloadTask         sgTexturePreloadTask;
+
+// Bound to a preference so the PNG decoder can read it without console access.
+extern bool sgForcePalletedPNGsTo16Bit;
+
 //--------------------------------------------------------------------------------------------------------------------
 
 U32 TextureManager::registerEventCallback(TextureEventCallback callback, void *userData)
@@ -155,6 +216,7 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit", TypeBool, &sgForcePalletedPNGsTo16Bit);
 
     // Flag as alive.
     mManagerState = Alive;
@@ -166,6 +228,12 @@ void TextureManager::destroy()
 {
     AssertISV(mManagerState != NotInitialized, "TextureManager::destroy - nothing to destroy!");
 
+    // Release any preloaded textures.
+    FrameScheduler::removeIdleTask( &sgTexturePreloadTask );
+    sgQueuedPreloads.clear();
+    sgNextQueuedPreload = 0;
+    releasePreloadedTextures();
+
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
@@ -584,19 +652,26 @@ U16* TextureManager::create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::B
 
 //-----------------------------------------------------------------------------
 
-void TextureManager::refresh( TextureObject* pTextureObject )
+void TextureManager::refresh( TextureObject* pTextureObject, GBitmap* pPowerOfTwoBitmap )
 {
     // Finish if refresh not appropriate.
     if (!(mDGLRender || mManagerState == Resurrecting))
+    {
+        // Delete any prepared power-of-two bitmap.
+        if ( pPowerOfTwoBitmap != pTextureObject->mpBitmap )
+            delete pPowerOfTwoBitmap;
+
         return;
+    }
 
     // Sanity!
     AssertISV( pTextureObject->mGLTextureName != 0, "Refreshing texture but no texture created." );
     AssertISV( pTextureObject->mpBitmap != 0, "Refreshing texture but no bitmap available." );
 
     // Fetch bitmaps.
+    // NOTE:- A power-of-two bitmap prepared by the caller is used as-is and is owned by the refresh.
     GBitmap* pSourceBitmap = pTextureObject->mpBitmap;
-    GBitmap* pNewBitmap = createPowerOfTwoBitmap(pSourceBitmap);
+    GBitmap* pNewBitmap = pPowerOfTwoBitmap != NULL ? pPowerOfTwoBitmap : createPowerOfTwoBitmap(pSourceBitmap);
    
     U8 *bits = (U8*)pNewBitmap->getBits();
     U8 *lumBits = NULL;
@@ -740,11 +815,17 @@ void TextureManager::refresh( const char *textureName )
 
 //--------------------------------------------------------------------------------------------------------------------
 
-void TextureManager::createGLName( TextureObject* pTextureObject )
+void TextureManager::createGLName( TextureObject* pTextureObject, GBitmap* pPowerOfTwoBitmap )
 {
     // Finish if not appropriate.
     if (!(mDGLRender || mManagerState == Resurrecting))
+    {
+        // Delete any prepared power-of-two bitmap.
+        if ( pPowerOfTwoBitmap != pTextureObject->mpBitmap )
+            delete pPowerOfTwoBitmap;
+
         return;
+    }
 
     // Sanity!
     AssertISV( pTextureObject->mHandleType != TextureHandle::InvalidTexture, "Invalid texture type." );
@@ -766,12 +847,12 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
     mTextureResidentWasteSize += pTextureObject->mTextureResidentWasteSize;
 
     // Refresh the texture.
-    refresh( pTextureObject );
+    refresh( pTextureObject, pPowerOfTwoBitmap );
 }
 
 //--------------------------------------------------------------------------------------------------------------------
 
-TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge)
+TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, GBitmap* pPowerOfTwoBitmap)
 {
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
@@ -840,7 +921,7 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
     // Generate a GL texture name if one is not ready.
     if( pTextureObject->mGLTextureName == 0) 
     {
-        createGLName(pTextureObject);
+        createGLName(pTextureObject, pPowerOfTwoBitmap);
     }
 
     // Delete bitmap if we're not keeping it.
@@ -873,6 +954,11 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
 
     if( ret == NULL )
     {
+        // Decode the bitmap on the worker pool if it can be.
+        ret = decodeTexture(textureKey, type, clampToEdge, force16Bit);
+        if(ret)
+            return ret;
+
         // Ok, no hit - is it in the current dir? If so then let's grab it
         // and use it.
         bmp = loadBitmap(textureKey, false);
@@ -940,6 +1026,326 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+bool TextureManager::canDecodeBitmap( const char* pFilePath )
+{
+    // Fetch the extension.
+    const char* pExtension = dStrrchr( pFilePath, '.' );
+
+    // Finish if there is no extension.
+    if ( pExtension == NULL )
+        return false;
+
+    // NOTE:- Apple optimized PNGs are decoded by the platform so are not decoded on the worker pool.
+#if !defined(USE_APPLE_OPTIMIZED_PNGS)
+    if ( dStricmp( pExtension, ".png" ) == 0 )
+        return true;
+#endif
+
+    return dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static bool decodeBitmapStream( GBitmap* pBitmap, Stream& stream, const bool isPNG )
+{
+    return isPNG ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static void decodeBitmapFile( void* pContext, const U32 index )
+{
+    // Fetch the bitmap to decode.
+    TextureManager::DecodedBitmap& decodedBitmap = ((TextureManager::DecodedBitmap*)pContext)[index];
+
+    // NOTE: This is called on a worker thread so it must not use the console.
+    const char* pExtension = dStrrchr( decodedBitmap.mFilePath, '.' );
+    const bool isPNG = pExtension != NULL && dStricmp( pExtension, ".png" ) == 0;
+
+    GBitmap* pBitmap = new GBitmap();
+    bool decoded = false;
+
+    // Decode from memory if the file contents are available otherwise read the file.
+    if ( decodedBitmap.mpFileData != NULL )
+    {
+        MemStream stream( decodedBitmap.mFileSize, (void*)decodedBitmap.mpFileData, true, false );
+        decoded = decodeBitmapStream( pBitmap, stream, isPNG );
+    }
+    else
+    {
+        FileStream stream;
+        if ( stream.open( decodedBitmap.mFilePath, FileStream::Read ) )
+        {
+            decoded = decodeBitmapStream( pBitmap, stream, isPNG );
+            stream.close();
+        }
+    }
+
+    // Finish if the bitmap could not be decoded.
+    if ( !decoded )
+    {
+        delete pBitmap;
+        return;
+    }
+
+    decodedBitmap.mpBitmap = pBitmap;
+
+    // Pad to a power-of-two here so the upload does not have to.
+    // NOTE:- Bitmaps exceeding the product-supported dimensions are rejected when registered.
+    if ( pBitmap->getWidth() <= MaximumProductSupportedTextureWidth && pBitmap->getHeight() <= MaximumProductSupportedTextureHeight )
+        decodedBitmap.mpPowerOfTwoBitmap = TextureManager::createPowerOfTwoBitmap( pBitmap );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::decodeBitmaps( DecodedBitmap* pDecodedBitmaps, const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_DecodeBitmaps);
+
+    // Sanity!
+    AssertFatal( pDecodedBitmaps != NULL || count == 0, "TextureManager::decodeBitmaps() - Cannot decode NULL bitmaps." );
+
+    WorkerPool::process( decodeBitmapFile, pDecodedBitmaps, count );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::resolveDecodedBitmap( StringTableEntry textureKey, DecodedBitmap& decodedBitmap )
+{
+    // Find the bitmap file as loadBitmap() does.
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), textureKey );
+    const U32 fileNameLength = dStrlen( fileNameBuffer );
+    ResourceObject* pResourceObject = NULL;
+    for ( U32 extIndex = 0; extIndex < EXT_ARRAY_SIZE && pResourceObject == NULL; ++extIndex )
+    {
+        dStrcpy( fileNameBuffer + fileNameLength, extArray[extIndex] );
+        pResourceObject = ResourceManager->find( fileNameBuffer );
+    }
+
+    // Finish if the bitmap cannot be decoded on the worker pool.
+    if ( pResourceObject == NULL || !canDecodeBitmap( fileNameBuffer ) )
+        return false;
+
+    if ( pResourceObject->flags & ResourceObject::File )
+    {
+        // Read files directly on the worker pool.
+        char filePathBuffer[1024];
+        Platform::makeFullPathName( pResourceObject->name, filePathBuffer, sizeof(filePathBuffer), pResourceObject->path );
+        decodedBitmap.mFilePath = StringTable->insert( filePathBuffer );
+        return true;
+    }
+
+    // Volume blocks are read here as archives cannot be read concurrently.
+    Stream* pStream = ResourceManager->openStream( pResourceObject );
+    if ( pStream == NULL )
+        return false;
+
+    const U32 fileSize = pStream->getStreamSize();
+    U8* pFileData = (U8*)dMalloc( fileSize );
+    const bool fileRead = pStream->read( fileSize, pFileData );
+    ResourceManager->closeStream( pStream );
+
+    if ( !fileRead )
+    {
+        dFree( pFileData );
+        return false;
+    }
+
+    decodedBitmap.mFilePath = StringTable->insert( fileNameBuffer );
+    decodedBitmap.mpFileData = pFileData;
+    decodedBitmap.mFileSize = fileSize;
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureObject* TextureManager::registerDecodedBitmap( StringTableEntry textureKey, DecodedBitmap& decodedBitmap, TextureHandle::TextureHandleType type, const bool clampToEdge, const bool force16Bit )
+{
+    // Release the file contents.
+    if ( decodedBitmap.mpFileData != NULL )
+    {
+        dFree( (void*)decodedBitmap.mpFileData );
+        decodedBitmap.mpFileData = NULL;
+    }
+
+    GBitmap* pBitmap = decodedBitmap.mpBitmap;
+
+    if ( pBitmap == NULL )
+    {
+        Con::warnf( "TextureManager - Could not decode bitmap '%s'.", decodedBitmap.mFilePath );
+        return NULL;
+    }
+
+    if ( decodedBitmap.mpPowerOfTwoBitmap == NULL )
+    {
+        Con::warnf( "TextureManager - Cannot load bitmap '%s' as its dimensions exceed the maximum product-supported texture dimension.", decodedBitmap.mFilePath );
+        delete pBitmap;
+        return NULL;
+    }
+
+    pBitmap->mForce16Bit = force16Bit;
+
+    return registerTexture( textureKey, pBitmap, type, clampToEdge, decodedBitmap.mpPowerOfTwoBitmap );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureObject* TextureManager::decodeTexture( StringTableEntry textureKey, TextureHandle::TextureHandleType type, const bool clampToEdge, const bool force16Bit )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_DecodeTexture);
+
+    DecodedBitmap decodedBitmaps[MaximumDecodeBatch];
+    StringTableEntry textureKeys[MaximumDecodeBatch];
+    bool clampToEdges[MaximumDecodeBatch];
+
+    // Finish if the bitmap cannot be decoded on the worker pool.
+    if ( !resolveDecodedBitmap( textureKey, decodedBitmaps[0] ) )
+        return NULL;
+
+    // Decode any queued preloads alongside so the other worker threads are not idle.
+    const U32 batchLimit = getMin( WorkerPool::getThreadCount() + 1, MaximumDecodeBatch );
+    U32 batchCount = 1;
+    while ( batchCount < batchLimit && sgNextQueuedPreload < (U32)sgQueuedPreloads.size() )
+    {
+        const QueuedPreload& queuedPreload = sgQueuedPreloads[sgNextQueuedPreload];
+
+        // Leave the preloads that cannot be decoded here to the idle task.
+        if ( TextureDictionary::find( queuedPreload.mTextureKey, TextureHandle::BitmapTexture, queuedPreload.mClampToEdge ) != NULL ||
+            !resolveDecodedBitmap( queuedPreload.mTextureKey, decodedBitmaps[batchCount] ) )
+            break;
+
+        textureKeys[batchCount] = queuedPreload.mTextureKey;
+        clampToEdges[batchCount] = queuedPreload.mClampToEdge;
+        batchCount++;
+        sgNextQueuedPreload++;
+    }
+
+    // Decode the bitmaps.
+    decodeBitmaps( decodedBitmaps, batchCount );
+
+    // Register the preloads.
+    for ( U32 index = 1; index < batchCount; ++index )
+    {
+        TextureObject* pTextureObject = registerDecodedBitmap( textureKeys[index], decodedBitmaps[index], TextureHandle::BitmapTexture, clampToEdges[index], false );
+        if ( pTextureObject != NULL )
+            sgPreloadedTextures.push_back( TextureHandle( pTextureObject ) );
+    }
+
+    return registerDecodedBitmap( textureKey, decodedBitmaps[0], type, clampToEdge, force16Bit );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::preloadTextures( const char** ppTextureKeys, const U32 count, const bool clampToEdge, const bool force16Bit )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_PreloadTextures);
+
+    Vector<DecodedBitmap> decodedBitmaps;
+    Vector<StringTableEntry> decodedTextureKeys;
+    U32 preloadedCount = 0;
+
+    // Resolve the bitmap files.
+    for ( U32 keyIndex = 0; keyIndex < count; ++keyIndex )
+    {
+        const char* pTextureKey = ppTextureKeys[keyIndex];
+
+        // Skip if texture key is invalid.
+        if ( pTextureKey == NULL || *pTextureKey == 0 )
+            continue;
+
+        // Fetch texture key.
+        StringTableEntry textureKey = StringTable->insert( pTextureKey );
+
+        // Keep the texture if it is already loaded.
+        TextureObject* pTextureObject = TextureDictionary::find( textureKey, TextureHandle::BitmapTexture, clampToEdge );
+        if ( pTextureObject != NULL )
+        {
+            sgPreloadedTextures.push_back( TextureHandle( pTextureObject ) );
+            preloadedCount++;
+            continue;
+        }
+
+        DecodedBitmap decodedBitmap;
+
+        // Load the texture here if its bitmap cannot be decoded on the worker pool.
+        if ( !resolveDecodedBitmap( textureKey, decodedBitmap ) )
+        {
+            pTextureObject = loadTexture( textureKey, TextureHandle::BitmapTexture, clampToEdge, false, force16Bit );
+            if ( pTextureObject != NULL )
+            {
+                sgPreloadedTextures.push_back( TextureHandle( pTextureObject ) );
+                preloadedCount++;
+            }
+            continue;
+        }
+
+        decodedBitmaps.push_back( decodedBitmap );
+        decodedTextureKeys.push_back( textureKey );
+    }
+
+    // Decode the bitmaps.
+    decodeBitmaps( decodedBitmaps.address(), decodedBitmaps.size() );
+
+    // Register the textures.
+    for ( U32 index = 0; index < (U32)decodedBitmaps.size(); ++index )
+    {
+        TextureObject* pTextureObject = registerDecodedBitmap( decodedTextureKeys[index], decodedBitmaps[index], TextureHandle::BitmapTexture, clampToEdge, force16Bit );
+        if ( pTextureObject == NULL )
+            continue;
+
+        sgPreloadedTextures.push_back( TextureHandle( pTextureObject ) );
+        preloadedCount++;
+    }
+
+    return preloadedCount;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::releasePreloadedTextures( void )
+{
+    // NOTE:- Vectors do not destruct their elements so the handles are cleared explicitly.
+    for ( U32 index = 0; index < (U32)sgPreloadedTextures.size(); ++index )
+        sgPreloadedTextures[index].clear();
+
+    sgPreloadedTextures.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::queuePreloadTextures( const char** ppTextureKeys, const U32 count, const bool clampToEdge )
+{
+    for ( U32 keyIndex = 0; keyIndex < count; ++keyIndex )
+    {
+        const char* pTextureKey = ppTextureKeys[keyIndex];
+
+        // Skip if texture key is invalid.
+        if ( pTextureKey == NULL || *pTextureKey == 0 )
+            continue;
+
+        QueuedPreload queuedPreload;
+        queuedPreload.mTextureKey = StringTable->insert( pTextureKey );
+        queuedPreload.mClampToEdge = clampToEdge;
+        sgQueuedPreloads.push_back( queuedPreload );
+    }
+
+    if ( getQueuedPreloadCount() > 0 )
+        FrameScheduler::addIdleTask( &sgTexturePreloadTask );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getQueuedPreloadCount( void )
+{
+    return (U32)sgQueuedPreloads.size() - sgNextQueuedPreload;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::dumpMetrics( void )
 {
     S32 textureResidentCount = 0;
@@ -106,17 +106,51 @@ public:
 
     static void dumpMetrics( void );
 
+    /// A bitmap file decoded by decodeBitmaps().
+    struct DecodedBitmap
+    {
+        DecodedBitmap() : mFilePath( NULL ), mpFileData( NULL ), mFileSize( 0 ), mpBitmap( NULL ), mpPowerOfTwoBitmap( NULL ) {}
+
+        StringTableEntry    mFilePath;              ///< Full path of the bitmap file.
+        const U8*           mpFileData;             ///< Contents of the bitmap file if already in memory otherwise the file path is read.
+        U32                 mFileSize;              ///< Size of the bitmap file contents.
+        GBitmap*            mpBitmap;               ///< Decoded bitmap or NULL if decoding failed.
+        GBitmap*            mpPowerOfTwoBitmap;     ///< Power-of-two padded bitmap ready for upload (may be the decoded bitmap itself).
+    };
+
+    /// Returns the bitmap itself if already a power-of-two otherwise a new padded copy.
+    static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
+
+    /// Whether the bitmap file can be decoded by decodeBitmaps().
+    static bool canDecodeBitmap( const char* pFilePath );
+
+    /// Decodes the bitmap files and pads them to a power-of-two on the worker pool.
+    /// The caller owns the resulting bitmaps.
+    static void decodeBitmaps( DecodedBitmap* pDecodedBitmaps, const U32 count );
+
+    /// Loads the bitmap textures with their decoding spread across the worker pool.
+    /// The textures are kept resident until releasePreloadedTextures() is called.
+    /// Returns the number of textures that are now available.
+    static U32 preloadTextures( const char** ppTextureKeys, const U32 count, const bool clampToEdge, const bool force16Bit = false );
+    static void releasePreloadedTextures( void );
+
+    /// Queues the bitmap textures to be preloaded in batches using the spare time in the frames.
+    static void queuePreloadTextures( const char** ppTextureKeys, const U32 count, const bool clampToEdge );
+    static U32 getQueuedPreloadCount( void );
+
 private:
     static void postTextureEvent(const TextureEventCode eventCode);
 
-    static void createGLName( TextureObject* pTextureObject );
-    static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge);
+    static void createGLName( TextureObject* pTextureObject, GBitmap* pPowerOfTwoBitmap = NULL );
+    static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, GBitmap* pPowerOfTwoBitmap = NULL);
     static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false );
+    static bool resolveDecodedBitmap( StringTableEntry textureKey, DecodedBitmap& decodedBitmap );
+    static TextureObject* registerDecodedBitmap( StringTableEntry textureKey, DecodedBitmap& decodedBitmap, TextureHandle::TextureHandleType type, const bool clampToEdge, const bool force16Bit );
+    static TextureObject* decodeTexture( StringTableEntry textureKey, TextureHandle::TextureHandleType type, const bool clampToEdge, const bool force16Bit );
     static void freeTexture( TextureObject* pTextureObject );
-    static void refresh(TextureObject* pTextureObject);
+    static void refresh(TextureObject* pTextureObject, GBitmap* pPowerOfTwoBitmap = NULL);
 
     static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
-    static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
     static F32 getResidentFraction( void );
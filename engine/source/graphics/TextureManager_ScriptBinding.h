@@ -72,4 +72,66 @@ ConsoleFunctionWithDocs( dumpTextureManagerMetrics, ConsoleVoid, 1, 1, ())
     return TextureManager::dumpMetrics();
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Preloads bitmap textures with their decoding spread across the worker threads.
+    The textures are kept resident until releasePreloadedTextures() is called.
+    @param textureFiles A space-separated list of texture files (extensions are optional).
+    @param clampToEdge Whether the textures are clamped to their edges or not.  Image assets clamp so this is optional and defaults to true.
+    @return The number of textures that are now available.
+*/
+ConsoleFunctionWithDocs( preloadTextures, ConsoleInt, 2, 3, (textureFiles, [clampToEdge]))
+{
+    // Fetch the texture files.
+    const U32 textureCount = StringUnit::getUnitCount( argv[1], " \t\n" );
+    Vector<const char*> textureKeys;
+    for ( U32 index = 0; index < textureCount; ++index )
+        textureKeys.push_back( StringTable->insert( StringUnit::getUnit( argv[1], index, " \t\n" ) ) );
+
+    const bool clampToEdge = argc >= 3 ? dAtob(argv[2]) : true;
+
+    return TextureManager::preloadTextures( textureKeys.address(), textureKeys.size(), clampToEdge );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Queues bitmap textures to be preloaded in batches using the spare time in the frames.
+    The textures are decoded on the worker threads and kept resident until releasePreloadedTextures() is called.
+    @param textureFiles A space-separated list of texture files (extensions are optional).
+    @param clampToEdge Whether the textures are clamped to their edges or not.  Image assets clamp so this is optional and defaults to true.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( queuePreloadTextures, ConsoleVoid, 2, 3, (textureFiles, [clampToEdge]))
+{
+    // Fetch the texture files.
+    const U32 textureCount = StringUnit::getUnitCount( argv[1], " \t\n" );
+    Vector<const char*> textureKeys;
+    for ( U32 index = 0; index < textureCount; ++index )
+        textureKeys.push_back( StringTable->insert( StringUnit::getUnit( argv[1], index, " \t\n" ) ) );
+
+    const bool clampToEdge = argc >= 3 ? dAtob(argv[2]) : true;
+
+    TextureManager::queuePreloadTextures( textureKeys.address(), textureKeys.size(), clampToEdge );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Gets the number of textures queued by queuePreloadTextures() that are still to be preloaded.
+    @return The number of queued textures.
+*/
+ConsoleFunctionWithDocs( getQueuedPreloadTextureCount, ConsoleInt, 1, 1, ())
+{
+    return TextureManager::getQueuedPreloadCount();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Releases the textures kept resident by preloadTextures().
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( releasePreloadedTextures, ConsoleVoid, 1, 1, ())
+{
+    TextureManager::releasePreloadedTextures();
+}
+
 /*! @} */ // group TextureManagerFunctions
@@ -43,43 +43,34 @@ bool sgForcePalletedPNGsTo16Bit= false;
 #include "png.h"
 #include "zlib.h"
 
-// Our chunk signatures...
-
-static const U32 csgMaxRowPointers = (1 << GBitmap::c_maxMipLevels) - 1; ///< 2^11 = 2048, 12 mip levels (see c_maxMipLievels)
-static png_bytep sRowPointers[csgMaxRowPointers];
-
-//-------------------------------------- Instead of using the user_ptr,
-//                                        we use a global pointer, we
-//                                        need to ensure that only one thread
-//                                        at once may be using the variable.
-//                                       NOTE: Removed mutex for g_varAccess.
-//                                        may have to re-thread safe this.
-static Stream* sg_pStream = NULL;
+// NOTE:- The stream is passed through the libpng I/O pointer and all memory is allocated
+//         per-call so PNGs can be decoded concurrently on worker threads.
 
 //-------------------------------------- Replacement I/O for standard LIBPng
 //                                        functions.  we don't wanna use
 //                                        FILE*'s...
-static void pngReadDataFn(png_structp  /*png_ptr*/,
+static void pngReadDataFn(png_structp png_ptr,
                           png_bytep   data,
                           png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
-   bool success;
-   success = sg_pStream->read((U32)length, data);
-    
-   AssertFatal(success, "PNG read catastrophic error!");
+   // Raise a PNG error on a short read so the caller's setjmp handler unwinds the read.
+   if(!pStream->read((U32)length, data))
+      png_error(png_ptr, "PNG read catastrophic error!");
 }
 
 
 //--------------------------------------
-static void pngWriteDataFn(png_structp /*png_ptr*/,
+static void pngWriteDataFn(png_structp png_ptr,
                            png_bytep   data,
                            png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
-   sg_pStream->write((U32)length, data);
+   pStream->write((U32)length, data);
 }
 
 
@@ -91,18 +82,12 @@ static void pngFlushDataFn(png_structp /*png_ptr*/)
 
 static png_voidp pngMallocFn(png_structp /*png_ptr*/, png_size_t size)
 {
-#ifndef _WIN64
-   return FrameAllocator::alloc((U32)size);
-#else
    return (png_voidp)dMalloc(size);
-#endif
 }
 
 static void pngFreeFn(png_structp /*png_ptr*/, png_voidp mem)
 {
-#ifdef _WIN64
    dFree(mem);
-#endif
 }
 
 
@@ -114,6 +99,15 @@ static void pngFatalErrorFn(png_structp     /*png_ptr*/,
 }
 
 
+//--------------------------------------
+static void pngReadErrorFn(png_structp png_ptr, png_const_charp /*pMessage*/)
+{
+   // NOTE:- Reading can happen on a worker thread so a bad file fails the read rather than asserting.
+   AssertWarn(false, "GBitmap::readPNG: Error reading PNG file.");
+   png_longjmp(png_ptr, 1);
+}
+
+
 //--------------------------------------
 static void pngWarningFn(png_structp, png_const_charp pMessage)
 {
@@ -136,12 +130,10 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
-   U32 prevWaterMark = FrameAllocator::getWaterMark();
-
 #if defined(PNG_USER_MEM_SUPPORTED)
    png_structp png_ptr = png_create_read_struct_2(PNG_LIBPNG_VER_STRING,
                                                 NULL,
-                                                pngFatalErrorFn,
+                                                pngReadErrorFn,
                                                 pngWarningFn,
                                                 NULL,
                                                 pngMallocFn,
@@ -149,22 +141,18 @@ bool GBitmap::readPNG(Stream& io_rStream)
 #else
    png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING,
                                                 NULL,
-                                                pngFatalErrorFn,
+                                                pngReadErrorFn,
                                                 pngWarningFn);
 #endif
 
    if (png_ptr == NULL) 
-   {
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
-   }
 
    png_infop info_ptr = png_create_info_struct(png_ptr);
    if (info_ptr == NULL) {
       png_destroy_read_struct(&png_ptr,
                               (png_infopp)NULL,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -173,12 +161,23 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               &info_ptr,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
-   sg_pStream = &io_rStream;
-   png_set_read_fn(png_ptr, NULL, pngReadDataFn);
+   // The row pointers are released if reading fails.
+   png_bytep* volatile rowPointers = NULL;
+
+   // Reading errors return here.
+   if (setjmp(png_jmpbuf(png_ptr)))
+   {
+      if (rowPointers != NULL)
+         dFree(rowPointers);
+      png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
+      deleteImage();
+      return false;
+   }
+
+   png_set_read_fn(png_ptr, &io_rStream, pngReadDataFn);
 
    // Read off the info on the image.
    png_set_sig_bytes(png_ptr, cs_headerBytesChecked);
@@ -270,14 +269,15 @@ bool GBitmap::readPNG(Stream& io_rStream)
                   format);          // use determined format...
 
    // Set up the row pointers...
-   AssertISV(height <= csgMaxRowPointers, "Error, cannot load pngs taller than 2048 pixels!");
-   png_bytep* rowPointers = sRowPointers;
+   rowPointers = (png_bytep*)dMalloc(height * sizeof(png_bytep));
    U8* pBase = (U8*)getBits();
    for (U32 i = 0; i < height; i++)
       rowPointers[i] = pBase + (i * rowBytes);
 
    // And actually read the image!
    png_read_image(png_ptr, rowPointers);
+   dFree(rowPointers);
+   rowPointers = NULL;
 
    // We're outta here, destroy the png structs, and release the lock
    //  as quickly as possible...
@@ -285,20 +285,17 @@ bool GBitmap::readPNG(Stream& io_rStream)
    png_read_end(png_ptr, NULL);
    png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
 
-   sg_pStream = NULL;
-
    // Ok, the image is read in, now we need to finish up the initialization,
    //  which means: setting up the detailing members, init'ing the palette
    //  key, etc...
    //
    // actually, all of that was handled by allocateBitmap, so we're outta here
    //
-   FrameAllocator::setWaterMark(prevWaterMark);
 
     //
    //-Mat if all palleted images are to be converted, set mForce16bit
+   // NOTE:- The preference is bound by the texture manager so no console access is needed here.
    if( color_type == PNG_COLOR_TYPE_PALETTE ) {
-       sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
        if( sgForcePalletedPNGsTo16Bit ) {
            mForce16Bit = true;
        }
@@ -348,8 +345,7 @@ bool GBitmap::_writePNG(Stream&   stream,
       return false;
    }
 
-   sg_pStream = &stream;
-   png_set_write_fn(png_ptr, NULL, pngWriteDataFn, pngFlushDataFn);
+   png_set_write_fn(png_ptr, &stream, pngWriteDataFn, pngFlushDataFn);
 
    // Set the compression level, image filters, and compression strategy...
    png_set_compression_strategy( png_ptr, strategy );
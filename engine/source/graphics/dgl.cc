@@ -86,6 +86,8 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
                        F32			 fSpin,
                        bool				bSilhouette)
 {	
+   dglFlushTextBatch();
+
    AssertFatal(texture != NULL, "GSurface::drawBitmapStretchSR: NULL Handle");
    if(!dstRect.isValidRect())
       return;
@@ -324,63 +326,34 @@ struct TextVertex
    }
 };
 
-//------------------------------------------------------------------------------
-
-U32 dglDrawTextN(GFont*          font,
-                 const Point2I&  ptDraw,
-                 const UTF8*     in_string,
-                 U32             n,
-                 const ColorI*   colorTable,
-                 const U32       maxColorIndex,
-                 F32             rot)
-{
-   PROFILE_START(DrawText_UTF8);
-   
-   U32 len = dStrlen(in_string) + 1;
-   FrameTemp<UTF16> ubuf(len);
-   convertUTF8toUTF16(in_string, ubuf, len);
-   U32 tmp = dglDrawTextN(font, ptDraw, ubuf, n, colorTable, maxColorIndex, rot);
+namespace {
 
-   PROFILE_END();
+/// The text vertex stream.  Text is appended here and drawn when the glyph texture
+/// changes, when a text batch ends or before anything else is drawn.
+Vector<TextVertex> sgTextVertices;
+TextureObject* sgTextTexture = NULL;
+S32 sgTextBatchDepth = 0;
+RectI sgTextBatchClipRect;
 
-   return tmp;
 }
 
-//-----------------------------------------------------------------------------
+static void dglApplyClipRect(const RectI &clipRect);
 
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-U32 dglDrawTextN(GFont*          font,
-                 const Point2I&  ptDraw,
-                 const UTF16*    in_string,
-                 U32             n,
-                 const ColorI*   colorTable,
-                 const U32       maxColorIndex,
-                 F32             rot)
+//------------------------------------------------------------------------------
 
+static void dglDrawTextVertices(const bool useBatchClip)
 {
-   // return on zero length strings
-   if( n < 1 )
-      return ptDraw.x;
-
-
-   MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad( rot ) ) );
-   Point3F offset( ptDraw.x, ptDraw.y, 0.0 );
-   Point3F points[4];
-
-   U32 nCharCount = 0;
-
-   Point2I     pt;
-   UTF16       c;
-   pt.x                 = 0;
-
-   ColorI                  currentColor;
-   S32                     currentPt = 0;
-
-   TextureObject *lastTexture = NULL;
+   if(sgTextVertices.empty())
+      return;
 
-   currentColor      = sg_bitmapModulation;
+   PROFILE_SCOPE(DrawText_Flush);
 
-   FrameTemp<TextVertex> vert(4*n);
+   // Batched glyphs were clipped as they were added so they are drawn under the clip
+   // the batch began with, which contains all the clips used since.
+   const RectI clipRect = sgCurrentClipRect;
+   const bool swapClip = useBatchClip && sgTextBatchClipRect != clipRect;
+   if(swapClip)
+      dglApplyClipRect(sgTextBatchClipRect);
 
    glDisable(GL_LIGHTING);
 
@@ -389,180 +362,77 @@ U32 dglDrawTextN(GFont*          font,
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glEnable(GL_BLEND);
 
-   //Luma: Optimise by setting states once before inner loop
    glEnableClientState ( GL_VERTEX_ARRAY );
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
-
-   // first build the point, color, and coord arrays
-   U32 i;
-
-   for(i = 0,c = in_string[i];in_string[i] && i < n;i++,c = in_string[i])
-   {
-      nCharCount++;
-      if(nCharCount > n)
-          break;
-
-      // We have to do a little dance here since \t = 0x9, \n = 0xa, and \r = 0xd
-      if ((c >=  1 && c <=  7) ||
-         (c >= 11 && c <= 12) ||
-         (c == 14))
-      {
-         // Color code
-         if (colorTable)
-         {
-            static U8 remap[15] =
-            {
-               0x0, // 0 special null terminator
-               0x0, // 1 ascii start-of-heading??
-               0x1, 
-               0x2, 
-               0x3, 
-               0x4, 
-               0x5, 
-               0x6, 
-               0x0, // 8 special backspace
-               0x0, // 9 special tab
-               0x0, // a special \n
-               0x7, 
-               0x8,
-               0x0, // a special \r
-               0x9 
-            };
-
-            U8 remapped = remap[c];
-            // Ignore if the color is greater than the specified max index:
-            if ( remapped <= maxColorIndex )
-            {
-               const ColorI &clr = colorTable[remapped];
-               sg_bitmapModulation = clr;
-               currentColor = clr;
-            }
-         }
-         continue;
-      }
+   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(sgTextVertices[0].p) );
 
-      // reset color?
-      if ( c == 15 )
-      {
-         currentColor = sg_textAnchorColor;
-         sg_bitmapModulation = sg_textAnchorColor;
-         continue;
-      }
-
-      // push color:
-      if ( c == 16 )
-      {
-         sg_stackColor = sg_bitmapModulation;
-         continue;
-      }
+   glEnableClientState ( GL_COLOR_ARRAY );
+   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(sgTextVertices[0].c) );
 
-      // pop color:
-      if ( c == 17 )
-      {
-         currentColor = sg_stackColor;
-         sg_bitmapModulation = sg_stackColor;
-         continue;
-      }
+   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
+   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(sgTextVertices[0].t) );
 
-      // Tab character
-      if ( c == dT('\t') ) 
-      {
-          const PlatformFont::CharInfo &ci = font->getCharInfo( dT(' ') );
-          pt.x += ci.xIncrement * GFont::TabWidthInSpaces;
-          continue;
-      }
+   glBindTexture(GL_TEXTURE_2D, sgTextTexture->getGLTextureName());
+   glDrawArrays( GL_TRIANGLES, 0, sgTextVertices.size() );
 
-      if( !font->isValidChar( c ) )  
-         continue;
+   glDisableClientState ( GL_VERTEX_ARRAY );
+   glDisableClientState ( GL_COLOR_ARRAY );
+   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
 
-      const PlatformFont::CharInfo &ci = font->getCharInfo(c);
+   glDisable(GL_BLEND);
+   glDisable(GL_TEXTURE_2D);
 
-      if(ci.bitmapIndex == -1)
-      {
-         pt.x += ci.xOrigin + ci.xIncrement;
-         continue;
-      }
+   if(swapClip)
+      dglApplyClipRect(clipRect);
 
-      TextureObject *newObj = font->getTextureHandle(ci.bitmapIndex);
-      if(newObj != lastTexture)
-      {
-         if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+   sgTextVertices.clear();
+}
 
-            //Luma:	More optimal rendering
-            for (S32 i=0; i<currentPt; i+=4) 
-            {
-                glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-            }
-            currentPt = 0;
-         }
-         lastTexture = newObj;
-      }
-      if(ci.width != 0 && ci.height != 0)
-      {
-         pt.y = font->getBaseline() - ci.yOrigin;
-         pt.x += ci.xOrigin;
+//------------------------------------------------------------------------------
 
-         F32 texLeft   = F32(ci.xOffset)             / F32(lastTexture->getTextureWidth());
-         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(lastTexture->getTextureWidth());
-         F32 texTop    = F32(ci.yOffset)             / F32(lastTexture->getTextureHeight());
-         F32 texBottom = F32(ci.yOffset + ci.height) / F32(lastTexture->getTextureHeight());
+void dglBeginTextBatch()
+{
+   if(sgTextBatchDepth++ == 0)
+      sgTextBatchClipRect = sgCurrentClipRect;
+}
 
-         F32 screenLeft   = pt.x;
-         F32 screenRight  = pt.x + ci.width;
-         F32 screenTop    = pt.y;
-         F32 screenBottom = pt.y + ci.height;
+void dglEndTextBatch()
+{
+   AssertFatal(sgTextBatchDepth > 0, "dglEndTextBatch - No text batch in progress.");
 
-         points[0] = Point3F(screenLeft, screenTop, 0.0);
-         points[1] = Point3F(screenRight,  screenTop, 0.0);
-         points[2] = Point3F( screenLeft,  screenBottom, 0.0);
-         points[3] = Point3F( screenRight, screenBottom, 0.0);
+   if(sgTextBatchDepth == 1)
+      dglFlushTextBatch();
 
-         for( int i=0; i<4; i++ )
-         {
-            rotMatrix.mulP( points[i] );
-            points[i] += offset;
-         }
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texTop, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texRight, texBottom, currentColor);
-         pt.x += ci.xIncrement - ci.xOrigin;
-      }
-      else
-         pt.x += ci.xIncrement;
-   }
-   if(currentPt)
-   {
-       //Luma:	More optimal rendering
-       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-       for (S32 i=0; i<currentPt; i+=4) 
-       {
-            glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-       }
-   }
+   sgTextBatchDepth--;
+}
 
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
+void dglFlushTextBatch()
+{
+   dglDrawTextVertices(sgTextBatchDepth > 0);
+}
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+//------------------------------------------------------------------------------
 
-   pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
+U32 dglDrawTextN(GFont*          font,
+                 const Point2I&  ptDraw,
+                 const UTF8*     in_string,
+                 U32             n,
+                 const ColorI*   colorTable,
+                 const U32       maxColorIndex,
+                 F32             rot)
+{
+   PROFILE_START(DrawText_UTF8);
+   
+   U32 len = dStrlen(in_string) + 1;
+   FrameTemp<UTF16> ubuf(len);
+   convertUTF8toUTF16(in_string, ubuf, len);
+   U32 tmp = dglDrawTextN(font, ptDraw, ubuf, n, colorTable, maxColorIndex, rot);
 
-   AssertFatal(pt.x >= ptDraw.x, "How did this happen?");
    PROFILE_END();
 
-   return pt.x - ptDraw.x;
+   return tmp;
 }
 
-#else
+//-----------------------------------------------------------------------------
 
 U32 dglDrawTextN(GFont*          font,
                  const Point2I&  ptDraw,
@@ -588,29 +458,25 @@ U32 dglDrawTextN(GFont*          font,
    pt.x                 = 0;
 
    ColorI                  currentColor;
-   S32                     currentPt = 0;
-
-   TextureObject *lastTexture = NULL;
 
    currentColor      = sg_bitmapModulation;
 
-   FrameTemp<TextVertex> vert(4*n);
+   // Rotated text can't be clipped as it's added so it's drawn straight away under the current clip.
+   const bool batched = sgTextBatchDepth > 0 && rot == 0.0f;
+   if(sgTextBatchDepth > 0 && !batched)
+      dglFlushTextBatch();
 
-   glDisable(GL_LIGHTING);
+   // Batched glyphs are clipped to the current clip as they're added.
+   RectI batchClip = sgCurrentClipRect;
+   if(batched && !batchClip.intersect(sgTextBatchClipRect))
+      batchClip.extent.set(0, 0);
+   const F32 clipLeft   = (F32)batchClip.point.x;
+   const F32 clipRight  = (F32)(batchClip.point.x + batchClip.extent.x);
+   const F32 clipTop    = (F32)batchClip.point.y;
+   const F32 clipBottom = (F32)(batchClip.point.y + batchClip.extent.y);
 
-   glEnable(GL_TEXTURE_2D);
-   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glEnable(GL_BLEND);
-
-   glEnableClientState ( GL_VERTEX_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
+   // Reserve the worst case up-front so the stream doesn't grow per glyph.
+   sgTextVertices.reserve( sgTextVertices.size() + 6*n );
 
    // first build the point, color, and coord arrays
    U32 i;
@@ -702,36 +568,33 @@ U32 dglDrawTextN(GFont*          font,
          continue;
       }
 
-      TextureObject *newObj = font->getTextureHandle(ci.bitmapIndex);
-      if(newObj != lastTexture)
+      // Glyphs on another sheet can't share the draw.
+      TextureObject *texture = font->getTextureHandle(ci.bitmapIndex);
+      if(texture != sgTextTexture)
       {
-         if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-            glDrawArrays( GL_QUADS, 0, currentPt );
-            currentPt = 0;
-         }
-         lastTexture = newObj;
+         dglDrawTextVertices(batched);
+         sgTextTexture = texture;
       }
+
       if(ci.width != 0 && ci.height != 0)
       {
          pt.y = font->getBaseline() - ci.yOrigin;
          pt.x += ci.xOrigin;
 
-         F32 texLeft   = F32(ci.xOffset)             / F32(lastTexture->getTextureWidth());
-         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(lastTexture->getTextureWidth());
-         F32 texTop    = F32(ci.yOffset)             / F32(lastTexture->getTextureHeight());
-         F32 texBottom = F32(ci.yOffset + ci.height) / F32(lastTexture->getTextureHeight());
+         F32 texLeft   = F32(ci.xOffset)             / F32(texture->getTextureWidth());
+         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(texture->getTextureWidth());
+         F32 texTop    = F32(ci.yOffset)             / F32(texture->getTextureHeight());
+         F32 texBottom = F32(ci.yOffset + ci.height) / F32(texture->getTextureHeight());
 
          F32 screenLeft   = (F32)pt.x;
          F32 screenRight  = (F32)(pt.x + ci.width);
          F32 screenTop    = (F32)pt.y;
          F32 screenBottom = (F32)(pt.y + ci.height);
 
-         points[0] = Point3F(screenLeft, screenBottom, 0.0);
-         points[1] = Point3F(screenRight,  screenBottom, 0.0);
-         points[2] = Point3F( screenRight,  screenTop, 0.0);
-         points[3] = Point3F( screenLeft, screenTop, 0.0);
+         points[0] = Point3F(screenLeft, screenTop, 0.0);
+         points[1] = Point3F(screenRight,  screenTop, 0.0);
+         points[2] = Point3F( screenLeft,  screenBottom, 0.0);
+         points[3] = Point3F( screenRight, screenBottom, 0.0);
 
          for( int i=0; i<4; i++ )
          {
@@ -739,27 +602,64 @@ U32 dglDrawTextN(GFont*          font,
             points[i] += offset;
          }
 
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texBottom, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texLeft, texTop, currentColor);
+         if(batched)
+         {
+            // Clip the glyph quad and its texture coordinates.
+            const F32 left   = points[0].x;
+            const F32 right  = points[3].x;
+            const F32 top    = points[0].y;
+            const F32 bottom = points[3].y;
+
+            if(right <= clipLeft || left >= clipRight || bottom <= clipTop || top >= clipBottom)
+            {
+               pt.x += ci.xIncrement - ci.xOrigin;
+               continue;
+            }
+
+            const F32 texWidth  = texRight - texLeft;
+            const F32 texHeight = texBottom - texTop;
+
+            if(left < clipLeft)
+            {
+               texLeft += texWidth * (clipLeft - left) / (right - left);
+               points[0].x = points[2].x = clipLeft;
+            }
+            if(right > clipRight)
+            {
+               texRight -= texWidth * (right - clipRight) / (right - left);
+               points[1].x = points[3].x = clipRight;
+            }
+            if(top < clipTop)
+            {
+               texTop += texHeight * (clipTop - top) / (bottom - top);
+               points[0].y = points[1].y = clipTop;
+            }
+            if(bottom > clipBottom)
+            {
+               texBottom -= texHeight * (bottom - clipBottom) / (bottom - top);
+               points[2].y = points[3].y = clipBottom;
+            }
+         }
+
+         // Two triangles per glyph so any number of glyphs can share a draw.
+         const U32 vertexStart = sgTextVertices.size();
+         sgTextVertices.increment( 6 );
+         TextVertex* vert = sgTextVertices.address() + vertexStart;
+         vert[0].set(points[0].x, points[0].y, texLeft, texTop, currentColor);
+         vert[1].set(points[1].x, points[1].y, texRight, texTop, currentColor);
+         vert[2].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
+         vert[3].set(points[1].x, points[1].y, texRight, texTop, currentColor);
+         vert[4].set(points[3].x, points[3].y, texRight, texBottom, currentColor);
+         vert[5].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
          pt.x += ci.xIncrement - ci.xOrigin;
       }
       else
          pt.x += ci.xIncrement;
    }
-   if(currentPt)
-   {
-      glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-      glDrawArrays( GL_QUADS, 0, currentPt );
-   }
-
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+   // Outside of a batch the text is drawn straight away.
+   if(!batched)
+      dglDrawTextVertices(false);
 
    pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
 
@@ -768,13 +668,14 @@ U32 dglDrawTextN(GFont*          font,
 
    return pt.x - ptDraw.x;
 }
-#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Drawing primitives
 
 void dglDrawLine(S32 x1, S32 y1, S32 x2, S32 y2, const ColorI &color)
 {
+   dglFlushTextBatch();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -807,6 +708,8 @@ void dglDrawLine(const Point2I &startPt, const Point2I &endPt, const ColorI &col
 
 void dglDrawRect(const Point2I &upperL, const Point2I &lowerR, const ColorI &color, const float &lineWidth)
 {
+   dglFlushTextBatch();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -848,6 +751,8 @@ void dglDrawRect(const RectI &rect, const ColorI &color, const float &lineWidth)
 
 void dglDrawRectFill(const Point2I &upperL, const Point2I &lowerR, const ColorI &color)
 {
+   dglFlushTextBatch();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -877,6 +782,8 @@ void dglDrawRectFill(const RectI &rect, const ColorI &color)
 
 void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
 {
+   dglFlushTextBatch();
+
    width *= 0.5;
 
    MatrixF rotMatrix( EulerF( 0.0, 0.0, spinAngle ) );
@@ -937,6 +844,8 @@ void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
 
 void dglDrawBillboard( const Point3F &position, F32 width, F32 spinAngle )
 {
+   dglFlushTextBatch();
+
    MatrixF modelview;
    dglGetModelview( &modelview );
    modelview.transpose();
@@ -1002,6 +911,8 @@ void dglDrawBillboard( const Point3F &position, F32 width, F32 spinAngle )
 
 void dglWireCube(const Point3F & extent, const Point3F & center)
 {
+   dglFlushTextBatch();
+
    static Point3F cubePoints[8] =
    {
       Point3F(-1, -1, -1), Point3F(-1, -1,  1), Point3F(-1,  1, -1), Point3F(-1,  1,  1),
@@ -1059,6 +970,8 @@ void dglWireCube(const Point3F & extent, const Point3F & center)
 
 void dglSolidCube(const Point3F & extent, const Point3F & center)
 {
+   dglFlushTextBatch();
+
    static Point3F cubePoints[8] =
    {
       Point3F(-1, -1, -1), Point3F(-1, -1,  1), Point3F(-1,  1, -1), Point3F(-1,  1,  1),
@@ -1112,6 +1025,14 @@ void dglSolidCube(const Point3F & extent, const Point3F & center)
 }
 
 void dglSetClipRect(const RectI &clipRect)
+{
+   // NOTE:- Batched text doesn't need flushing here as it's clipped as it's added.
+   dglApplyClipRect(clipRect);
+
+   sgCurrentClipRect = clipRect;
+}
+
+static void dglApplyClipRect(const RectI &clipRect)
 {
    glMatrixMode(GL_PROJECTION);
    glLoadIdentity();
@@ -1135,8 +1056,6 @@ void dglSetClipRect(const RectI &clipRect)
 
    glViewport(clipRect.point.x, screenHeight - (clipRect.point.y + clipRect.extent.y),
               clipRect.extent.x, clipRect.extent.y);
-
-   sgCurrentClipRect = clipRect;
 }
 
 const RectI& dglGetClipRect()
@@ -1300,6 +1219,8 @@ bool dglIsInCanonicalState()
 
 void dglSetCanonicalState()
 {
+   dglFlushTextBatch();
+
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 // PUAP -Mat removed unsupported textureARB and Fog stuff
    glDisable(GL_BLEND);
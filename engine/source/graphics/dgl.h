@@ -164,6 +164,14 @@ U32 dglDrawText(GFont *font, const Point2I &ptDraw, const UTF8 *in_string, const
 U32 dglDrawTextN(GFont *font, const Point2I &ptDraw, const UTF16 *in_string, U32 n, const ColorI *colorTable = NULL, const U32 maxColorIndex = 9, F32 rot = 0.f);
 /// Converts UTF8 text to UTF16, and calls the UTF16 version of dglDrawTextN
 U32 dglDrawTextN(GFont *font, const Point2I &ptDraw, const UTF8  *in_string, U32 n, const ColorI *colorTable = NULL, const U32 maxColorIndex = 9, F32 rot = 0.f);
+/// Begins batching text so that consecutive text draws share as few draw calls as possible.
+/// Batched text is drawn when the batch ends or before any other dgl drawing, but not before
+/// raw GL drawing so only use a batch around code that draws with dgl alone.  Batches can nest.
+void dglBeginTextBatch();
+/// Ends a text batch, drawing any batched text when the outermost batch ends.
+void dglEndTextBatch();
+/// Draws any batched text now.
+void dglFlushTextBatch();
 /// @}
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Drawing primitives
@@ -149,6 +149,7 @@ GFont::GFont()
    mSize = 0;
    mCharSet = 0;
    mNeedSave = false;
+   mDeferSheetRefresh = false;
    
    mMutex = Mutex::createMutex();
 }
@@ -317,7 +318,9 @@ void GFont::addBitmap(PlatformFont::CharInfo &charInfo)
       }
    }
    
-   mTextureSheets[mCurSheet].refresh();
+   // Baking refreshes all the touched sheets once it's done.
+   if(!mDeferSheetRefresh)
+      mTextureSheets[mCurSheet].refresh();
 }
 
 void GFont::addSheet()
@@ -376,6 +379,52 @@ const PlatformFont::CharInfo &GFont::getDefaultCharInfo()
 
 //////////////////////////////////////////////////////////////////////////
 
+U32 GFont::bakeCharacters(const UTF16* pCharacters)
+{
+   PROFILE_SCOPE(GFont_BakeCharacters);
+
+   if(pCharacters == NULL)
+      return 0;
+
+   // Defer sheet uploads until all the characters are in.
+   const S32 firstSheet = getMax(mCurSheet, 0);
+   mDeferSheetRefresh = true;
+
+   U32 bakedCount = 0;
+   for(const UTF16* pScan = pCharacters; *pScan; ++pScan)
+   {
+      if(mRemapTable[*pScan] != -1)
+         continue;
+
+      if(loadCharInfo(*pScan))
+         ++bakedCount;
+   }
+
+   mDeferSheetRefresh = false;
+
+   if(bakedCount > 0)
+   {
+      for(S32 i = firstSheet; i < mTextureSheets.size(); ++i)
+         mTextureSheets[i].refresh();
+   }
+
+   return bakedCount;
+}
+
+U32 GFont::bakeCharacters(const UTF8* pCharacters)
+{
+   if(pCharacters == NULL)
+      return 0;
+
+   const U32 len = dStrlen(pCharacters) + 1;
+   FrameTemp<UTF16> buffer(len);
+   convertUTF8toUTF16(pCharacters, buffer, len);
+
+   return bakeCharacters(buffer);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 U32 GFont::getStrWidth(const UTF8* in_pString)
 {
    AssertFatal(in_pString != NULL, "GFont::getStrWidth: String is NULL, width is undefined");
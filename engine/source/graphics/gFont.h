@@ -82,6 +82,7 @@ private:
    S32 mCurSheet;
 
    bool mNeedSave;
+   bool mDeferSheetRefresh;
    StringTableEntry mGFTFile;
    StringTableEntry mFaceName;
    U32 mSize;
@@ -130,6 +131,12 @@ public:
    const U32 getAscent() const   { return mAscent; }
    const U32 getDescent() const  { return mDescent; }
 
+   /// Rasterise the specified characters into the texture sheets up-front so drawing them later
+   /// does not cause glyph generation or texture uploads.  Each sheet touched is uploaded once.
+   /// @return The number of characters that were added.
+   U32 bakeCharacters(const UTF16* pCharacters);
+   U32 bakeCharacters(const UTF8* pCharacters);
+
    U32 getBreakPos(const UTF16 *string, U32 strlen, U32 width, bool breakOnWhitespace);
 
    /// These are the preferred width functions.
@@ -48,8 +48,7 @@ ConsoleFunctionWithDocs(populateFontCacheString, ConsoleVoid, 4, 4, (faceName, s
       return;
    }
 
-   // This has the side effect of generating character info, including the bitmaps.
-   f->getStrWidthPrecise(argv[3]);
+   f->bakeCharacters(argv[3]);
 }
 
 /*! 
@@ -86,14 +85,18 @@ ConsoleFunctionWithDocs(populateFontCacheRange, ConsoleVoid, 5, 5, (faceName, si
       return;
    }
 
-   // This has the side effect of generating character info, including the bitmaps.
+   // Gather the valid characters so they can be baked in one go.
+   Vector<UTF16> characters;
    for(U32 i=rangeStart; i<rangeEnd; i++)
    {
-      if(f->isValidChar(i))
-         f->getCharWidth(i);
+      if(i != 0 && f->isValidChar(i))
+         characters.push_back((UTF16)i);
       else
          Con::warnf("populateFontCacheRange - skipping invalid char 0x%x",  i);
    }
+   characters.push_back(0);
+
+   f->bakeCharacters(characters.address());
 
    // All done!
 }
@@ -196,8 +199,7 @@ ConsoleFunctionWithDocs(populateAllFontCacheString, ConsoleVoid, 2, 2, (string i
          continue;
       }
 
-      // This has the side effect of generating character info, including the bitmaps.
-      font->getStrWidthPrecise(argv[1]);
+      font->bakeCharacters(argv[1]);
    }
 }
 
@@ -241,15 +243,19 @@ ConsoleFunctionWithDocs(populateAllFontCacheRange, ConsoleVoid, 3, 3, (rangeStar
          continue;
       }
 
-      // This has the side effect of generating character info, including the bitmaps.
+      // Gather the valid characters so they can be baked in one go.
       Con::printf("   o Populating font '%s'", curMatch);
+      Vector<UTF16> characters;
       for(U32 i=rangeStart; i<rangeEnd; i++)
       {
-         if(font->isValidChar(i))
-            font->getCharWidth(i);
+         if(i != 0 && font->isValidChar(i))
+            characters.push_back((UTF16)i);
          else
             Con::warnf("populateAllFontCacheRange - skipping invalid char 0x%x",  i);
       }
+      characters.push_back(0);
+
+      font->bakeCharacters(characters.address());
    }
    // All done!
 }
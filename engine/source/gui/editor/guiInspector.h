@@ -177,17 +177,17 @@ private:
    typedef GuiInspectorField Parent;
    SimObjectPtr<GuiControl>     mRenameCtrl;
 public:
-   SimFieldDictionary::Entry*   mDynField;
+   StringTableEntry             mDynFieldName;
 
    GuiInspectorDynamicField( GuiInspectorGroup* parent, SimObjectPtr<SimObject> target, SimFieldDictionary::Entry* field );
-   GuiInspectorDynamicField() {};
+   GuiInspectorDynamicField() { mDynFieldName = NULL; };
    ~GuiInspectorDynamicField() {};
    DECLARE_CONOBJECT(GuiInspectorDynamicField);
 
    virtual void setData( const char* data );
    virtual const char* getData();
 
-   virtual StringTableEntry getFieldName() { return ( mDynField != NULL ) ? mDynField->slotName : StringTable->EmptyString; };
+   virtual StringTableEntry getFieldName() { return ( mDynFieldName != NULL ) ? mDynFieldName : StringTable->EmptyString; };
 
    // Override onAdd so we can construct our custom field name edit control
    virtual bool onAdd();
@@ -278,6 +278,8 @@ void GuiCanvas::processMouseMoveEvent(const MouseMoveEvent *event)
 
 bool GuiCanvas::processInputEvent(const InputEvent *event)
 {
+    MemoryTagScope memoryTagScope(MemoryTag_GUI);
+
     // First call the general input handler (on the extremely off-chance that it will be handled):
     if ( mFirstResponder )
    {
@@ -1161,6 +1163,8 @@ void GuiCanvas::maintainSizing()
 
 void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
 {
+   MemoryTagScope memoryTagScope(MemoryTag_GUI);
+
    PROFILE_START(CanvasPreRender);
 
 #if !defined TORQUE_OS_IOS && !defined TORQUE_OS_ANDROID && !defined TORQUE_OS_EMSCRIPTEN
@@ -288,6 +288,8 @@ void GuiMLTextCtrl::onRender(Point2I offset, const RectI& updateRect)
    }
 
    // draw all the text and dividerStyles
+   // NOTE:- The text is batched as it's the bulk of what's drawn here.
+   dglBeginTextBatch();
    for(Line *lwalk = mLineList; lwalk; lwalk = lwalk->next)
    {
       RectI lineRect(offset.x, offset.y + lwalk->y, mBounds.extent.x, lwalk->height);
@@ -319,6 +321,7 @@ void GuiMLTextCtrl::onRender(Point2I offset, const RectI& updateRect)
          }
       }
    }
+   dglEndTextBatch();
    dglClearBitmapModulation();
 }
 
@@ -327,6 +327,14 @@ void GuiTextListCtrl::onCellSelected(Point2I cell)
       Con::evaluate(mConsoleCommand, false);
 }
 
+void GuiTextListCtrl::onRender(Point2I offset, const RectI &updateRect)
+{
+   // The rows are mostly text so batch it across all of them.
+   dglBeginTextBatch();
+   Parent::onRender(offset, updateRect);
+   dglEndTextBatch();
+}
+
 void GuiTextListCtrl::onRenderCell(Point2I offset, Point2I cell, bool selected, bool mouseOver)
 {
    if ( mList[cell.y].active )
@@ -99,6 +99,7 @@ class GuiTextListCtrl : public GuiArrayCtrl
 
    bool onKeyDown(const GuiEvent &event);
 
+   virtual void onRender(Point2I offset, const RectI &updateRect);
    virtual void onRenderCell(Point2I offset, Point2I cell, bool selected, bool mouseOver);
 
    void setSize(Point2I newSize);
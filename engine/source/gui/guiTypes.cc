@@ -153,6 +153,7 @@ GuiControlProfile::GuiControlProfile(void) :
     mFontType      = StringTable->EmptyString;
     mFontSize      = 12;
     mFontCharset   = TGE_ANSI_CHARSET;
+    mFontCharacters = StringTable->EmptyString;
     mFontColors[BaseColor].set(255,255,255,255);
     
     // default bitmap
@@ -193,6 +194,7 @@ GuiControlProfile::GuiControlProfile(void) :
       mFontType      = def->mFontType;
       mFontSize      = def->mFontSize;
       mFontCharset   = def->mFontCharset;
+      mFontCharacters = def->mFontCharacters;
 
       for(U32 i = 0; i < 10; i++)
          mFontColors[i] = def->mFontColors[i];
@@ -243,6 +245,7 @@ void GuiControlProfile::initPersistFields()
    addField("fontType",      TypeString,     Offset(mFontType, GuiControlProfile));
    addField("fontSize",      TypeS32,        Offset(mFontSize, GuiControlProfile));
    addField("fontCharset",   TypeEnum,       Offset(mFontCharset, GuiControlProfile), 1, &gCharsetTable);
+   addField("fontCharacters", TypeString,    Offset(mFontCharacters, GuiControlProfile));
    addField("fontColors",    TypeColorI,     Offset(mFontColors, GuiControlProfile), 10);
    addField("fontColor",     TypeColorI,     Offset(mFontColors[BaseColor], GuiControlProfile));
    addField("fontColorHL",   TypeColorI,     Offset(mFontColors[ColorHL], GuiControlProfile));
@@ -361,6 +364,8 @@ void GuiControlProfile::incRefCount()
       mFont = GFont::create(mFontType, mFontSize, sFontCacheDirectory);
       if (mFont.isNull())
          Con::errorf("Failed to load/create profile font (%s/%d)", mFontType, mFontSize);
+      else if (mFontCharacters != NULL && *mFontCharacters)
+         mFont->bakeCharacters(mFontCharacters);
        
       if ( mBitmapName != NULL && mBitmapName != StringTable->EmptyString )
       {
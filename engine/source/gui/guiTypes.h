@@ -147,6 +147,7 @@ public:
    ColorI& mFontColorNA;                           ///< Font color when object is not active/disabled
    ColorI& mFontColorSEL;                          ///< Font color when object/text is selected
    FontCharset mFontCharset;                       ///< Font character set
+   StringTableEntry mFontCharacters;               ///< Characters baked into the font sheets when the font is loaded
 
    Resource<GFont>   mFont;                        ///< Font resource
 
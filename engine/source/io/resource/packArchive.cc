@@ -0,0 +1,501 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "io/resource/packArchive.h"
+#include "io/fileStream.h"
+#include "io/memstream.h"
+#include "math/mMathFn.h"
+#include "string/stringTable.h"
+#include "console/console.h"
+
+#include "zlib.h"
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+   /// A memory stream which owns the buffer it reads from.
+   class PackInflatedStream : public MemStream
+   {
+      typedef MemStream Parent;
+
+      void* mpBuffer;
+
+   public:
+      PackInflatedStream(const U32 size, void* pBuffer) :
+         Parent(size, pBuffer, true, false),
+         mpBuffer(pBuffer)
+      {
+      }
+
+      virtual ~PackInflatedStream()
+      {
+         dFree(mpBuffer);
+      }
+   };
+
+   struct PackSourceFile
+   {
+      char mName[1024];
+      char mFullPath[1024];
+      U32 mHash;
+   };
+
+   static S32 QSORT_CALLBACK packSourceFileCompare(const void* a, const void* b)
+   {
+      const PackSourceFile* pFileA = *(const PackSourceFile**)a;
+      const PackSourceFile* pFileB = *(const PackSourceFile**)b;
+
+      if(pFileA->mHash != pFileB->mHash)
+         return pFileA->mHash < pFileB->mHash ? -1 : 1;
+
+      return dStricmp(pFileA->mName, pFileB->mName);
+   }
+
+   static inline char normalizeNameChar(const char c)
+   {
+      return c == '\\' ? '/' : dTolower(c);
+   }
+
+   static bool writePadding(Stream& stream, const U32 alignment)
+   {
+      static const U8 zeros[PackArchive::EntryAlignment] = { 0 };
+
+      const U32 remainder = stream.getPosition() % alignment;
+      if(remainder == 0)
+         return true;
+
+      return stream.write(alignment - remainder, zeros);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+PackArchive::PackArchive() :
+   mFilename(StringTable->EmptyString),
+   mpData(NULL),
+   mDataSize(0),
+   mpNames(NULL)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+PackArchive::~PackArchive()
+{
+   closeArchive();
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackArchive::openArchive(const char* pFilename)
+{
+   // Close any existing pack.
+   closeArchive();
+
+   mpData = (U8*)Platform::mapFile(pFilename, mDataSize);
+   if(mpData == NULL)
+   {
+      Con::errorf("PackArchive::openArchive() - Could not open pack '%s'.", pFilename);
+      return false;
+   }
+
+   // Fetch the header.
+   if(mDataSize < sizeof(Header))
+   {
+      Con::errorf("PackArchive::openArchive() - Pack '%s' is truncated.", pFilename);
+      closeArchive();
+      return false;
+   }
+
+   const U32* pHeader = (const U32*)mpData;
+   Header header;
+   header.mSignature = convertLEndianToHost(pHeader[0]);
+   header.mVersion = convertLEndianToHost(pHeader[1]);
+   header.mEntryCount = convertLEndianToHost(pHeader[2]);
+   header.mIndexOffset = convertLEndianToHost(pHeader[3]);
+   header.mNamesOffset = convertLEndianToHost(pHeader[4]);
+   header.mNamesSize = convertLEndianToHost(pHeader[5]);
+
+   if(header.mSignature != Signature || header.mVersion != Version)
+   {
+      Con::errorf("PackArchive::openArchive() - '%s' is not a version %d pack.", pFilename, Version);
+      closeArchive();
+      return false;
+   }
+
+   // Sanity!
+   if(header.mIndexOffset > mDataSize ||
+      header.mEntryCount > (mDataSize - header.mIndexOffset) / sizeof(Entry) ||
+      header.mNamesOffset > mDataSize ||
+      header.mNamesSize > mDataSize - header.mNamesOffset ||
+      (header.mEntryCount > 0 && header.mNamesSize == 0) ||
+      (header.mNamesSize > 0 && mpData[header.mNamesOffset + header.mNamesSize - 1] != 0))
+   {
+      Con::errorf("PackArchive::openArchive() - Pack '%s' is corrupt.", pFilename);
+      closeArchive();
+      return false;
+   }
+
+   mpNames = (const char*)(mpData + header.mNamesOffset);
+
+   // Fetch the index.
+   mEntries.setSize(header.mEntryCount);
+   const U32* pIndex = (const U32*)(mpData + header.mIndexOffset);
+   for(U32 index = 0; index < header.mEntryCount; ++index, pIndex += sizeof(Entry) / sizeof(U32))
+   {
+      Entry& entry = mEntries[index];
+      entry.mHash = convertLEndianToHost(pIndex[0]);
+      entry.mNameOffset = convertLEndianToHost(pIndex[1]);
+      entry.mOffset = convertLEndianToHost(pIndex[2]);
+      entry.mStoredSize = convertLEndianToHost(pIndex[3]);
+      entry.mSize = convertLEndianToHost(pIndex[4]);
+      entry.mMethod = convertLEndianToHost(pIndex[5]);
+
+      // Sanity!
+      if(entry.mNameOffset >= header.mNamesSize ||
+         entry.mOffset > mDataSize ||
+         entry.mStoredSize > mDataSize - entry.mOffset ||
+         (entry.mMethod != Stored && entry.mMethod != Deflated) ||
+         (entry.mMethod == Stored && entry.mStoredSize != entry.mSize))
+      {
+         Con::errorf("PackArchive::openArchive() - Pack '%s' has a corrupt entry at index %d.", pFilename, index);
+         closeArchive();
+         return false;
+      }
+   }
+
+   mFilename = StringTable->insert(pFilename);
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void PackArchive::closeArchive(void)
+{
+   if(mpData != NULL)
+   {
+      Platform::unmapFile(mpData, mDataSize);
+      mpData = NULL;
+   }
+
+   mDataSize = 0;
+   mpNames = NULL;
+   mEntries.clear();
+   mFilename = StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+const PackArchive::Entry* PackArchive::findEntry(const char* pEntryName) const
+{
+   const U32 hash = hashName(pEntryName);
+
+   // Find the first entry with the hash.
+   S32 low = 0;
+   S32 high = mEntries.size();
+   while(low < high)
+   {
+      const S32 middle = (low + high) >> 1;
+
+      if(mEntries[middle].mHash < hash)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   // Check each entry with the hash.
+   for(S32 index = low; index < mEntries.size() && mEntries[index].mHash == hash; ++index)
+   {
+      const char* pName = getEntryName(mEntries[index]);
+      const char* pSearch = pEntryName;
+
+      while(*pName && normalizeNameChar(*pName) == normalizeNameChar(*pSearch))
+      {
+         ++pName;
+         ++pSearch;
+      }
+
+      if(*pName == 0 && *pSearch == 0)
+         return &mEntries[index];
+   }
+
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+Stream* PackArchive::openEntryForRead(const Entry* pEntry) const
+{
+   // Sanity!
+   AssertFatal(isOpen(), "PackArchive::openEntryForRead() - Pack is not open.");
+   AssertFatal(pEntry != NULL, "PackArchive::openEntryForRead() - Entry is NULL.");
+
+   // Stored entries are read directly from the mapped pack.
+   if(pEntry->mMethod == Stored)
+      return new MemStream(pEntry->mSize, mpData + pEntry->mOffset, true, false);
+
+   // Deflated entries are inflated in one pass.
+   void* pBuffer = dMalloc(getMax(pEntry->mSize, (U32)1));
+   if(!readEntry(pEntry, pBuffer))
+   {
+      dFree(pBuffer);
+      return NULL;
+   }
+
+   return new PackInflatedStream(pEntry->mSize, pBuffer);
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackArchive::readEntry(const Entry* pEntry, void* pBuffer) const
+{
+   // Sanity!
+   AssertFatal(isOpen(), "PackArchive::readEntry() - Pack is not open.");
+   AssertFatal(pEntry != NULL, "PackArchive::readEntry() - Entry is NULL.");
+
+   if(pEntry->mMethod == Stored)
+   {
+      dMemcpy(pBuffer, mpData + pEntry->mOffset, pEntry->mSize);
+      return true;
+   }
+
+   uLongf inflatedSize = pEntry->mSize;
+   if(uncompress((Bytef*)pBuffer, &inflatedSize, mpData + pEntry->mOffset, pEntry->mStoredSize) != Z_OK || inflatedSize != pEntry->mSize)
+   {
+      Con::errorf("PackArchive::readEntry() - Could not inflate '%s' in pack '%s'.", getEntryName(*pEntry), mFilename);
+      return false;
+   }
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 PackArchive::hashName(const char* pEntryName)
+{
+   // FNV-1a.
+   U32 hash = 2166136261U;
+   for(const char* pScan = pEntryName; *pScan; ++pScan)
+   {
+      hash ^= (U8)normalizeNameChar(*pScan);
+      hash *= 16777619U;
+   }
+
+   return hash;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackArchive::buildArchive(const char* pPackFilename, const char* pSourcePath, const bool compress)
+{
+   // Fetch the source path without any trailing slash.
+   char sourcePath[1024];
+   dStrncpy(sourcePath, pSourcePath, sizeof(sourcePath));
+   sourcePath[sizeof(sourcePath)-1] = 0;
+   U32 sourcePathLength = dStrlen(sourcePath);
+   while(sourcePathLength > 0 && (sourcePath[sourcePathLength-1] == '/' || sourcePath[sourcePathLength-1] == '\\'))
+      sourcePath[--sourcePathLength] = 0;
+
+   Vector<Platform::FileInfo> files;
+   if(!Platform::dumpPath(sourcePath, files))
+   {
+      Con::errorf("PackArchive::buildArchive() - Could not scan source path '%s'.", sourcePath);
+      return false;
+   }
+
+   char packFullPath[1024];
+   Platform::makeFullPathName(pPackFilename, packFullPath, sizeof(packFullPath));
+
+   // Name the source files relative to the source path.
+   Vector<PackSourceFile*> sourceFiles;
+   for(S32 index = 0; index < files.size(); ++index)
+   {
+      const Platform::FileInfo& fileInfo = files[index];
+
+      PackSourceFile* pSourceFile = new PackSourceFile;
+      dSprintf(pSourceFile->mFullPath, sizeof(pSourceFile->mFullPath), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName);
+
+      // Ignore the pack itself if it's being written into the source path.
+      char sourceFullPath[1024];
+      Platform::makeFullPathName(pSourceFile->mFullPath, sourceFullPath, sizeof(sourceFullPath));
+      if(dStricmp(sourceFullPath, packFullPath) == 0)
+      {
+         delete pSourceFile;
+         continue;
+      }
+
+      const char* pRelativePath = fileInfo.pFullPath;
+      if(dStrnicmp(pRelativePath, sourcePath, sourcePathLength) == 0)
+         pRelativePath += sourcePathLength;
+      while(*pRelativePath == '/' || *pRelativePath == '\\')
+         ++pRelativePath;
+
+      if(*pRelativePath)
+         dSprintf(pSourceFile->mName, sizeof(pSourceFile->mName), "%s/%s", pRelativePath, fileInfo.pFileName);
+      else
+         dStrcpy(pSourceFile->mName, fileInfo.pFileName);
+
+      for(char* pScan = pSourceFile->mName; *pScan; ++pScan)
+      {
+         if(*pScan == '\\')
+            *pScan = '/';
+      }
+
+      pSourceFile->mHash = hashName(pSourceFile->mName);
+      sourceFiles.push_back(pSourceFile);
+   }
+
+   // Sort the files so the index can be binary searched.
+   dQsort(sourceFiles.address(), sourceFiles.size(), sizeof(PackSourceFile*), packSourceFileCompare);
+
+   bool success = true;
+
+   FileStream packStream;
+   if(!packStream.open(pPackFilename, FileStream::Write))
+   {
+      Con::errorf("PackArchive::buildArchive() - Could not open pack '%s' for writing.", pPackFilename);
+      success = false;
+   }
+
+   // Reserve the header.
+   Header header;
+   dMemset(&header, 0, sizeof(header));
+   if(success)
+      success = packStream.write(sizeof(header), &header) && writePadding(packStream, EntryAlignment);
+
+   // Write the entry data.
+   Vector<Entry> entries;
+   U32 namesSize = 0;
+   U32 storedTotal = 0;
+   U32 sizeTotal = 0;
+   for(S32 index = 0; success && index < sourceFiles.size(); ++index)
+   {
+      const PackSourceFile* pSourceFile = sourceFiles[index];
+
+      FileStream sourceStream;
+      if(!sourceStream.open(pSourceFile->mFullPath, FileStream::Read))
+      {
+         Con::errorf("PackArchive::buildArchive() - Could not read file '%s'.", pSourceFile->mFullPath);
+         success = false;
+         break;
+      }
+
+      const U32 size = sourceStream.getStreamSize();
+      U8* pSourceData = (U8*)dMalloc(getMax(size, (U32)1));
+      success = sourceStream.read(size, pSourceData);
+      sourceStream.close();
+
+      const U8* pStoredData = pSourceData;
+      U32 storedSize = size;
+      U32 method = Stored;
+      U8* pDeflatedData = NULL;
+
+      // Deflate the entry but only keep it if it saves at least an eighth.
+      if(success && compress && size > 0)
+      {
+         uLongf deflatedSize = compressBound(size);
+         pDeflatedData = (U8*)dMalloc(deflatedSize);
+         if(compress2(pDeflatedData, &deflatedSize, pSourceData, size, Z_BEST_COMPRESSION) == Z_OK && deflatedSize < size - (size >> 3))
+         {
+            pStoredData = pDeflatedData;
+            storedSize = (U32)deflatedSize;
+            method = Deflated;
+         }
+      }
+
+      Entry entry;
+      entry.mHash = pSourceFile->mHash;
+      entry.mNameOffset = namesSize;
+      entry.mOffset = packStream.getPosition();
+      entry.mStoredSize = storedSize;
+      entry.mSize = size;
+      entry.mMethod = method;
+      entries.push_back(entry);
+
+      if(success)
+         success = packStream.write(storedSize, pStoredData) && writePadding(packStream, EntryAlignment);
+
+      namesSize += dStrlen(pSourceFile->mName) + 1;
+      storedTotal += storedSize;
+      sizeTotal += size;
+
+      dFree(pSourceData);
+      if(pDeflatedData != NULL)
+         dFree(pDeflatedData);
+   }
+
+   // Write the index.
+   header.mIndexOffset = packStream.getPosition();
+   for(S32 index = 0; success && index < entries.size(); ++index)
+   {
+      const Entry& entry = entries[index];
+      success =
+         packStream.write(entry.mHash) &&
+         packStream.write(entry.mNameOffset) &&
+         packStream.write(entry.mOffset) &&
+         packStream.write(entry.mStoredSize) &&
+         packStream.write(entry.mSize) &&
+         packStream.write(entry.mMethod);
+   }
+
+   // Write the names.
+   header.mNamesOffset = packStream.getPosition();
+   header.mNamesSize = namesSize;
+   for(S32 index = 0; success && index < sourceFiles.size(); ++index)
+   {
+      const PackSourceFile* pSourceFile = sourceFiles[index];
+      success = packStream.write(dStrlen(pSourceFile->mName) + 1, pSourceFile->mName);
+   }
+
+   // Write the header.
+   if(success)
+   {
+      header.mSignature = Signature;
+      header.mVersion = Version;
+      header.mEntryCount = entries.size();
+      success =
+         packStream.setPosition(0) &&
+         packStream.write(header.mSignature) &&
+         packStream.write(header.mVersion) &&
+         packStream.write(header.mEntryCount) &&
+         packStream.write(header.mIndexOffset) &&
+         packStream.write(header.mNamesOffset) &&
+         packStream.write(header.mNamesSize);
+   }
+
+   packStream.close();
+
+   for(S32 index = 0; index < sourceFiles.size(); ++index)
+      delete sourceFiles[index];
+
+   if(!success)
+   {
+      Con::errorf("PackArchive::buildArchive() - Failed to build pack '%s'.", pPackFilename);
+      return false;
+   }
+
+   Con::printf("Built pack '%s' with %d entries (%d bytes stored, %d bytes expanded).", pPackFilename, entries.size(), storedTotal, sizeTotal);
+
+   return true;
+}
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PACK_ARCHIVE_H_
+#define _PACK_ARCHIVE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// A read-only, random-access archive of files stored in a single pack file.
+///
+/// The pack file is laid out as:
+///   - A header (see PackArchive::Header).
+///   - The entry data, each entry starting on a PackArchive::EntryAlignment boundary.
+///   - The index, a table of PackArchive::Entry sorted by the hash of the entry name.
+///   - The names, a block of NUL terminated entry names referenced by the index.
+///
+/// All values are stored little-endian.  Each entry is either stored verbatim or deflated
+/// with zlib, whichever is chosen when the pack is built.
+///
+/// The pack is mapped into memory (see Platform::mapFile()) when opened so stored entries are
+/// served directly from the mapped view without any copying or file handles.  Deflated
+/// entries are inflated into their own buffer in a single pass when opened.
+///
+/// Packs are built from a directory tree with PackArchive::buildArchive().
+class PackArchive
+{
+public:
+   enum Constants
+   {
+      Signature = 0x4B415054,    ///< "TPAK"
+      Version = 1,
+      EntryAlignment = 4096,
+   };
+
+   enum Method
+   {
+      Stored = 0,
+      Deflated = 8,
+   };
+
+   struct Header
+   {
+      U32 mSignature;
+      U32 mVersion;
+      U32 mEntryCount;
+      U32 mIndexOffset;
+      U32 mNamesOffset;
+      U32 mNamesSize;
+   };
+
+   struct Entry
+   {
+      U32 mHash;                 ///< Hash of the entry name (see PackArchive::hashName()).
+      U32 mNameOffset;           ///< Offset of the entry name in the names block.
+      U32 mOffset;               ///< Offset of the entry data in the pack.
+      U32 mStoredSize;           ///< Size of the entry data in the pack.
+      U32 mSize;                 ///< Size of the entry once expanded.
+      U32 mMethod;               ///< How the entry data is stored (see PackArchive::Method).
+   };
+
+private:
+   StringTableEntry mFilename;
+   U8* mpData;
+   U32 mDataSize;
+   Vector<Entry> mEntries;
+   const char* mpNames;
+
+public:
+   PackArchive();
+   virtual ~PackArchive();
+
+   /// Open a pack file for reading.
+   bool openArchive(const char* pFilename);
+
+   /// Close the pack, releasing the mapped view.
+   /// All streams opened from the pack must be closed first.
+   void closeArchive(void);
+
+   inline bool isOpen(void) const                   { return mpData != NULL; }
+   inline StringTableEntry getFilename(void) const  { return mFilename; }
+   inline U32 getEntryCount(void) const             { return (U32)mEntries.size(); }
+   inline const Entry& getEntry(const U32 index) const { return mEntries[index]; }
+   inline const char* getEntryName(const Entry& entry) const { return mpNames + entry.mNameOffset; }
+
+   /// Find an entry by its name relative to the pack root.  Lookup is case-insensitive.
+   const Entry* findEntry(const char* pEntryName) const;
+
+   /// Open an entry for reading.  The stream should be deleted when finished with.
+   Stream* openEntryForRead(const Entry* pEntry) const;
+
+   /// Read an entry into the specified buffer which must be at least Entry::mSize bytes.
+   bool readEntry(const Entry* pEntry, void* pBuffer) const;
+
+   /// Hash an entry name.  Back-slashes are treated as forward-slashes and case is ignored.
+   static U32 hashName(const char* pEntryName);
+
+   /// Build a pack file from all the files found recursively in the source path.
+   /// Entries are deflated unless that does not make them meaningfully smaller.
+   static bool buildArchive(const char* pPackFilename, const char* pSourcePath, const bool compress = true);
+};
+
+#endif // _PACK_ARCHIVE_H_
@@ -54,6 +54,8 @@ ResourceObject::ResourceObject ()
   mInstance = NULL;
   mZipArchive = NULL;
   mCentralDir = NULL;
+  mPackArchive = NULL;
+  mPackEntry = NULL;
 }
 
 void ResourceObject::destruct ()
@@ -68,6 +70,7 @@ void ResourceObject::destruct ()
       // [tom, 10/26/2006] We don't want to delete if it's a volume block since
       // the archive will be freed when the zip file resource object is freed.
       SAFE_DELETE(mZipArchive);
+      SAFE_DELETE(mPackArchive);
    }
 }
 
@@ -344,6 +347,25 @@ bool ResManager::addVFSRoot(Zip::ZipArchive *vfs)
    return scanZip(ro);
 }
 
+bool ResManager::addVFSRoot(PackArchive *vfs)
+{
+   ResourceObject *ro = createResource (StringTable->EmptyString, StringTable->EmptyString);
+   dictionary.pushBehind (ro, ResourceObject::File);
+
+   // Using VolumeBlock here so that destruct() doesnt try and delete the pack.
+   ro->flags = ResourceObject::VolumeBlock;
+   ro->fileOffset = 0;
+   ro->fileSize = 0;
+   ro->compressedFileSize = 0;
+   ro->mPackArchive = vfs;
+   ro->zipPath = StringTable->EmptyString;
+   ro->zipName = StringTable->EmptyString;
+
+   usingVFS = true;
+
+   return scanPack(ro);
+}
+
 bool ResManager::scanZip (ResourceObject * zipObject)
 {
    const char *zipPath = buildPath(zipObject->zipPath, zipObject->zipName);
@@ -415,6 +437,66 @@ bool ResManager::scanZip (ResourceObject * zipObject)
    return true;
 }
 
+bool ResManager::scanPack (ResourceObject * packObject)
+{
+   if(packObject->mPackArchive == NULL)
+   {
+      packObject->mPackArchive = new PackArchive;
+      if(! packObject->mPackArchive->openArchive(buildPath(packObject->zipPath, packObject->zipName)))
+      {
+         SAFE_DELETE(packObject->mPackArchive);
+         return false;
+      }
+   }
+
+   PackArchive *pack = packObject->mPackArchive;
+
+   // Entries are rooted at the pack filename without its extension.
+   char packRoot[1024];
+   dStrncpy(packRoot, pack->getFilename(), sizeof(packRoot));
+   packRoot[sizeof(packRoot)-1] = 0;
+
+   char* dot = dStrrchr(packRoot, '.');
+   if(dot && dStrchr(dot, '/') == NULL)
+      *dot = '\0';
+
+   for(U32 i = 0;i < pack->getEntryCount();++i)
+   {
+      const PackArchive::Entry &entry = pack->getEntry(i);
+
+      char buf[1024];
+      if(packRoot[0])
+         dSprintf(buf, sizeof(buf), "%s/%s", packRoot, pack->getEntryName(entry));
+      else
+      {
+         dStrncpy(buf, pack->getEntryName(entry), sizeof(buf));
+         buf[sizeof(buf)-1] = 0;
+      }
+
+      // Create file base name
+      char* pPathEnd = dStrrchr(buf, '/');
+      if(pPathEnd == NULL)
+         continue;
+
+      pPathEnd[0] = '\0';
+      const char * path = StringTable->insert(buf);
+      const char * file = StringTable->insert(pPathEnd + 1);
+
+      ResourceObject *ro = createZipResource(path, file, packObject->zipPath, packObject->zipName);
+
+      ro->flags = ResourceObject::VolumeBlock;
+      ro->fileSize = entry.mSize;
+      ro->compressedFileSize = entry.mStoredSize;
+      ro->fileOffset = entry.mOffset;
+      ro->mPackArchive = pack;
+      ro->mPackEntry = &entry;
+
+      dictionary.pushBehind (ro, ResourceObject::File);
+   }
+
+   return true;
+}
+
 //------------------------------------------------------------------------------
 
 void ResManager::searchPath (const char *path, bool noDups /* = false */, bool ignoreZips /* = false */ )
@@ -456,6 +538,12 @@ void ResManager::searchPath (const char *path, bool noDups /* = false */, bool i
          ro->zipPath = rInfo.pFullPath;
          scanZip(ro);
       }
+      else if (extension && !dStricmp (extension, ".pak") && !ignoreZips )
+      {
+         ro->zipName = rInfo.pFileName;
+         ro->zipPath = rInfo.pFullPath;
+         scanPack(ro);
+      }
    }
 
    // Clear Exclusion list
@@ -933,6 +1021,14 @@ Stream * ResManager::openStream (ResourceObject * obj)
 
    if (obj->flags & ResourceObject::VolumeBlock)
    {
+      // Packs serve stored entries straight from their mapped view.
+      if (obj->mPackArchive)
+      {
+         AssertFatal(obj->mPackEntry, "mPackEntry is NULL");
+
+         return obj->mPackArchive->openEntryForRead(obj->mPackEntry);
+      }
+
       AssertFatal(obj->mZipArchive, "mZipArchive is NULL");
       AssertFatal(obj->mCentralDir, "mCentralDir is NULL");
 
@@ -1254,6 +1350,8 @@ ResourceObject * ResManager::createZipResource (StringTableEntry path, StringTab
    newRO->crc = InvalidCRC;
    newRO->mZipArchive = NULL;
    newRO->mCentralDir = NULL;
+   newRO->mPackArchive = NULL;
+   newRO->mPackEntry = NULL;
 
    return newRO;
 }
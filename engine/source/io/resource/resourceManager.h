@@ -40,6 +40,10 @@
 #include "algorithm/crc.h"
 #endif
 
+#ifndef _PACK_ARCHIVE_H_
+#include "io/resource/packArchive.h"
+#endif
+
 class Stream;
 class FileStream;
 class ZipSubRStream;
@@ -172,6 +176,9 @@ public:
    Zip::ZipArchive *mZipArchive; ///< The zip archive for reading from zips
    const Zip::CentralDir *mCentralDir; ///< The central directory for this file in the zip
 
+   PackArchive *mPackArchive;    ///< The pack archive for reading from packs
+   const PackArchive::Entry *mPackEntry; ///< The index entry for this file in the pack
+
    ResourceObject();
    ~ResourceObject() { unlink(); }
 
@@ -328,7 +335,7 @@ public:
 /// Basic resource manager behavior:
 ///  - Set the mod path.
 ///      - ResManager scans directory tree under listed base directories
-///      - Any volume (.zip) file in the root directory of a mod is scanned
+///      - Any volume (.zip or .pak) file in the root directory of a mod is scanned
 ///        for resources.
 ///      - Any files currently in the resource manager become memory resources.
 ///      - They can be "reattached" to the first file that matches the file name.
@@ -366,6 +373,9 @@ private:
    /// Scan a zip file for resources.
    bool scanZip(ResourceObject *zipObject);
 
+   /// Scan a pack file for resources.
+   bool scanPack(ResourceObject *packObject);
+
    /// Create a ResourceObject from the given file.
    ResourceObject* createResource(StringTableEntry path, StringTableEntry file);
 
@@ -464,6 +474,7 @@ public:
    bool findFile( const char *name );                 ///< Checks to see if a file exists.
 
    bool addVFSRoot(Zip::ZipArchive *vfs);
+   bool addVFSRoot(PackArchive *vfs);
    bool isUsingVFS() { return usingVFS; }
 
    /// Computes the CRC of a file.
@@ -110,4 +110,23 @@ ConsoleFunctionWithDocs(isUsingVFS, ConsoleBool, 1, 1, ())
    return ResourceManager->isUsingVFS();
 }
 
+/*! Builds a pack (.pak) file from all the files found recursively in a path such as a module.
+    Packs found in resource paths are scanned like zips and their files are served from a mapped view of the pack.
+    @param packFile The pack file to write.
+    @param sourcePath The path whose files will be packed.  Files are named in the pack relative to this path.
+    @param compress Whether to deflate files that get meaningfully smaller.  Optional: Defaults to true.
+    @return Whether the pack was built or not.
+*/
+ConsoleFunctionWithDocs(buildPackArchive, ConsoleBool, 3, 4, (packFile, sourcePath, [compress=true]?))
+{
+   char packFile[1024];
+   char sourcePath[1024];
+   Con::expandPath(packFile, sizeof(packFile), argv[1]);
+   Con::expandPath(sourcePath, sizeof(sourcePath), argv[2]);
+
+   const bool compress = argc > 3 ? dAtob(argv[3]) : true;
+
+   return PackArchive::buildArchive(packFile, sourcePath, compress);
+}
+
 /*! @} */ // group ResourceManagerFunctions
@@ -53,6 +53,20 @@ void RandomGeneratorBase::resetSeed( void )
 
 //-----------------------------------------------------------------------------
 
+U32 RandomGeneratorBase::getSeedGeneratorState( void )
+{
+    return msSeed;
+}
+
+//-----------------------------------------------------------------------------
+
+void RandomGeneratorBase::setSeedGeneratorState( const U32 state )
+{
+    msSeed = state;
+}
+
+//-----------------------------------------------------------------------------
+
 RandomLCG::RandomLCG()
 {
     setSeed(generateSeed());
@@ -39,6 +39,10 @@ public:
     void resetSeed( void );
     inline S32 getSeed( void ) const { return mSeed; }
 
+    /// The state used to generate the seeds of generators that are not explicitly seeded.
+    static U32 getSeedGeneratorState( void );
+    static void setSeedGeneratorState( const U32 state );
+
     inline F32 randRangeF( const F32 from, const F32 to ) { AssertFatal( from <= to, "RandomGeneratorBase::randF() - Inverted range." ); return (from + (to - from) * randF()); }
     inline S32 randRangeI( const S32 from, const S32 to ) { AssertFatal( from <= to, "RandomGeneratorBase::randI() - Inverted range." ); return (S32)(from + (randI() % (to - from + 1)) ); }
 
@@ -73,6 +73,17 @@ public:
             pResetStateObject->resetState();
     }
 
+    inline U32 getCacheCount( void ) const { return (U32)this->size(); }
+
+    void reserveCache( FactoryCache<T>& sourceCache, const U32 count )
+    {
+        // Take objects from the source cache until this cache holds the count.
+        while( (U32)this->size() < count )
+        {
+            this->push_back( sourceCache.createObject() );
+        }
+    }
+
     void purgeCache( void )
     {
         while( this->size() > 0 )
@@ -83,6 +83,7 @@ NetConnection *NetInterface::findPendingConnection(const NetAddress *address, U3
 
 void NetInterface::processPacketReceiveEvent(PacketReceiveEvent *prEvent)
 {
+   MemoryTagScope memoryTagScope(MemoryTag_Network);
 
    U32 dataSize = prEvent->size - PacketReceiveEventHeaderSize;
    BitStream pStream(prEvent->data, dataSize);
@@ -413,6 +414,8 @@ void NetInterface::handleInfoPacket(const NetAddress *address, U8 packetType, Bi
 
 void NetInterface::processClient()
 {
+   MemoryTagScope memoryTagScope(MemoryTag_Network);
+
    NetObject::collapseDirtyList(); // collapse all the mask bits...
    for(NetConnection *walk = NetConnection::getConnectionList();
       walk; walk = walk->getNext())
@@ -424,6 +427,8 @@ void NetInterface::processClient()
 
 void NetInterface::processServer()
 {
+   MemoryTagScope memoryTagScope(MemoryTag_Network);
+
    NetObject::collapseDirtyList(); // collapse all the mask bits...
    for(NetConnection *walk = NetConnection::getConnectionList();
       walk; walk = walk->getNext())
@@ -37,7 +37,7 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
     PROFILE_SCOPE(TamlBinaryWriter_Write);
  
     // Write Taml signature.
-    stream.writeString( StringTable->insert( TAML_SIGNATURE ) );
+    stream.writeString( TAML_SIGNATURE );
 
     // Write version Id.
     stream.write( mVersionId );
@@ -74,11 +74,8 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryWriter_WriteElement);
 
-    // Fetch object.
-    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
-
     // Fetch element name.
-    const char* pElementName = pSimObject->getClassName();
+    const char* pElementName = pTamlWriteNode->mpClassName;
 
     // Write element name.
     stream.writeString( pElementName );
@@ -87,25 +87,23 @@ void TamlJSONWriter::compileType( rapidjson::Document& document, rapidjson::Valu
     // Fetch the json document allocator.
     rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
 
-    // Fetch object.
-    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
-
     // Fetch JSON strict flag (don't use it if member index is set to not use it).
     const bool jsonStrict = memberIndex == -1 ? false : mpTaml->getJSONStrict();
    
     // Fetch element name (mangled or not).
-    StringTableEntry elementName = jsonStrict ? getManagedName( pSimObject->getClassName(), memberIndex ) : pSimObject->getClassName();
+    char managedNameBuffer[1024];
+    const char* pElementName = jsonStrict ? getManagedName( managedNameBuffer, sizeof(managedNameBuffer), pTamlWriteNode->mpClassName, memberIndex ) : pTamlWriteNode->mpClassName;
     
     // Is there a parent value?
     if ( pParentValue == NULL )
     {        
         // No, so add as document root value member.
-        pTypeValue = &((document.AddMember( elementName, *pTypeValue, allocator ).MemberEnd()-1)->value);
+        pTypeValue = &((document.AddMember( pElementName, allocator, *pTypeValue, allocator ).MemberEnd()-1)->value);
     }
     else
     {
         // Yes, so add as a parent value member.
-        pTypeValue = &((pParentValue->AddMember( elementName, *pTypeValue, allocator ).MemberEnd()-1)->value);
+        pTypeValue = &((pParentValue->AddMember( pElementName, allocator, *pTypeValue, allocator ).MemberEnd()-1)->value);
     }
 
     // Fetch reference Id.
@@ -223,11 +221,8 @@ void TamlJSONWriter::compileCustom( rapidjson::Document& document, rapidjson::Va
     // Fetch the json document allocator.
     rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
 
-    // Fetch object.
-    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
-
     // Fetch element name.
-    const char* pElementName = pSimObject->getClassName();
+    const char* pElementName = pTamlWriteNode->mpClassName;
 
     // Iterate custom nodes.
     for( TamlCustomNodeVector::const_iterator customNodesItr = nodes.begin(); customNodesItr != nodes.end(); ++customNodesItr )
@@ -238,10 +233,9 @@ void TamlJSONWriter::compileCustom( rapidjson::Document& document, rapidjson::Va
         // Format extended element name.
         char extendedElementNameBuffer[256];
         dSprintf( extendedElementNameBuffer, sizeof(extendedElementNameBuffer), "%s.%s", pElementName, pCustomNode->getNodeName() );
-        StringTableEntry elementNameEntry = StringTable->insert( extendedElementNameBuffer );
 
         rapidjson::Value elementValue(rapidjson::kObjectType);
-        rapidjson::Value* pElementValue = &((pTypeValue->AddMember( elementNameEntry, elementValue, allocator ).MemberEnd()-1)->value);
+        rapidjson::Value* pElementValue = &((pTypeValue->AddMember( extendedElementNameBuffer, allocator, elementValue, allocator ).MemberEnd()-1)->value);
 
         // Fetch node children.
         const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
@@ -297,7 +291,8 @@ void TamlJSONWriter::compileCustomNode( rapidjson::Document& document, rapidjson
     const bool jsonStrict = memberIndex == -1 ? false : mpTaml->getJSONStrict();
    
     // Fetch element name (mangled or not).
-    StringTableEntry nodeName = jsonStrict ? getManagedName( pCustomNode->getNodeName(), memberIndex ) : pCustomNode->getNodeName();
+    char managedNameBuffer[1024];
+    const char* pNodeName = jsonStrict ? getManagedName( managedNameBuffer, sizeof(managedNameBuffer), pCustomNode->getNodeName(), memberIndex ) : pCustomNode->getNodeName();
 
     // Is there any node text?
     if ( !pCustomNode->getNodeTextField().isValueEmpty() )
@@ -308,13 +303,13 @@ void TamlJSONWriter::compileCustomNode( rapidjson::Document& document, rapidjson
         // Create custom value.
         rapidjson::Value customTextValue(rapidjson::kArrayType);
         customTextValue.PushBack( pNodeText, allocator );
-        pParentValue->AddMember( nodeName, customTextValue, allocator );
+        pParentValue->AddMember( pNodeName, allocator, customTextValue, allocator );
         return;
     }
 
     // Create custom value.
     rapidjson::Value customValue(rapidjson::kObjectType);
-    rapidjson::Value* pCustomValue = &((pParentValue->AddMember( nodeName, customValue, allocator ).MemberEnd()-1)->value);
+    rapidjson::Value* pCustomValue = &((pParentValue->AddMember( pNodeName, allocator, customValue, allocator ).MemberEnd()-1)->value);
 
     // Iterate fields.
     for ( TamlCustomFieldVector::const_iterator fieldItr = fields.begin(); fieldItr != fields.end(); ++fieldItr )
@@ -353,15 +348,14 @@ void TamlJSONWriter::compileCustomNode( rapidjson::Document& document, rapidjson
 
 //-----------------------------------------------------------------------------
 
-inline StringTableEntry TamlJSONWriter::getManagedName( const char* pName, const S32 memberIndex )
+inline const char* TamlJSONWriter::getManagedName( char* pNameBuffer, const U32 nameBufferSize, const char* pName, const S32 memberIndex )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlJSONWriter_getManagedName);
 
-    char nameBuffer[1024];
-
     // Format mangled name.
-    dSprintf( nameBuffer, sizeof(nameBuffer), JSON_RFC4627_NAME_MANGLING_FORMAT, pName, memberIndex );
+    // NOTE:- The document copies member names so the string table is not needed.
+    dSprintf( pNameBuffer, nameBufferSize, JSON_RFC4627_NAME_MANGLING_FORMAT, pName, memberIndex );
 
-    return StringTable->insert( nameBuffer );
+    return pNameBuffer;
 }
\ No newline at end of file
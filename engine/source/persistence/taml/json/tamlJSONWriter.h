@@ -60,7 +60,7 @@ private:
     void compileCustom( rapidjson::Document& document, rapidjson::Value* pTypeValue, const TamlWriteNode* pTamlWriteNode );
     void compileCustomNode( rapidjson::Document& document, rapidjson::Value* pParentValue, const TamlCustomNode* pCustomNode, const S32 memberIndex );
 
-    inline StringTableEntry getManagedName(const char* pName, const S32 memberIndex );
+    inline const char* getManagedName( char* pNameBuffer, const U32 nameBufferSize, const char* pName, const S32 memberIndex );
 };
 
 #endif // _TAML_JSONWRITER_H_
\ No newline at end of file
@@ -54,6 +54,10 @@
 #include "persistence/taml/json/tamlJSONParser.h"
 #endif
 
+#ifndef _SMALLVECTOR_H_
+#include "collection/smallVector.h"
+#endif
+
 #ifndef _FRAMEALLOCATOR_H_
 #include "memory/frameAllocator.h"
 #endif
@@ -90,6 +94,14 @@
 #include "audio/AudioAsset.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
 // Script bindings.
 #include "taml_ScriptBinding.h"
 
@@ -163,10 +175,27 @@ Taml::Taml() :
     mAutoFormat(true),
     mAutoFormatXmlExtension("taml"),    
     mAutoFormatBinaryExtension("baml"),
-    mAutoFormatJSONExtension("json")
+    mAutoFormatJSONExtension("json"),
+    mSchemaLocation(StringTable->EmptyString),
+    mIncrementalState(IncrementalIdle),
+    mpIncrementalRootNode(NULL),
+    mIncrementalFormatMode(XmlFormat),
+    mpIncrementalThread(NULL),
+    mIncrementalThreadDone(0),
+    mIncrementalStatus(false),
+    mIncrementalSliceSize(128)
 {
-    // Reset the file-path buffer.
+    // Reset the file-path buffers.
     mFilePathBuffer[0] = 0;
+    mIncrementalFilePathBuffer[0] = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+Taml::~Taml()
+{
+    // Finish any incremental write.
+    finishIncrementalWrite( false );
 }
 
 //-----------------------------------------------------------------------------
@@ -185,6 +214,7 @@ void Taml::initPersistFields()
     addField("AutoFormatXmlExtension", TypeString, Offset(mAutoFormatXmlExtension, Taml), "When using auto-format, this is the extension (end of filename) used to detect the XML format.\n");
     addField("AutoFormatBinaryExtension", TypeString, Offset(mAutoFormatBinaryExtension, Taml), "When using auto-format, this is the extension (end of filename) used to detect the BINARY format.\n");
     addField("AutoFormatJSONExtension", TypeString, Offset(mAutoFormatJSONExtension, Taml), "When using auto-format, this is the extension (end of filename) used to detect the JSON format.\n");
+    addField("IncrementalSliceSize", TypeS32, Offset(mIncrementalSliceSize, Taml), "The number of objects compiled in each frame slice when writing incrementally.\n");
 }
 
 //-----------------------------------------------------------------------------
@@ -208,6 +238,9 @@ bool Taml::onAdd()
 
 void Taml::onRemove()
 {
+    // Finish any incremental write.
+    finishIncrementalWrite( false );
+
     // Reset the compilation.
     resetCompilation();
 
@@ -226,6 +259,9 @@ bool Taml::write( SimObject* pSimObject, const char* pFilename )
     AssertFatal( pSimObject != NULL, "Cannot write a NULL object." );
     AssertFatal( pFilename != NULL, "Cannot write to a NULL filename." );
 
+    // Finish any incremental write as it uses the compilation.
+    finishIncrementalWrite();
+
     // Expand the file-name into the file-path buffer.
     Con::expandPath( mFilePathBuffer, sizeof(mFilePathBuffer), pFilename );
 
@@ -283,8 +319,13 @@ SimObject* Taml::read( const char* pFilename )
     // Get the file auto-format mode.
     const TamlFormatMode formatMode = getFileAutoFormatMode( mFilePathBuffer );
 
+    // Fetch whether an incremental write is using the compilation.
+    // NOTE:- Reading does not use the compilation so it is left alone rather than finishing the write.
+    const bool resetCompiled = !isWritingIncremental();
+
     // Reset the compilation.
-    resetCompilation();
+    if ( resetCompiled )
+        resetCompilation();
 
     // Write object.
     SimObject* pSimObject = read( stream, formatMode );
@@ -293,7 +334,8 @@ SimObject* Taml::read( const char* pFilename )
     stream.close();
 
     // Reset the compilation.
-    resetCompilation();
+    if ( resetCompiled )
+        resetCompilation();
 
     // Did we generate an object?
     if ( pSimObject == NULL )
@@ -307,14 +349,389 @@ SimObject* Taml::read( const char* pFilename )
 
 //-----------------------------------------------------------------------------
 
+bool Taml::writeIncremental( SimObject* pSimObject, const char* pFilename )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_WriteIncremental);
+
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Cannot write a NULL object." );
+    AssertFatal( pFilename != NULL, "Cannot write to a NULL filename." );
+
+    // Finish any incremental write already in progress.
+    finishIncrementalWrite();
+
+    // Expand the file-name into the incremental file-path buffer.
+    // NOTE:- The file is only opened once the objects are compiled so it is left intact until then.
+    Con::expandPath( mIncrementalFilePathBuffer, sizeof(mIncrementalFilePathBuffer), pFilename );
+
+    // Get the file auto-format mode.
+    mIncrementalFormatMode = getFileAutoFormatMode( mIncrementalFilePathBuffer );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    // Start compiling the root object.
+    mIncrementalState = IncrementalCompiling;
+    mIncrementalStatus = false;
+    mpIncrementalRootNode = compileIncrementalObject( pSimObject );
+    pushIncrementalFrame( mpIncrementalRootNode );
+
+    // Compile the remaining objects in the spare frame time.
+    FrameScheduler::addIdleTask( this );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::finishIncrementalWrite( const bool performCallback )
+{
+    // Finish if not writing incrementally.
+    if ( mIncrementalState == IncrementalIdle )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_FinishIncrementalWrite);
+
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
+    // Compile all the remaining objects.
+    while ( mIncrementalState == IncrementalCompiling )
+        compileIncrementalSlice( mIncrementalSliceSize );
+
+    // Complete the write.
+    completeIncrementalWrite( performCallback );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Taml::processIdleTask( void )
+{
+    // Finish if not writing incrementally.
+    if ( mIncrementalState == IncrementalIdle )
+        return false;
+
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
+    // Are we compiling?
+    if ( mIncrementalState == IncrementalCompiling )
+    {
+        // Yes, so compile a slice of objects.
+        compileIncrementalSlice( mIncrementalSliceSize );
+        return true;
+    }
+
+    // Finish if the objects are still being serialized.
+    if ( dAtomicLoadAcquire( mIncrementalThreadDone ) == 0 )
+        return false;
+
+    // Complete the write.
+    completeIncrementalWrite( true );
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlWriteNode* Taml::compileIncrementalObject( SimObject* pSimObject )
+{
+    // Start compiling the object.
+    TamlWriteNode* pNewNode = compileObjectStart( pSimObject, false );
+
+    // Finish if this is a reference to a previously compiled object.
+    if ( pNewNode->mRefToNode != NULL )
+        return pNewNode;
+
+    // Are there any Taml callbacks?
+    // NOTE:- The custom state is written and the callbacks finished now so that each object is captured within a single slice.
+    // Any proxy objects are compiled after the children, as they are when compiling recursively, so the references stay in order.
+    if ( pNewNode->mpTamlCallbacks != NULL )
+    {
+        // Yes, so call them.
+        tamlCustomWrite( pNewNode->mpTamlCallbacks, pNewNode->mCustomNodes );
+        tamlPostWrite( pNewNode->mpTamlCallbacks );
+    }
+
+    return pNewNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::pushIncrementalFrame( TamlWriteNode* pTamlWriteNode )
+{
+    // Finish if this is a reference to a previously compiled object.
+    if ( pTamlWriteNode->mRefToNode != NULL )
+        return;
+
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pTamlWriteNode->mpSimObject );
+
+    // Finish the object immediately if it does not contain Taml children.
+    if ( pChildren == NULL || pChildren->getTamlChildCount() == 0 )
+    {
+        compileCustomNodes( pTamlWriteNode );
+        return;
+    }
+
+    // Fetch the child count.
+    const U32 childCount = pChildren->getTamlChildCount();
+
+    // Create children vector.
+    pTamlWriteNode->mChildren = new typeNodeVector();
+    pTamlWriteNode->mChildren->reserve( childCount );
+
+    // Note the object, its children and any proxy objects now as they are compiled over several slices.
+    // NOTE:- These are held by Id so that any deleted since can be detected.
+    IncrementalFrame frame;
+    frame.mpNode = pTamlWriteNode;
+    frame.mObjectStart = (U32)mIncrementalObjects.size();
+    pushIncrementalObject( pTamlWriteNode->mpSimObject );
+
+    for ( U32 childIndex = 0; childIndex < childCount; ++childIndex )
+        pushIncrementalObject( pChildren->getTamlChild( childIndex ) );
+
+    frame.mNextChild = frame.mObjectStart + 1;
+    frame.mChildEnd = (U32)mIncrementalObjects.size();
+    pushIncrementalProxies( pTamlWriteNode->mCustomNodes.getNodes() );
+    frame.mObjectEnd = (U32)mIncrementalObjects.size();
+
+    mIncrementalFrames.push_back( frame );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::pushIncrementalObject( SimObject* pSimObject )
+{
+    IncrementalObject object;
+    object.mObjectId = pSimObject->getId();
+    object.mpObject = pSimObject;
+    mIncrementalObjects.push_back( object );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::pushIncrementalProxies( const TamlCustomNodeVector& customNodes )
+{
+    // Iterate custom nodes.
+    for( TamlCustomNodeVector::const_iterator customNodeItr = customNodes.begin(); customNodeItr != customNodes.end(); ++customNodeItr )
+    {
+        // Fetch the custom node.
+        const TamlCustomNode* pCustomNode = *customNodeItr;
+
+        // Note any proxy object.
+        SimObject* pProxyObject = pCustomNode->getProxyObject<SimObject>(false);
+        if ( pProxyObject != NULL )
+            pushIncrementalObject( pProxyObject );
+
+        // Note any proxy objects in the children.
+        pushIncrementalProxies( pCustomNode->getChildren() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool Taml::isIncrementalObjectValid( const U32 objectIndex ) const
+{
+    // Fetch the object.
+    const IncrementalObject& object = mIncrementalObjects[objectIndex];
+
+    // The object is valid if its Id still refers to it.
+    return Sim::findObject( object.mObjectId ) == object.mpObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::compileIncrementalSlice( const U32 objectCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_CompileIncrementalSlice);
+
+    U32 compiledCount = 0;
+
+    while ( mIncrementalFrames.size() > 0 && compiledCount < getMax( objectCount, (U32)1 ) )
+    {
+        // Fetch the current frame.
+        IncrementalFrame& frame = mIncrementalFrames.last();
+
+        // Abort if the object has been deleted since it was compiled.
+        if ( !isIncrementalObjectValid( frame.mObjectStart ) )
+        {
+            abortIncrementalWrite();
+            return;
+        }
+
+        // Have all the children been compiled?
+        if ( frame.mNextChild == frame.mChildEnd )
+        {
+            // Yes, so abort if any proxy object has been deleted since the object was compiled.
+            for ( U32 objectIndex = frame.mChildEnd; objectIndex < frame.mObjectEnd; ++objectIndex )
+            {
+                if ( !isIncrementalObjectValid( objectIndex ) )
+                {
+                    abortIncrementalWrite();
+                    return;
+                }
+            }
+
+            // Finish the object.
+            compileCustomNodes( frame.mpNode );
+
+            // Remove the frame.
+            mIncrementalObjects.setSize( frame.mObjectStart );
+            mIncrementalFrames.pop_back();
+            continue;
+        }
+
+        // Fetch the parent node and next child.
+        TamlWriteNode* pParentNode = frame.mpNode;
+        const U32 childIndex = frame.mNextChild++;
+
+        // Skip the child if it has been deleted since.
+        if ( !isIncrementalObjectValid( childIndex ) )
+            continue;
+
+        // Compile the child.
+        TamlWriteNode* pChildTamlWriteNode = compileIncrementalObject( mIncrementalObjects[childIndex].mpObject );
+        pParentNode->mChildren->push_back( pChildTamlWriteNode );
+        compiledCount++;
+
+        // Compile the children of the child next.
+        // NOTE:- This invalidates the frame.
+        pushIncrementalFrame( pChildTamlWriteNode );
+    }
+
+    // Start serializing once all the objects are compiled.
+    if ( mIncrementalFrames.size() == 0 )
+        startIncrementalSerialize();
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::abortIncrementalWrite( void )
+{
+    // Warn.
+    Con::warnf("Taml::writeIncremental() - An object was deleted while being written so the write to '%s' was aborted.", mIncrementalFilePathBuffer );
+
+    // Stop compiling and flag the write as failed.
+    // NOTE:- The file has not been opened yet so it is left intact.
+    mIncrementalFrames.clear();
+    mIncrementalObjects.clear();
+    mIncrementalStatus = false;
+    mIncrementalState = IncrementalSerializing;
+    mIncrementalThreadDone = 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::startIncrementalSerialize( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_StartIncrementalSerialize);
+
+    mIncrementalState = IncrementalSerializing;
+    mIncrementalThreadDone = 0;
+
+    // File opened?
+    if ( !mIncrementalStream.open( mIncrementalFilePathBuffer, FileStream::Write ) )
+    {
+        // No, so warn.
+        Con::warnf("Taml::writeIncremental() - Could not open filename '%s' for write.", mIncrementalFilePathBuffer );
+        mIncrementalThreadDone = 1;
+        return;
+    }
+
+    // Resolve the schema location here as it uses the console.
+    resolveSchemaLocation( mIncrementalFilePathBuffer, mIncrementalFormatMode );
+
+#ifndef TORQUE_OS_EMSCRIPTEN
+    // The writers only use the compiled nodes so serialize those in the background.
+    mpIncrementalThread = new Thread( incrementalWriteThread, this, true );
+#else
+    // Serialize the nodes now.
+    mIncrementalStatus = writeNodes( mIncrementalStream, mpIncrementalRootNode, mIncrementalFormatMode );
+    mIncrementalThreadDone = 1;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::incrementalWriteThread( void* pArg )
+{
+    Taml* pTaml = static_cast<Taml*>( pArg );
+
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
+    // Serialize the nodes.
+    pTaml->mIncrementalStatus = pTaml->writeNodes( pTaml->mIncrementalStream, pTaml->mpIncrementalRootNode, pTaml->mIncrementalFormatMode );
+
+    // Flag as done.
+    dAtomicStoreRelease( pTaml->mIncrementalThreadDone, 1 );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::completeIncrementalWrite( const bool performCallback )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_CompleteIncrementalWrite);
+
+    // Wait for any serialization thread.
+    if ( mpIncrementalThread != NULL )
+    {
+        mpIncrementalThread->join();
+        delete mpIncrementalThread;
+        mpIncrementalThread = NULL;
+    }
+
+    // Close file.
+    mIncrementalStream.close();
+
+    // Reset the compilation.
+    resetCompilation();
+    mIncrementalFrames.clear();
+    mIncrementalObjects.clear();
+    mpIncrementalRootNode = NULL;
+    mIncrementalState = IncrementalIdle;
+
+    // Stop processing.
+    FrameScheduler::removeIdleTask( this );
+
+    // Perform callback.
+    if ( performCallback && isProperlyAdded() )
+        Con::executef( this, 2, "onWriteComplete", Con::getBoolArg( mIncrementalStatus ) );
+}
+
+//-----------------------------------------------------------------------------
+
 bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode )
 {
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
     // Sanity!
     AssertFatal( pSimObject != NULL, "Cannot write a NULL object." );
 
     // Compile nodes.
     TamlWriteNode* pRootNode = compileObject( pSimObject );
 
+    // Resolve the schema location.
+    resolveSchemaLocation( mFilePathBuffer, formatMode );
+
+    // Write nodes.
+    return writeNodes( stream, pRootNode, formatMode );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Taml::writeNodes( FileStream& stream, TamlWriteNode* pRootNode, const TamlFormatMode formatMode )
+{
     // Format appropriately.
     switch( formatMode )
     {
@@ -366,6 +783,9 @@ bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMod
 
 SimObject* Taml::read( FileStream& stream, const TamlFormatMode formatMode )
 {
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
     // Format appropriately.
     switch( formatMode )
     {
@@ -420,6 +840,9 @@ bool Taml::parse( const char* pFilename, TamlVisitor& visitor )
     // Debug Profiling.
     PROFILE_SCOPE(Taml_Parse);
 
+    // Memory Tagging.
+    MemoryTagScope memoryTagScope( MemoryTag_Taml );
+
     // Sanity!
     AssertFatal( pFilename != NULL, "Taml::parse() - Cannot parse a NULL filename." );
 
@@ -539,11 +962,66 @@ Taml::TamlFormatMode Taml::getFileAutoFormatMode( const char* pFilename )
 
 //-----------------------------------------------------------------------------
 
+void Taml::resolveSchemaLocation( const char* pFilePath, const TamlFormatMode formatMode )
+{
+    // Reset the schema location.
+    mSchemaLocation = StringTable->EmptyString;
+
+    // Finish if not writing XML.
+    if ( formatMode != XmlFormat )
+        return;
+
+    // Fetch any TAML Schema file reference.
+    const char* pTamlSchemaFile = Con::getVariable( TAML_SCHEMA_VARIABLE );
+
+    // Finish if we don't have a schema file reference.
+    if ( pTamlSchemaFile == NULL || *pTamlSchemaFile == 0 )
+        return;
+
+    // Expand the file-path reference.
+    char schemaFilePathBuffer[1024];
+    Con::expandPath( schemaFilePathBuffer, sizeof(schemaFilePathBuffer), pTamlSchemaFile );
+
+    // Fetch the output path for the Taml file.
+    char outputFileBuffer[1024];
+    dSprintf( outputFileBuffer, sizeof(outputFileBuffer), "%s", pFilePath );
+    char* pFileStart = dStrrchr( outputFileBuffer, '/' );
+    if ( pFileStart == NULL )
+        *outputFileBuffer = 0;
+    else
+        *pFileStart = 0;
+
+    // Fetch the schema file-path relative to the output file.
+    mSchemaLocation = Platform::makeRelativePathName( schemaFilePathBuffer, outputFileBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
 TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
 {
     // Debug Profiling.
     PROFILE_SCOPE(Taml_CompileObject);
 
+    // Start compiling the object.
+    TamlWriteNode* pNewNode = compileObjectStart( pSimObject, forceId );
+
+    // Finish if this is a reference to a previously compiled object.
+    if ( pNewNode->mRefToNode != NULL )
+        return pNewNode;
+
+    // Compile children.
+    compileChildren( pNewNode );
+
+    // Finish compiling the object.
+    compileObjectFinish( pNewNode );
+
+    return pNewNode;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlWriteNode* Taml::compileObjectStart( SimObject* pSimObject, const bool forceId )
+{
     // Sanity!
     AssertFatal( pSimObject != NULL, "Taml::compileObject() - Cannot compile a NULL object." );
 
@@ -610,20 +1088,25 @@ TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
     compileStaticFields( pNewNode );
     compileDynamicFields( pNewNode );
 
-    // Compile children.
-    compileChildren( pNewNode );
+    return pNewNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::compileObjectFinish( TamlWriteNode* pTamlWriteNode )
+{
+    // Sanity!
+    AssertFatal( pTamlWriteNode != NULL, "Taml::compileObjectFinish() - Cannot finish a NULL node." );
 
     // Compile custom state.
-    compileCustomState( pNewNode );
+    compileCustomState( pTamlWriteNode );
 
     // Are there any Taml callbacks?
-    if ( pNewNode->mpTamlCallbacks != NULL )
+    if ( pTamlWriteNode->mpTamlCallbacks != NULL )
     {
         // Yes, so call it.
-        tamlPostWrite( pNewNode->mpTamlCallbacks );
+        tamlPostWrite( pTamlWriteNode->mpTamlCallbacks );
     }
-
-    return pNewNode;
 }
 
 //-----------------------------------------------------------------------------
@@ -745,31 +1228,31 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
     // Fetch field count.
     const U32 fieldCount = fieldList.size();
 
-    Vector<SimFieldDictionary::Entry*> dynamicFieldList(__FILE__, __LINE__);
+    SmallVector<SimFieldDictionary::Entry*, 32> dynamicFieldList;
 
     // Ensure the dynamic field doesn't conflict with static field.
-    for( U32 hashIndex = 0; hashIndex < SimFieldDictionary::HashTableSize; ++hashIndex )
+    for( SimFieldDictionaryIterator itr(pFieldDictionary); *itr; ++itr )
     {
-        for( SimFieldDictionary::Entry* pEntry = pFieldDictionary->mHashTable[hashIndex]; pEntry; pEntry = pEntry->next )
+        // Fetch entry.
+        SimFieldDictionary::Entry* pEntry = *itr;
+
+        // Iterate static fields.
+        U32 fieldIndex;
+        for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
         {
-            // Iterate static fields.
-            U32 fieldIndex;
-            for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
-            {
-                if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
-                    break;
-            }
+            if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
+                break;
+        }
 
-            // Skip if found.
-            if( fieldIndex != (U32)fieldList.size() )
-                continue;
+        // Skip if found.
+        if( fieldIndex != (U32)fieldList.size() )
+            continue;
 
-            // Skip if not writing field.
-            if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
-                continue;
+        // Skip if not writing field.
+        if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
+            continue;
 
-            dynamicFieldList.push_back( pEntry );
-        }
+        dynamicFieldList.push_back( pEntry );
     }
 
     // Sort Entries to prevent version control conflicts
@@ -777,7 +1260,7 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
         dQsort(dynamicFieldList.address(), dynamicFieldList.size(), sizeof(SimFieldDictionary::Entry*), compareFieldEntries);
 
     // Save the fields.
-    for( Vector<SimFieldDictionary::Entry*>::iterator entryItr = dynamicFieldList.begin(); entryItr != dynamicFieldList.end(); ++entryItr )
+    for( SmallVector<SimFieldDictionary::Entry*, 32>::iterator entryItr = dynamicFieldList.begin(); entryItr != dynamicFieldList.end(); ++entryItr )
     {
         // Fetch entry.
         SimFieldDictionary::Entry* pEntry = *entryItr;
@@ -847,8 +1330,19 @@ void Taml::compileCustomState( TamlWriteNode* pTamlWriteNode )
         tamlCustomWrite( pTamlWriteNode->mpTamlCallbacks, customNodes );
     }
 
+    // Compile the custom nodes.
+    compileCustomNodes( pTamlWriteNode );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::compileCustomNodes( TamlWriteNode* pTamlWriteNode )
+{
+    // Sanity!
+    AssertFatal( pTamlWriteNode != NULL, "Cannot compile custom nodes on a NULL node." );
+
     // Fetch custom nodes.
-    const TamlCustomNodeVector& nodes = customNodes.getNodes();
+    const TamlCustomNodeVector& nodes = pTamlWriteNode->mCustomNodes.getNodes();
 
     // Finish if no custom nodes to process.
     if ( nodes.size() == 0 )
@@ -55,6 +55,14 @@
 #include "io/fileStream.h"
 #endif
 
+#ifndef _FRAME_SCHEDULER_H_
+#include "game/frameScheduler.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Thread;
+
 //-----------------------------------------------------------------------------
 
 extern StringTableEntry tamlRefIdName;
@@ -71,7 +79,7 @@ extern StringTableEntry tamlNamedObjectName;
 
 /// @ingroup tamlGroup
 /// @see tamlGroup
-class Taml : public SimObject
+class Taml : public SimObject, public FrameIdleTask
 {
 public:
     enum TamlFormatMode
@@ -87,6 +95,28 @@ private:
     typedef Vector<TamlWriteNode*>                  typeNodeVector;
     typedef HashMap<SimObjectId, TamlWriteNode*>    typeCompiledHash;
 
+    enum IncrementalState
+    {
+        IncrementalIdle,
+        IncrementalCompiling,
+        IncrementalSerializing,
+    };
+
+    struct IncrementalObject
+    {
+        SimObjectId     mObjectId;
+        SimObject*      mpObject;
+    };
+
+    struct IncrementalFrame
+    {
+        TamlWriteNode*  mpNode;
+        U32             mObjectStart;
+        U32             mChildEnd;
+        U32             mNextChild;
+        U32             mObjectEnd;
+    };
+
     typeNodeVector      mCompiledNodes;
     typeCompiledHash    mCompiledObjects;
     U32                 mMasterNodeId;
@@ -100,18 +130,37 @@ private:
     bool                mWriteDefaults;
     bool                mProgenitorUpdate;
     char                mFilePathBuffer[1024];
+    StringTableEntry    mSchemaLocation;
+
+    /// Incremental write.
+    IncrementalState            mIncrementalState;
+    Vector<IncrementalFrame>    mIncrementalFrames;
+    Vector<IncrementalObject>   mIncrementalObjects;
+    TamlWriteNode*              mpIncrementalRootNode;
+    TamlFormatMode              mIncrementalFormatMode;
+    FileStream                  mIncrementalStream;
+    Thread*                     mpIncrementalThread;
+    volatile U32                mIncrementalThreadDone;
+    bool                        mIncrementalStatus;
+    U32                         mIncrementalSliceSize;
+    char                        mIncrementalFilePathBuffer[1024];
 
 private:
     void resetCompilation( void );
 
     TamlWriteNode* compileObject( SimObject* pSimObject, const bool forceId = false );
+    TamlWriteNode* compileObjectStart( SimObject* pSimObject, const bool forceId );
+    void compileObjectFinish( TamlWriteNode* pTamlWriteNode );
     void compileStaticFields( TamlWriteNode* pTamlWriteNode );
     void compileDynamicFields( TamlWriteNode* pTamlWriteNode );
     void compileChildren( TamlWriteNode* pTamlWriteNode );
     void compileCustomState( TamlWriteNode* pTamlWriteNode );
+    void compileCustomNodes( TamlWriteNode* pTamlWriteNode );
     void compileCustomNodeState( TamlCustomNode* pCustomNode );
+    void resolveSchemaLocation( const char* pFilePath, const TamlFormatMode formatMode );
 
     bool write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode );
+    bool writeNodes( FileStream& stream, TamlWriteNode* pRootNode, const TamlFormatMode formatMode );
     SimObject* read( FileStream& stream, const TamlFormatMode formatMode );
     template<typename T> inline T* read( FileStream& stream, const TamlFormatMode formatMode )
     {
@@ -125,9 +174,20 @@ private:
         return NULL;
     }
 
+    TamlWriteNode* compileIncrementalObject( SimObject* pSimObject );
+    void pushIncrementalFrame( TamlWriteNode* pTamlWriteNode );
+    void pushIncrementalObject( SimObject* pSimObject );
+    void pushIncrementalProxies( const TamlCustomNodeVector& customNodes );
+    bool isIncrementalObjectValid( const U32 objectIndex ) const;
+    void compileIncrementalSlice( const U32 objectCount );
+    void abortIncrementalWrite( void );
+    void startIncrementalSerialize( void );
+    void completeIncrementalWrite( const bool performCallback );
+    static void incrementalWriteThread( void* pArg );
+
 public:
     Taml();
-    virtual ~Taml() {}
+    virtual ~Taml();
 
     virtual bool onAdd();
     virtual void onRemove();
@@ -166,10 +226,20 @@ public:
     TamlFormatMode getFileAutoFormatMode( const char* pFilename );
 
     const char* getFilePathBuffer( void ) const { return mFilePathBuffer; }
+    StringTableEntry getSchemaLocation( void ) const { return mSchemaLocation; }
 
     /// Write.
     bool write( SimObject* pSimObject, const char* pFilename );
 
+    /// Incremental write.
+    bool writeIncremental( SimObject* pSimObject, const char* pFilename );
+    void finishIncrementalWrite( const bool performCallback = true );
+    inline bool isWritingIncremental( void ) const { return mIncrementalState != IncrementalIdle; }
+    inline bool getIncrementalStatus( void ) const { return mIncrementalStatus; }
+    inline void setIncrementalSliceSize( const U32 objectCount ) { mIncrementalSliceSize = getMax( objectCount, (U32)1 ); }
+    inline U32 getIncrementalSliceSize( void ) const { return mIncrementalSliceSize; }
+    virtual bool processIdleTask( void );
+
     /// Read.
     template<typename T> inline T* read( const char* pFilename )
     {
@@ -56,6 +56,7 @@ void TamlWriteNode::resetNode( void )
     mRefToNode = NULL;
     mChildren = NULL;
     mpObjectName = NULL;
+    mpClassName = NULL;
     mpSimObject = NULL;
 
     // Reset callbacks.
@@ -49,6 +49,8 @@ public:
     class FieldValuePair
     {
     public:        
+        DECLARE_MEMORY_TAGGED_NEW( MemoryTag_Taml );
+
         FieldValuePair( StringTableEntry name, const char* pValue )
         {
             // Set the field name.
@@ -65,6 +67,8 @@ public:
     };
 
 public:
+    DECLARE_MEMORY_TAGGED_NEW( MemoryTag_Taml );
+
     TamlWriteNode()
     {
         // NOTE: This MUST be done before the state is reset otherwise we'll be touching uninitialized stuff.
@@ -72,6 +76,7 @@ public:
         mpSimObject = NULL;
         mpTamlCallbacks = NULL;
         mpObjectName = NULL;
+        mpClassName = NULL;
         mChildren = NULL;
 
         resetNode();
@@ -88,6 +93,10 @@ public:
         // Set sim object.
         mpSimObject = pSimObject;
 
+        // Fetch class name.
+        // NOTE: The writers use this so that they don't need the object itself.
+        mpClassName = pSimObject->getClassName();
+
         // Fetch name.
         const char* pObjectName = pSimObject->getName();
 
@@ -110,6 +119,7 @@ public:
     SimObject*                  mpSimObject;
     TamlCallbacks*              mpTamlCallbacks;
     const char*                 mpObjectName;
+    const char*                 mpClassName;
     Vector<TamlWriteNode::FieldValuePair*> mFields;
     Vector<TamlWriteNode*>*     mChildren;
     TamlCustomNodes             mCustomNodes;
@@ -233,6 +233,76 @@ ConsoleMethodWithDocs(Taml, write, ConsoleBool, 4, 4, (object, filename))
 
 //-----------------------------------------------------------------------------
 
+/*! Writes an object to a file using Taml over several frames.
+    The objects are compiled in slices using the spare time in each frame and the "onWriteComplete(status)" callback is performed once the file is written.
+    Each object is captured in the frame it is reached so objects reached in later frames reflect any changes made in the meantime; use "write()" for a single snapshot.
+    The write is aborted with a failed status if an object being written is deleted before its children are written. The file is serialized in the background.
+    @param object The object to write.
+    @param filename The filename to write to.
+    @return Whether the write was started or not.
+*/
+ConsoleMethodWithDocs(Taml, writeIncremental, ConsoleBool, 4, 4, (object, filename))
+{
+    // Fetch filename.
+    const char* pFilename = argv[3];
+
+    // Find object.
+    SimObject* pSimObject = Sim::findObject( argv[2] );
+
+    // Did we find the object?
+    if ( pSimObject == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Taml::writeIncremental() - Could not find object '%s' to write to file '%s'.", argv[2], pFilename );
+        return false;
+    }
+
+    return object->writeIncremental( pSimObject, pFilename );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Completes any incremental write immediately.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Taml, finishIncrementalWrite, ConsoleVoid, 2, 2, ())
+{
+    object->finishIncrementalWrite();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether an incremental write is in progress or not.
+    @return Whether an incremental write is in progress or not.
+*/
+ConsoleMethodWithDocs(Taml, isWritingIncremental, ConsoleBool, 2, 2, ())
+{
+    return object->isWritingIncremental();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the number of objects compiled in each frame slice when writing incrementally.
+    @param objectCount The number of objects compiled in each slice.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Taml, setIncrementalSliceSize, ConsoleVoid, 3, 3, (objectCount))
+{
+    object->setIncrementalSliceSize( (U32)getMax( dAtoi(argv[2]), 1 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of objects compiled in each frame slice when writing incrementally.
+    @return The number of objects compiled in each slice.
+*/
+ConsoleMethodWithDocs(Taml, getIncrementalSliceSize, ConsoleInt, 2, 2, ())
+{
+    return (S32)object->getIncrementalSliceSize();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Read an object from a file using Taml.
     @param filename The filename to read from.
     @return (Object) The object read from the file or an empty string if read failed.
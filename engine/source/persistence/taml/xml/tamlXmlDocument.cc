@@ -0,0 +1,743 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "persistence/taml/xml/tamlXmlDocument.h"
+
+#ifndef TINYXML_INCLUDED
+#include "persistence/tinyXML/tinyxml.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+static inline bool isXmlWhiteSpace( const char c )
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+//-----------------------------------------------------------------------------
+
+static inline bool isXmlNameCharacter( const char c )
+{
+    return  ( c >= 'a' && c <= 'z' ) ||
+            ( c >= 'A' && c <= 'Z' ) ||
+            ( c >= '0' && c <= '9' ) ||
+            c == '_' || c == '-' || c == '.' || c == ':' ||
+            (U8)c >= 0x80;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlDocument::TamlXmlDocument() :
+    mpBuffer( NULL ),
+    mpFallbackDocument( NULL ),
+    mRow( 0 ),
+    mpRowStart( NULL )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlDocument::~TamlXmlDocument()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlDocument::clear( void )
+{
+    mElements.clear();
+    mAttributes.clear();
+
+    // Free any buffer.
+    if ( mpBuffer != NULL )
+    {
+        dFree( mpBuffer );
+        mpBuffer = NULL;
+    }
+
+    // Delete any fallback document.
+    if ( mpFallbackDocument != NULL )
+    {
+        delete mpFallbackDocument;
+        mpFallbackDocument = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlDocument::load( FileStream& stream, const bool inSitu )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlDocument_Load);
+
+    // Clear any existing document.
+    clear();
+
+    // Fetch the stream position.
+    const U32 streamPosition = stream.getPosition();
+
+    // Use tinyXML if in-situ parsing is not wanted.
+    if ( !inSitu )
+        return loadFallback( stream, streamPosition );
+
+    // Fetch the remaining stream size.
+    const U32 streamSize = stream.getStreamSize() - streamPosition;
+
+    // Finish if the stream is empty.
+    if ( streamSize == 0 )
+        return false;
+
+    // Read the stream into the buffer.
+    mpBuffer = (char*)dMalloc( streamSize + 1 );
+    if ( !stream.read( streamSize, mpBuffer ) )
+    {
+        clear();
+        return false;
+    }
+    mpBuffer[streamSize] = 0;
+
+    // Finish if the document was parsed in-situ.
+    if ( parse( mpBuffer ) )
+        return true;
+
+    // The buffer has been modified so fall back to reading the stream again with tinyXML.
+    clear();
+    return loadFallback( stream, streamPosition );
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlDocument::parse( char* pBuffer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlDocument_Parse);
+
+    // Sanity!
+    AssertFatal( pBuffer != NULL, "TamlXmlDocument::parse() - Cannot parse a NULL buffer." );
+
+    mElements.clear();
+    mAttributes.clear();
+
+    // Reserve for the worst case so the vectors never grow during the parse.
+    U32 elementCount = 0;
+    U32 attributeCount = 0;
+    for ( const char* pScan = pBuffer; *pScan != 0; ++pScan )
+    {
+        if ( *pScan == '<' )
+            elementCount++;
+        else if ( *pScan == '=' )
+            attributeCount++;
+    }
+    mElements.reserve( elementCount );
+    mAttributes.reserve( attributeCount );
+
+    // Reset the parse location.
+    mRow = 1;
+    mpRowStart = pBuffer;
+
+    char* pText = pBuffer;
+
+    // Skip any UTF-8 byte-order mark.
+    if ( (U8)pText[0] == 0xEF && (U8)pText[1] == 0xBB && (U8)pText[2] == 0xBF )
+        pText += 3;
+
+    // Parse up to and including the root element.
+    while( true )
+    {
+        pText = skipWhiteSpace( pText );
+
+        if ( *pText != '<' )
+            return false;
+
+        // Skip any declaration or comment.
+        bool processed;
+        pText = parseMisc( pText + 1, processed );
+
+        if ( pText == NULL )
+            return false;
+
+        if ( processed )
+            continue;
+
+        // Parse the root element.
+        S32 rootIndex;
+        pText = parseElement( pText, rootIndex );
+
+        if ( pText == NULL )
+            return false;
+
+        break;
+    }
+
+    // Only white-space, comments or processing instructions may follow the root element.
+    while( true )
+    {
+        pText = skipWhiteSpace( pText );
+
+        if ( *pText == 0 )
+            return true;
+
+        if ( *pText != '<' )
+            return false;
+
+        bool processed;
+        pText = parseMisc( pText + 1, processed );
+
+        if ( pText == NULL || !processed )
+            return false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const char* TamlXmlDocument::findAttribute( const Element& element, const char* pAttributeName ) const
+{
+    // Iterate the element attributes.
+    const U32 attributeEnd = element.mFirstAttribute + element.mAttributeCount;
+    for ( U32 attributeIndex = element.mFirstAttribute; attributeIndex < attributeEnd; ++attributeIndex )
+    {
+        const Attribute& attribute = mAttributes[attributeIndex];
+
+        if ( dStricmp( attribute.mpName, pAttributeName ) == 0 )
+            return attribute.mpValue;
+    }
+
+    // Not found.
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::parseElement( char* pText, S32& elementIndex )
+{
+    // Fetch the element name.
+    char* pName = pText;
+    while ( isXmlNameCharacter( *pText ) )
+        pText++;
+
+    if ( pText == pName )
+        return NULL;
+
+    char* pNameEnd = pText;
+
+    // Add the element.
+    elementIndex = mElements.size();
+    mElements.increment();
+    Element& element = mElements.last();
+    element.mpName = pName;
+    element.mpText = NULL;
+    element.mFirstAttribute = mAttributes.size();
+    element.mAttributeCount = 0;
+    element.mFirstChild = -1;
+    element.mNextSibling = -1;
+    element.mRow = mRow;
+    element.mColumn = (U32)(pName - mpRowStart);
+
+    // Fetch the character following the name before terminating it.
+    pText = skipWhiteSpace( pText );
+    char terminator = *pText;
+    *pNameEnd = 0;
+
+    // Parse the attributes.
+    while ( terminator != '>' && terminator != '/' )
+    {
+        // Fetch the attribute name.
+        char* pAttributeName = pText;
+        while ( isXmlNameCharacter( *pText ) )
+            pText++;
+
+        if ( pText == pAttributeName )
+            return NULL;
+
+        char* pAttributeNameEnd = pText;
+
+        pText = skipWhiteSpace( pText );
+        if ( *pText != '=' )
+            return NULL;
+
+        *pAttributeNameEnd = 0;
+
+        // Fetch the attribute value.
+        pText = skipWhiteSpace( pText + 1 );
+        const char quote = *pText;
+        if ( quote != '"' && quote != '\'' )
+            return NULL;
+
+        char* pAttributeValue = pText + 1;
+        pText = parseAttributeValue( pAttributeValue, quote );
+
+        if ( pText == NULL )
+            return NULL;
+
+        // Add the attribute.
+        Attribute attribute;
+        attribute.mpName = pAttributeName;
+        attribute.mpValue = pAttributeValue;
+        mAttributes.push_back( attribute );
+        mElements[elementIndex].mAttributeCount++;
+
+        pText = skipWhiteSpace( pText );
+        terminator = *pText;
+    }
+
+    // Is the element empty?
+    if ( terminator == '/' )
+    {
+        // Yes, so finish.
+        if ( pText[1] != '>' )
+            return NULL;
+
+        return pText + 2;
+    }
+
+    // Parse the element content.
+    return parseContent( pText + 1, elementIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::parseContent( char* pText, const S32 elementIndex )
+{
+    const char* pName = mElements[elementIndex].mpName;
+    S32 lastChildIndex = -1;
+    bool firstNode = true;
+
+    while( true )
+    {
+        pText = skipWhiteSpace( pText );
+
+        if ( *pText == 0 )
+            return NULL;
+
+        // Is this text?
+        if ( *pText != '<' )
+        {
+            // Yes, so parse the text up to the next tag.
+            char* pElementText = pText;
+            pText = parseText( pText );
+
+            if ( pText == NULL )
+                return NULL;
+
+            // Only text that is the first node is the element text.
+            if ( firstNode )
+                mElements[elementIndex].mpText = pElementText;
+
+            firstNode = false;
+        }
+
+        // Move past the tag open (the text may have terminated over it).
+        pText++;
+
+        // Is this the end tag?
+        if ( *pText == '/' )
+        {
+            // Yes, so check it matches this element.
+            pText++;
+
+            const char* pCheckName = pName;
+            while ( *pCheckName != 0 && *pCheckName == *pText )
+            {
+                pCheckName++;
+                pText++;
+            }
+
+            if ( *pCheckName != 0 || isXmlNameCharacter( *pText ) )
+                return NULL;
+
+            pText = skipWhiteSpace( pText );
+
+            if ( *pText != '>' )
+                return NULL;
+
+            return pText + 1;
+        }
+
+        // Is this character data?
+        if ( dStrncmp( pText, "![CDATA[", 8 ) == 0 )
+        {
+            // Yes, so use it verbatim.
+            char* pCharacterData = pText + 8;
+            pText = skipUntil( pCharacterData, "]]>" );
+
+            if ( pText == NULL )
+                return NULL;
+
+            *(pText - 3) = 0;
+
+            if ( firstNode )
+                mElements[elementIndex].mpText = pCharacterData;
+
+            firstNode = false;
+            continue;
+        }
+
+        // Skip any comment or processing instruction.
+        bool processed;
+        pText = parseMisc( pText, processed );
+
+        if ( pText == NULL )
+            return NULL;
+
+        firstNode = false;
+
+        if ( processed )
+            continue;
+
+        // Parse the child element.
+        S32 childIndex;
+        pText = parseElement( pText, childIndex );
+
+        if ( pText == NULL )
+            return NULL;
+
+        // Link the child element.
+        if ( lastChildIndex == -1 )
+            mElements[elementIndex].mFirstChild = childIndex;
+        else
+            mElements[lastChildIndex].mNextSibling = childIndex;
+
+        lastChildIndex = childIndex;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::parseText( char* pText )
+{
+    // Condense the white-space in-place as tinyXML does.
+    char* pWrite = pText;
+    bool whiteSpace = false;
+
+    while ( *pText != '<' )
+    {
+        const char character = *pText;
+
+        if ( character == 0 )
+            return NULL;
+
+        if ( isXmlWhiteSpace( character ) )
+        {
+            if ( character == '\n' )
+            {
+                mRow++;
+                mpRowStart = pText + 1;
+            }
+
+            whiteSpace = true;
+            pText++;
+            continue;
+        }
+
+        if ( whiteSpace )
+        {
+            *pWrite++ = ' ';
+            whiteSpace = false;
+        }
+
+        if ( character == '&' )
+            pText = decodeEntity( pText, pWrite );
+        else
+            *pWrite++ = *pText++;
+    }
+
+    // Terminate the text.  This may overwrite the tag open so return its position.
+    char* pTagOpen = pText;
+    *pWrite = 0;
+
+    return pTagOpen;
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::parseAttributeValue( char* pText, const char quote )
+{
+    char* pWrite = pText;
+
+    while ( *pText != quote )
+    {
+        const char character = *pText;
+
+        if ( character == 0 )
+            return NULL;
+
+        // Normalize line-endings.
+        if ( character == '\r' )
+        {
+            *pWrite++ = '\n';
+            pText++;
+
+            if ( *pText == '\n' )
+                pText++;
+
+            mRow++;
+            mpRowStart = pText;
+            continue;
+        }
+
+        if ( character == '\n' )
+        {
+            mRow++;
+            mpRowStart = pText + 1;
+        }
+
+        if ( character == '&' )
+            pText = decodeEntity( pText, pWrite );
+        else
+            *pWrite++ = *pText++;
+    }
+
+    // Terminate the value.
+    *pWrite = 0;
+
+    return pText + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::parseMisc( char* pText, bool& processed )
+{
+    processed = true;
+
+    // Processing instruction or declaration.
+    if ( *pText == '?' )
+        return skipUntil( pText + 1, "?>" );
+
+    if ( *pText == '!' )
+    {
+        // Comment.
+        if ( dStrncmp( pText, "!--", 3 ) == 0 )
+            return skipUntil( pText + 3, "-->" );
+
+        // Anything else such as a DTD is not supported.
+        return NULL;
+    }
+
+    // Not processed.
+    processed = false;
+    return pText;
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::skipWhiteSpace( char* pText )
+{
+    while ( isXmlWhiteSpace( *pText ) )
+    {
+        if ( *pText == '\n' )
+        {
+            mRow++;
+            mpRowStart = pText + 1;
+        }
+
+        pText++;
+    }
+
+    return pText;
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::skipUntil( char* pText, const char* pTerminator )
+{
+    const U32 terminatorLength = dStrlen( pTerminator );
+
+    while ( *pText != 0 )
+    {
+        if ( *pText == *pTerminator && dStrncmp( pText, pTerminator, terminatorLength ) == 0 )
+            return pText + terminatorLength;
+
+        if ( *pText == '\n' )
+        {
+            mRow++;
+            mpRowStart = pText + 1;
+        }
+
+        pText++;
+    }
+
+    // Terminator not found.
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+char* TamlXmlDocument::decodeEntity( char* pText, char*& pWrite )
+{
+    // Is this a character reference?
+    if ( pText[1] == '#' )
+    {
+        // Yes, so fetch the code-point.
+        const bool hexadecimal = pText[2] == 'x';
+        char* pDigits = pText + (hexadecimal ? 3 : 2);
+        char* pScan = pDigits;
+        U32 codePoint = 0;
+
+        while ( codePoint <= 0x10FFFF )
+        {
+            const char digit = *pScan;
+
+            if ( digit >= '0' && digit <= '9' )
+                codePoint = codePoint * (hexadecimal ? 16 : 10) + (digit - '0');
+            else if ( hexadecimal && digit >= 'a' && digit <= 'f' )
+                codePoint = codePoint * 16 + (digit - 'a' + 10);
+            else if ( hexadecimal && digit >= 'A' && digit <= 'F' )
+                codePoint = codePoint * 16 + (digit - 'A' + 10);
+            else
+                break;
+
+            pScan++;
+        }
+
+        // Encode as UTF-8 if valid.  The encoding is never longer than the reference.
+        if ( *pScan == ';' && pScan != pDigits && codePoint != 0 && codePoint <= 0x10FFFF )
+        {
+            if ( codePoint < 0x80 )
+            {
+                *pWrite++ = (char)codePoint;
+            }
+            else if ( codePoint < 0x800 )
+            {
+                *pWrite++ = (char)(0xC0 | (codePoint >> 6));
+                *pWrite++ = (char)(0x80 | (codePoint & 0x3F));
+            }
+            else if ( codePoint < 0x10000 )
+            {
+                *pWrite++ = (char)(0xE0 | (codePoint >> 12));
+                *pWrite++ = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+                *pWrite++ = (char)(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                *pWrite++ = (char)(0xF0 | (codePoint >> 18));
+                *pWrite++ = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+                *pWrite++ = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+                *pWrite++ = (char)(0x80 | (codePoint & 0x3F));
+            }
+
+            return pScan + 1;
+        }
+    }
+    else
+    {
+        // No, so check the predefined entities.
+        static const struct { const char* pEntity; U32 length; char value; } predefinedEntities[] =
+        {
+            { "&amp;", 5, '&' },
+            { "&lt;", 4, '<' },
+            { "&gt;", 4, '>' },
+            { "&quot;", 6, '\"' },
+            { "&apos;", 6, '\'' },
+        };
+
+        for ( U32 index = 0; index < sizeof(predefinedEntities) / sizeof(predefinedEntities[0]); ++index )
+        {
+            if ( dStrncmp( pText, predefinedEntities[index].pEntity, predefinedEntities[index].length ) == 0 )
+            {
+                *pWrite++ = predefinedEntities[index].value;
+                return pText + predefinedEntities[index].length;
+            }
+        }
+    }
+
+    // Unknown so keep the ampersand.
+    *pWrite++ = *pText++;
+    return pText;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlDocument::loadFallback( FileStream& stream, const U32 streamPosition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlDocument_LoadFallback);
+
+    // Rewind the stream.
+    stream.setPosition( streamPosition );
+
+    // Load the document with tinyXML.
+    mpFallbackDocument = new TiXmlDocument();
+    if ( !mpFallbackDocument->LoadFile( stream ) || mpFallbackDocument->RootElement() == NULL )
+    {
+        clear();
+        return false;
+    }
+
+    // Flatten the document.
+    flattenElement( mpFallbackDocument->RootElement() );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 TamlXmlDocument::flattenElement( TiXmlElement* pXmlElement )
+{
+    // Add the element.
+    const S32 elementIndex = mElements.size();
+    mElements.increment();
+    Element& element = mElements.last();
+    element.mpName = pXmlElement->Value();
+    element.mpText = pXmlElement->GetText();
+    element.mFirstAttribute = mAttributes.size();
+    element.mAttributeCount = 0;
+    element.mFirstChild = -1;
+    element.mNextSibling = -1;
+    element.mRow = pXmlElement->Row();
+    element.mColumn = pXmlElement->Column();
+
+    // Add the attributes.
+    for ( TiXmlAttribute* pXmlAttribute = pXmlElement->FirstAttribute(); pXmlAttribute; pXmlAttribute = pXmlAttribute->Next() )
+    {
+        Attribute attribute;
+        attribute.mpName = pXmlAttribute->Name();
+        attribute.mpValue = pXmlAttribute->Value();
+        mAttributes.push_back( attribute );
+        mElements[elementIndex].mAttributeCount++;
+    }
+
+    // Add the child elements.
+    S32 lastChildIndex = -1;
+    for ( TiXmlNode* pChildXmlNode = pXmlElement->FirstChild(); pChildXmlNode; pChildXmlNode = pChildXmlNode->NextSibling() )
+    {
+        // Skip if this is not an element.
+        TiXmlElement* pChildXmlElement = pChildXmlNode->ToElement();
+        if ( pChildXmlElement == NULL )
+            continue;
+
+        const S32 childIndex = flattenElement( pChildXmlElement );
+
+        // Link the child element.
+        if ( lastChildIndex == -1 )
+            mElements[elementIndex].mFirstChild = childIndex;
+        else
+            mElements[lastChildIndex].mNextSibling = childIndex;
+
+        lastChildIndex = childIndex;
+    }
+
+    return elementIndex;
+}
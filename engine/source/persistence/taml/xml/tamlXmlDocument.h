@@ -0,0 +1,129 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TAML_XMLDOCUMENT_H_
+#define _TAML_XMLDOCUMENT_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class TiXmlDocument;
+class TiXmlElement;
+
+//-----------------------------------------------------------------------------
+
+/// @ingroup tamlGroup
+/// @see tamlGroup
+///
+/// A read-only XML document parsed in-situ.
+///
+/// The whole file is read into a single buffer which is then parsed destructively: names and
+/// values are terminated and have their entities decoded in place so elements and attributes
+/// simply refer to slices of that buffer.  Elements and attributes are stored in two flat
+/// vectors, reserved up-front, so a document costs a handful of allocations no matter how many
+/// nodes it contains.
+///
+/// Documents the in-situ parser does not handle (e.g. a DTD) are loaded with tinyXML instead
+/// and flattened into the same representation.
+class TamlXmlDocument
+{
+public:
+    struct Attribute
+    {
+        const char* mpName;
+        const char* mpValue;
+    };
+
+    struct Element
+    {
+        const char* mpName;
+        const char* mpText;             ///< The text content if it is the first node of the element, otherwise NULL.
+        U32         mFirstAttribute;
+        U32         mAttributeCount;
+        S32         mFirstChild;        ///< Index of the first child element or -1.
+        S32         mNextSibling;       ///< Index of the next sibling element or -1.
+        U32         mRow;
+        U32         mColumn;
+    };
+
+public:
+    TamlXmlDocument();
+    ~TamlXmlDocument();
+
+    /// Load the document from the remainder of the stream.
+    /// If "inSitu" is false or the in-situ parser fails then tinyXML is used.
+    bool load( FileStream& stream, const bool inSitu = true );
+
+    /// Parse the specified null-terminated buffer in-situ.
+    /// The buffer is modified and must remain valid for the lifetime of the parsed document.
+    bool parse( char* pBuffer );
+
+    /// Clear the document.
+    void clear( void );
+
+    /// Elements.
+    inline S32 getRootElement( void ) const                             { return mElements.size() > 0 ? 0 : -1; }
+    inline U32 getElementCount( void ) const                            { return mElements.size(); }
+    inline const Element& getElement( const S32 index ) const           { return mElements[index]; }
+
+    /// Attributes.
+    inline U32 getAttributeCount( void ) const                          { return mAttributes.size(); }
+    inline const Attribute& getAttribute( const U32 index ) const       { return mAttributes[index]; }
+
+    /// Find the value of the named attribute (case-insensitive) or NULL if not found.
+    const char* findAttribute( const Element& element, const char* pAttributeName ) const;
+
+    /// Whether the document was loaded with the in-situ parser or not.
+    inline bool getInSitu( void ) const                                 { return mpFallbackDocument == NULL; }
+
+private:
+    char* parseElement( char* pText, S32& elementIndex );
+    char* parseContent( char* pText, const S32 elementIndex );
+    char* parseText( char* pText );
+    char* parseAttributeValue( char* pText, const char quote );
+    char* parseMisc( char* pText, bool& processed );
+    char* skipWhiteSpace( char* pText );
+    char* skipUntil( char* pText, const char* pTerminator );
+    char* decodeEntity( char* pText, char*& pWrite );
+
+    bool loadFallback( FileStream& stream, const U32 streamPosition );
+    S32 flattenElement( TiXmlElement* pXmlElement );
+
+private:
+    Vector<Element>     mElements;
+    Vector<Attribute>   mAttributes;
+    char*               mpBuffer;
+    TiXmlDocument*      mpFallbackDocument;
+
+    /// Parse location.
+    U32                 mRow;
+    const char*         mpRowStart;
+};
+
+#endif // _TAML_XMLDOCUMENT_H_
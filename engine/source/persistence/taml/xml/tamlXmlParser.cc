@@ -57,6 +57,26 @@ bool TamlXmlParser::accept( const char* pFilename, TamlVisitor& visitor )
         return false;
     }
 
+    // Does the visitor want to change properties?
+    if ( !visitor.wantsPropertyChanges() )
+    {
+        // No, so use the read-only in-situ document.
+        TamlXmlDocument xmlDocument;
+
+        // Load document from stream.
+        if ( !xmlDocument.load( stream ) )
+        {
+            // Warn!
+            Con::warnf("TamlXmlParser: Could not load Taml XML file from stream.");
+            return false;
+        }
+
+        // Close the stream.
+        stream.close();
+
+        return accept( filenameBuffer, xmlDocument, visitor );
+    }
+
     TiXmlDocument xmlDocument;
 
     // Load document from stream.
@@ -110,6 +130,37 @@ bool TamlXmlParser::accept( const char* pFilename, TamlVisitor& visitor )
 
 //-----------------------------------------------------------------------------
 
+bool TamlXmlParser::accept( const char* pFilename, const TamlXmlDocument& xmlDocument, TamlVisitor& visitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlParser_AcceptDocument);
+
+    // Sanity!
+    AssertFatal( pFilename != NULL, "Cannot parse a NULL filename." );
+    AssertFatal( !visitor.wantsPropertyChanges(), "Cannot parse a loaded document with a visitor that wants property changes." );
+
+    // Finish if the document is empty.
+    if ( xmlDocument.getElementCount() == 0 )
+    {
+        // Warn!
+        Con::warnf("TamlXmlParser: Could not parse an empty Taml XML document for '%s'.", pFilename );
+        return false;
+    }
+
+    // Set parsing filename.
+    setParsingFilename( pFilename );
+
+    // Parse root element.
+    parseElement( xmlDocument, xmlDocument.getRootElement(), visitor );
+
+    // Reset parsing filename.
+    setParsingFilename( StringTable->EmptyString );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 inline bool TamlXmlParser::parseElement( TiXmlElement* pXmlElement, TamlVisitor& visitor )
 {
     // Debug Profiling.
@@ -181,3 +232,61 @@ inline bool TamlXmlParser::parseAttributes( TiXmlElement* pXmlElement, TamlVisit
 
     return true;
 }
+
+//-----------------------------------------------------------------------------
+
+inline bool TamlXmlParser::parseElement( const TamlXmlDocument& xmlDocument, const S32 elementIndex, TamlVisitor& visitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlParser_ParseElement);
+
+    // Parse attributes (stop processing if instructed).
+    if ( !parseAttributes( xmlDocument, elementIndex, visitor ) )
+        return false;
+
+    // Finish if only the root is needed.
+    if ( visitor.wantsRootOnly() )
+        return false;
+
+    // Iterate children.
+    for ( S32 childElementIndex = xmlDocument.getElement( elementIndex ).mFirstChild; childElementIndex != -1; childElementIndex = xmlDocument.getElement( childElementIndex ).mNextSibling )
+    {
+        // Parse element (stop processing if instructed).
+        if ( !parseElement( xmlDocument, childElementIndex, visitor ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+inline bool TamlXmlParser::parseAttributes( const TamlXmlDocument& xmlDocument, const S32 elementIndex, TamlVisitor& visitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlParser_ParseAttribute);
+
+    // Fetch element.
+    const TamlXmlDocument::Element& xmlElement = xmlDocument.getElement( elementIndex );
+
+    // Create a visitor property state.
+    TamlVisitor::PropertyState propertyState;
+    propertyState.setObjectName( xmlElement.mpName, elementIndex == xmlDocument.getRootElement() );
+
+    // Iterate attributes.
+    const U32 attributeEnd = xmlElement.mFirstAttribute + xmlElement.mAttributeCount;
+    for ( U32 attributeIndex = xmlElement.mFirstAttribute; attributeIndex < attributeEnd; ++attributeIndex )
+    {
+        // Fetch attribute.
+        const TamlXmlDocument::Attribute& attribute = xmlDocument.getAttribute( attributeIndex );
+
+        // Configure property state.
+        propertyState.setProperty( attribute.mpName, attribute.mpValue );
+
+        // Visit this attribute (stop processing if instructed).
+        if ( !visitor.visit( *this, propertyState ) )
+            return false;
+    }
+
+    return true;
+}
@@ -31,9 +31,13 @@
 #include "persistence/tinyXML/tinyxml.h"
 #endif
 
+#ifndef _TAML_XMLDOCUMENT_H_
+#include "persistence/taml/xml/tamlXmlDocument.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
-/// @ingroup tamlGroup
+/// @ingroup tamlGroup
 /// @see tamlGroup
 class TamlXmlParser : public TamlParser
 {
@@ -47,9 +51,15 @@ public:
     /// Accept visitor.
     virtual bool accept( const char* pFilename, TamlVisitor& visitor );
 
+    /// Accept visitor for a document that has already been loaded (e.g. on a worker thread).
+    /// The visitor must not want property changes as the document is read-only.
+    bool accept( const char* pFilename, const TamlXmlDocument& xmlDocument, TamlVisitor& visitor );
+
 private:
     inline bool parseElement( TiXmlElement* pXmlElement, TamlVisitor& visitor );
     inline bool parseAttributes( TiXmlElement* pXmlElement, TamlVisitor& visitor );
+    inline bool parseElement( const TamlXmlDocument& xmlDocument, const S32 elementIndex, TamlVisitor& visitor );
+    inline bool parseAttributes( const TamlXmlDocument& xmlDocument, const S32 elementIndex, TamlVisitor& visitor );
 
     bool mDocumentDirty;
 };
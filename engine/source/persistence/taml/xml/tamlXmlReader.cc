@@ -32,11 +32,8 @@ SimObject* TamlXmlReader::read( FileStream& stream )
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_Read);
 
-    // Create document.
-    TiXmlDocument xmlDocument;
-
     // Load document from stream.
-    if ( !xmlDocument.LoadFile( stream ) )
+    if ( !mDocument.load( stream ) )
     {
         // Warn!
         Con::warnf("Taml: Could not load Taml XML file from stream.");
@@ -44,7 +41,7 @@ SimObject* TamlXmlReader::read( FileStream& stream )
     }
 
     // Parse root element.
-    SimObject* pSimObject = parseElement( xmlDocument.RootElement() );
+    SimObject* pSimObject = parseElement( mDocument.getElement( mDocument.getRootElement() ) );
 
     // Reset parse.
     resetParse();
@@ -61,11 +58,14 @@ void TamlXmlReader::resetParse( void )
 
     // Clear object reference map.
     mObjectReferenceMap.clear();
+
+    // Clear the document.
+    mDocument.clear();
 }
 
 //-----------------------------------------------------------------------------
 
-SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
+SimObject* TamlXmlReader::parseElement( const TamlXmlDocument::Element& xmlElement )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_ParseElement);
@@ -73,10 +73,10 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
     SimObject* pSimObject = NULL;
 
     // Fetch element name.
-    StringTableEntry typeName = StringTable->insert( pXmlElement->Value() );
+    StringTableEntry typeName = StringTable->insert( xmlElement.mpName );
 
     // Fetch reference to Id.
-    const U32 tamlRefToId = getTamlRefToId( pXmlElement );
+    const U32 tamlRefToId = getTamlRefToId( xmlElement );
 
     // Do we have a reference to Id?
     if ( tamlRefToId != 0 )
@@ -97,12 +97,12 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
     }
 
     // No, so fetch reference Id.
-    const U32 tamlRefId = getTamlRefId( pXmlElement );
+    const U32 tamlRefId = getTamlRefId( xmlElement );
 
 #ifdef TORQUE_DEBUG
     // Format the type location.
     char typeLocationBuffer[64];
-    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='xml' row=%d column=%d]", pXmlElement->Row(), pXmlElement->Column() );    
+    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='xml' row=%d column=%d]", xmlElement.mRow, xmlElement.mColumn );    
 
     // Create type.
     pSimObject = Taml::createType( typeName, mpTaml, typeLocationBuffer );
@@ -127,10 +127,10 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
     }
 
     // Parse attributes.
-    parseAttributes( pXmlElement, pSimObject );
+    parseAttributes( xmlElement, pSimObject );
 
     // Fetch object name.
-    StringTableEntry objectName = StringTable->insert( getTamlObjectName( pXmlElement ) );
+    StringTableEntry objectName = StringTable->insert( getTamlObjectName( xmlElement ) );
 
     // Does the object require a name?
     if ( objectName == StringTable->EmptyString )
@@ -164,12 +164,12 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
     }
 
     // Fetch any children.
-    TiXmlNode* pChildXmlNode = pXmlElement->FirstChild();
+    S32 childElementIndex = xmlElement.mFirstChild;
 
     TamlCustomNodes customProperties;
 
     // Do we have any element children?
-    if ( pChildXmlNode != NULL )
+    if ( childElementIndex != -1 )
     {
         // Fetch the Taml children.
         TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
@@ -181,32 +181,28 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
         do
         {
             // Fetch element.
-            TiXmlElement* pChildXmlElement = dynamic_cast<TiXmlElement*>( pChildXmlNode );
+            const TamlXmlDocument::Element& childXmlElement = mDocument.getElement( childElementIndex );
 
             // Move to next sibling.
-            pChildXmlNode = pChildXmlNode->NextSibling();
-
-            // Skip if this is not an element?
-            if ( pChildXmlElement == NULL )
-                continue;
+            childElementIndex = childXmlElement.mNextSibling;
 
             // Is this a standard child element?
-            if ( dStrchr( pChildXmlElement->Value(), '.' ) == NULL )
+            if ( dStrchr( childXmlElement.mpName, '.' ) == NULL )
             {
                 // Is this a Taml child?
                 if ( pChildren == NULL )
                 {
                     // No, so warn.
                     Con::warnf("Taml: Child element '%s' found under parent '%s' but object cannot have children.",
-                        pChildXmlElement->Value(),
-                        pXmlElement->Value() );
+                        childXmlElement.mpName,
+                        xmlElement.mpName );
 
                     // Skip.
                     continue;
                 }
 
                 // Yes, so parse child element.
-                SimObject* pChildSimObject = parseElement( pChildXmlElement );
+                SimObject* pChildSimObject = parseElement( childXmlElement );
 
                 // Skip if the child was not created.
                 if ( pChildSimObject == NULL )
@@ -248,10 +244,10 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
             else
             {
                 // No, so parse custom element.
-                parseCustomElement( pChildXmlElement, customProperties );
+                parseCustomElement( childXmlElement, customProperties );
             }
         }
-        while( pChildXmlNode != NULL );
+        while( childElementIndex != -1 );
 
         // Call custom read.
         mpTaml->tamlCustomRead( pCallbacks, customProperties );
@@ -270,7 +266,7 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
 
 //-----------------------------------------------------------------------------
 
-void TamlXmlReader::parseAttributes( TiXmlElement* pXmlElement, SimObject* pSimObject )
+void TamlXmlReader::parseAttributes( const TamlXmlDocument::Element& xmlElement, SimObject* pSimObject )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_ParseAttributes);
@@ -279,10 +275,14 @@ void TamlXmlReader::parseAttributes( TiXmlElement* pXmlElement, SimObject* pSimO
     AssertFatal( pSimObject != NULL, "Taml: Cannot parse attributes on a NULL object." );
 
     // Iterate attributes.
-    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
+    const U32 attributeEnd = xmlElement.mFirstAttribute + xmlElement.mAttributeCount;
+    for ( U32 attributeIndex = xmlElement.mFirstAttribute; attributeIndex < attributeEnd; ++attributeIndex )
     {
+        // Fetch attribute.
+        const TamlXmlDocument::Attribute& attribute = mDocument.getAttribute( attributeIndex );
+
         // Insert attribute name.
-        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
+        StringTableEntry attributeName = StringTable->insert( attribute.mpName );
 
         // Ignore if this is a Taml attribute.
         if (    attributeName == tamlRefIdName ||
@@ -291,28 +291,28 @@ void TamlXmlReader::parseAttributes( TiXmlElement* pXmlElement, SimObject* pSimO
             continue;
 
         // Set the field.
-        pSimObject->setPrefixedDataField( attributeName, NULL, pAttribute->Value() );
+        pSimObject->setPrefixedDataField( attributeName, NULL, attribute.mpValue );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlXmlReader::parseCustomElement( TiXmlElement* pXmlElement, TamlCustomNodes& customNodes )
+void TamlXmlReader::parseCustomElement( const TamlXmlDocument::Element& xmlElement, TamlCustomNodes& customNodes )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_ParseCustomElement);
 
     // Is this a standard child element?
-    const char* pPeriod = dStrchr( pXmlElement->Value(), '.' );
+    const char* pPeriod = dStrchr( xmlElement.mpName, '.' );
 
     // Sanity!
     AssertFatal( pPeriod != NULL, "Parsing extended element but no period character found." );
 
     // Fetch any custom XML node.
-    TiXmlNode* pCustomXmlNode = pXmlElement->FirstChild();
+    S32 customElementIndex = xmlElement.mFirstChild;
 
     // Finish is no XML node exists.
-    if ( pCustomXmlNode == NULL )
+    if ( customElementIndex == -1 )
         return;
 
     // Yes, so add custom node.
@@ -321,30 +321,26 @@ void TamlXmlReader::parseCustomElement( TiXmlElement* pXmlElement, TamlCustomNod
     do
     {
         // Fetch element.
-        TiXmlElement* pCustomXmlElement = dynamic_cast<TiXmlElement*>( pCustomXmlNode );
+        const TamlXmlDocument::Element& customXmlElement = mDocument.getElement( customElementIndex );
 
         // Move to next sibling.
-        pCustomXmlNode = pCustomXmlNode->NextSibling();
-
-        // Skip if this is not an element.
-        if ( pCustomXmlElement == NULL )
-            continue;
+        customElementIndex = customXmlElement.mNextSibling;
 
         // Parse custom node.
-        parseCustomNode( pCustomXmlElement, pCustomNode );
+        parseCustomNode( customXmlElement, pCustomNode );
     }
-    while ( pCustomXmlNode != NULL );
+    while ( customElementIndex != -1 );
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlXmlReader::parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode* pCustomNode )
+void TamlXmlReader::parseCustomNode( const TamlXmlDocument::Element& xmlElement, TamlCustomNode* pCustomNode )
 {
     // Is the node a proxy object?
-    if (  getTamlRefId( pXmlElement ) != 0 || getTamlRefToId( pXmlElement ) != 0 )
+    if (  getTamlRefId( xmlElement ) != 0 || getTamlRefToId( xmlElement ) != 0 )
     {
         // Yes, so parse proxy object.
-        SimObject* pProxyObject = parseElement( pXmlElement );
+        SimObject* pProxyObject = parseElement( xmlElement );
 
         // Add child node.
         pCustomNode->addNode( pProxyObject );
@@ -353,24 +349,28 @@ void TamlXmlReader::parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode*
     }
 
     // Yes, so add child node.
-    TamlCustomNode* pChildNode = pCustomNode->addNode( pXmlElement->Value() );
+    TamlCustomNode* pChildNode = pCustomNode->addNode( xmlElement.mpName );
 
     // Iterate attributes.
-    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
+    const U32 attributeEnd = xmlElement.mFirstAttribute + xmlElement.mAttributeCount;
+    for ( U32 attributeIndex = xmlElement.mFirstAttribute; attributeIndex < attributeEnd; ++attributeIndex )
     {
+        // Fetch attribute.
+        const TamlXmlDocument::Attribute& attribute = mDocument.getAttribute( attributeIndex );
+
         // Insert attribute name.
-        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
+        StringTableEntry attributeName = StringTable->insert( attribute.mpName );
 
         // Skip if a Taml reference attribute.
         if ( attributeName == tamlRefIdName || attributeName == tamlRefToIdName )
             continue;
 
         // Add node field.
-        pChildNode->addField( attributeName, pAttribute->Value() );
+        pChildNode->addField( attributeName, attribute.mpValue );
     }
 
     // Fetch any element text.
-    const char* pElementText = pXmlElement->GetText();
+    const char* pElementText = xmlElement.mpText;
 
     // Do we have any element text?
     if ( pElementText != NULL )
@@ -380,104 +380,61 @@ void TamlXmlReader::parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode*
     }
 
     // Fetch any children.
-    TiXmlNode* pChildXmlNode = pXmlElement->FirstChild();
+    S32 childElementIndex = xmlElement.mFirstChild;
 
     // Do we have any element children?
-    if ( pChildXmlNode != NULL )
+    if ( childElementIndex != -1 )
     {
         do
         {
             // Yes, so fetch child element.
-            TiXmlElement* pChildXmlElement = dynamic_cast<TiXmlElement*>( pChildXmlNode );
+            const TamlXmlDocument::Element& childXmlElement = mDocument.getElement( childElementIndex );
 
             // Move to next sibling.
-            pChildXmlNode = pChildXmlNode->NextSibling();
-
-            // Skip if this is not an element.
-            if ( pChildXmlElement == NULL )
-                continue;
+            childElementIndex = childXmlElement.mNextSibling;
 
             // Parse custom node.
-            parseCustomNode( pChildXmlElement, pChildNode );
+            parseCustomNode( childXmlElement, pChildNode );
         }
-        while( pChildXmlNode != NULL );
+        while( childElementIndex != -1 );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-U32 TamlXmlReader::getTamlRefId( TiXmlElement* pXmlElement )
+U32 TamlXmlReader::getTamlRefId( const TamlXmlDocument::Element& xmlElement )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_GetTamlRefId);
 
-    // Iterate attributes.
-    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
-    {
-        // Insert attribute name.
-        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
-
-        // Skip if not the correct attribute.
-        if ( attributeName != tamlRefIdName )
-            continue;
+    // Find attribute.
+    const char* pAttributeValue = mDocument.findAttribute( xmlElement, tamlRefIdName );
 
-        // Return it.
-        return dAtoi( pAttribute->Value() );
-    }
-
-    // Not found.
-    return 0;
+    // Return it (if found).
+    return pAttributeValue == NULL ? 0 : dAtoi( pAttributeValue );
 }
 
 //-----------------------------------------------------------------------------
 
-U32 TamlXmlReader::getTamlRefToId( TiXmlElement* pXmlElement )
+U32 TamlXmlReader::getTamlRefToId( const TamlXmlDocument::Element& xmlElement )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_GetTamlRefToId);
 
-    // Iterate attributes.
-    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
-    {
-        // Insert attribute name.
-        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
-
-        // Skip if not the correct attribute.
-        if ( attributeName != tamlRefToIdName )
-            continue;
-
-        // Return it.
-        return dAtoi( pAttribute->Value() );
-    }
+    // Find attribute.
+    const char* pAttributeValue = mDocument.findAttribute( xmlElement, tamlRefToIdName );
 
-    // Not found.
-    return 0;
+    // Return it (if found).
+    return pAttributeValue == NULL ? 0 : dAtoi( pAttributeValue );
 }
 
 //-----------------------------------------------------------------------------
 
-const char* TamlXmlReader::getTamlObjectName( TiXmlElement* pXmlElement )
+const char* TamlXmlReader::getTamlObjectName( const TamlXmlDocument::Element& xmlElement )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_GetTamlObjectName);
 
-    // Iterate attributes.
-    for ( TiXmlAttribute* pAttribute = pXmlElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next() )
-    {
-        // Insert attribute name.
-        StringTableEntry attributeName = StringTable->insert( pAttribute->Name() );
-
-        // Skip if not the correct attribute.
-        if ( attributeName != tamlNamedObjectName )
-            continue;
-
-        // Return it.
-        return pAttribute->Value();
-    }
-
-    // Not found.
-    return NULL;
+    // Find attribute.
+    return mDocument.findAttribute( xmlElement, tamlNamedObjectName );
 }
-
-
-
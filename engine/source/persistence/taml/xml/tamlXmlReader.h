@@ -31,13 +31,13 @@
 #include "persistence/taml/taml.h"
 #endif
 
-#ifndef TINYXML_INCLUDED
-#include "persistence/tinyXML/tinyxml.h"
+#ifndef _TAML_XMLDOCUMENT_H_
+#include "persistence/taml/xml/tamlXmlDocument.h"
 #endif
 
 //-----------------------------------------------------------------------------
 
-/// @ingroup tamlGroup
+/// @ingroup tamlGroup
 /// @see tamlGroup
 class TamlXmlReader
 {
@@ -57,17 +57,19 @@ private:
     typedef HashMap<SimObjectId, SimObject*> typeObjectReferenceHash;
     typeObjectReferenceHash mObjectReferenceMap;
 
+    TamlXmlDocument mDocument;
+
 private:
     void resetParse( void );
 
-    SimObject* parseElement( TiXmlElement* pXmlElement );
-    void parseAttributes( TiXmlElement* pXmlElement, SimObject* pSimObject );
-    void parseCustomElement( TiXmlElement* pXmlElement, TamlCustomNodes& pCustomNode );
-    void parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode* pCustomNode );
+    SimObject* parseElement( const TamlXmlDocument::Element& xmlElement );
+    void parseAttributes( const TamlXmlDocument::Element& xmlElement, SimObject* pSimObject );
+    void parseCustomElement( const TamlXmlDocument::Element& xmlElement, TamlCustomNodes& pCustomNode );
+    void parseCustomNode( const TamlXmlDocument::Element& xmlElement, TamlCustomNode* pCustomNode );
 
-    U32 getTamlRefId( TiXmlElement* pXmlElement );
-    U32 getTamlRefToId( TiXmlElement* pXmlElement );
-    const char* getTamlObjectName( TiXmlElement* pXmlElement );   
+    U32 getTamlRefId( const TamlXmlDocument::Element& xmlElement );
+    U32 getTamlRefToId( const TamlXmlDocument::Element& xmlElement );
+    const char* getTamlObjectName( const TamlXmlDocument::Element& xmlElement );
 };
 
 #endif // _TAML_XMLREADER_H_
\ No newline at end of file
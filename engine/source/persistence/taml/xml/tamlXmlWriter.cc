@@ -38,33 +38,18 @@ bool TamlXmlWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNo
     // Compile the root element.
     TiXmlElement* pRootElement = compileElement( pTamlWriteNode );
 
-    // Fetch any TAML Schema file reference.
-    const char* pTamlSchemaFile = Con::getVariable( TAML_SCHEMA_VARIABLE );
+    // Fetch the TAML Schema file location.
+    // NOTE:- This is resolved before writing as the write may happen in the background.
+    StringTableEntry schemaLocation = mpTaml->getSchemaLocation();
 
-    // Do we have a schema file reference?
-    if ( pTamlSchemaFile != NULL && *pTamlSchemaFile != 0 )
+    // Do we have a schema file location?
+    if ( schemaLocation != StringTable->EmptyString )
     {
         // Yes, so add namespace attribute to root.
         pRootElement->SetAttribute( "xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance" );
 
-        // Expand the file-path reference.
-        char schemaFilePathBuffer[1024];
-        Con::expandPath( schemaFilePathBuffer, sizeof(schemaFilePathBuffer), pTamlSchemaFile );
-
-        // Fetch the output path for the Taml file.
-        char outputFileBuffer[1024];
-        dSprintf( outputFileBuffer, sizeof(outputFileBuffer), "%s", mpTaml->getFilePathBuffer() );
-        char* pFileStart = dStrrchr( outputFileBuffer, '/' );
-        if ( pFileStart == NULL )
-            *outputFileBuffer = 0;
-        else
-            *pFileStart = 0;
-
-        // Fetch the schema file-path relative to the output file.
-        StringTableEntry relativeSchemaFilePath = Platform::makeRelativePathName( schemaFilePathBuffer, outputFileBuffer );
-
         // Add schema location attribute to root.
-        pRootElement->SetAttribute( "xsi:noNamespaceSchemaLocation", relativeSchemaFilePath );
+        pRootElement->SetAttribute( "xsi:noNamespaceSchemaLocation", schemaLocation );
     }
 
     // Link the root element.
@@ -81,11 +66,8 @@ TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlWriter_CompileElement);
 
-    // Fetch object.
-    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
-
     // Fetch element name.
-    const char* pElementName = pSimObject->getClassName();
+    const char* pElementName = pTamlWriteNode->mpClassName;
 
     // Create element.
     TiXmlElement* pElement = new TiXmlElement( pElementName );
@@ -200,10 +182,10 @@ void TamlXmlWriter::compileCustomElements( TiXmlElement* pXmlElement, const Taml
         // Format extended element name.
         char extendedElementNameBuffer[256];
         dSprintf( extendedElementNameBuffer, sizeof(extendedElementNameBuffer), "%s.%s", pXmlElement->Value(), pCustomNode->getNodeName() );
-        StringTableEntry extendedElementName = StringTable->insert( extendedElementNameBuffer );
 
         // Create element.
-        TiXmlElement* pExtendedPropertyElement = new TiXmlElement( extendedElementName );
+        // NOTE:- The element copies the name so the string table is not needed.
+        TiXmlElement* pExtendedPropertyElement = new TiXmlElement( extendedElementNameBuffer );
 
         // Fetch node children.
         const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
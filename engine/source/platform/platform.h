@@ -213,6 +213,8 @@ struct Platform
     static bool fileTouch(const char *name);
     static bool pathCopy(const char *fromName, const char *toName, bool nooverwrite = true);
     static StringTableEntry osGetTemporaryDirectory();
+    static void* mapFile(const char *pFilePath, U32& size);
+    static void unmapFile(void* pMemory, U32 size);
 
     /// Misc.
     static StringTableEntry createUUID( void );
@@ -26,6 +26,17 @@
 #include "console/console.h"
 #include "string/stringTable.h"
 #include "io/resource/resourceManager.h"
+#include "io/fileStream.h"
+
+#if defined(TORQUE_OS_WIN32)
+#include <windows.h>
+#elif defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OPENBSD) || defined(TORQUE_OS_FREEBSD) || defined(TORQUE_OS_OSX) || defined(TORQUE_OS_IOS)
+#define TORQUE_FILE_MAP_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "platformFileIO_ScriptBinding.h"
 
@@ -454,3 +465,106 @@ StringTableEntry Platform::getPrefsPath(const char *file /* = NULL */)
 }
 
 //-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+
+void* Platform::mapFile(const char *pFilePath, U32& size)
+{
+   size = 0;
+
+   char fullPath[1024];
+   Platform::makeFullPathName(pFilePath, fullPath, sizeof(fullPath));
+
+#if defined(TORQUE_OS_WIN32)
+   // Windows wants backslashes.
+   for(char* pScan = fullPath; *pScan; ++pScan)
+   {
+      if(*pScan == '/')
+         *pScan = '\\';
+   }
+
+   HANDLE fileHandle = CreateFileA(fullPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if(fileHandle == INVALID_HANDLE_VALUE)
+      return NULL;
+
+   const DWORD fileSize = GetFileSize(fileHandle, NULL);
+   if(fileSize == 0 || fileSize == INVALID_FILE_SIZE)
+   {
+      CloseHandle(fileHandle);
+      return NULL;
+   }
+
+   HANDLE mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+   // The view keeps the file referenced so both handles can go.
+   CloseHandle(fileHandle);
+   if(mappingHandle == NULL)
+      return NULL;
+
+   void* pMemory = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+   CloseHandle(mappingHandle);
+   if(pMemory == NULL)
+      return NULL;
+
+   size = fileSize;
+   return pMemory;
+
+#elif defined(TORQUE_FILE_MAP_POSIX)
+   const int fileHandle = open(fullPath, O_RDONLY);
+   if(fileHandle < 0)
+      return NULL;
+
+   struct stat fileStat;
+   if(fstat(fileHandle, &fileStat) != 0 || fileStat.st_size <= 0)
+   {
+      close(fileHandle);
+      return NULL;
+   }
+
+   void* pMemory = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fileHandle, 0);
+
+   // The mapping keeps the file referenced so the descriptor can go.
+   close(fileHandle);
+   if(pMemory == MAP_FAILED)
+      return NULL;
+
+   size = (U32)fileStat.st_size;
+   return pMemory;
+
+#else
+   // No file mapping here (bundled or virtual file-systems) so fall back to reading the file.
+   FileStream fileStream;
+   if(!fileStream.open(fullPath, FileStream::Read))
+      return NULL;
+
+   const U32 fileSize = fileStream.getStreamSize();
+   if(fileSize == 0)
+      return NULL;
+
+   void* pMemory = dMalloc(fileSize);
+   if(!fileStream.read(fileSize, pMemory))
+   {
+      dFree(pMemory);
+      return NULL;
+   }
+
+   size = fileSize;
+   return pMemory;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void Platform::unmapFile(void* pMemory, U32 size)
+{
+   if(pMemory == NULL)
+      return;
+
+#if defined(TORQUE_OS_WIN32)
+   UnmapViewOfFile(pMemory);
+#elif defined(TORQUE_FILE_MAP_POSIX)
+   munmap(pMemory, size);
+#else
+   dFree(pMemory);
+#endif
+}
@@ -25,26 +25,581 @@
 #include "console/console.h"
 #include "debug/profiler.h"
 #include "platform/threads/mutex.h"
+#include "platform/threads/atomic.h"
+#include "platform/platformTLS.h"
 #include "math/mMath.h"
 #include <stdlib.h>
 
+#include "platformMemory_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+// Count of engine heap allocations.
+// This is deliberately not synchronized as it is only used as a statistic.
+static U32 sAllocationCount = 0;
+
+//-----------------------------------------------------------------------------
+
+#define MEMORY_HEADER_MAGIC         0x4D454D54
+#define MEMORY_HEADER_FREED         0x46524545
+#define MEMORY_POOL_CLASS_NONE      0xFF
+#define MEMORY_POOL_CLASS_COUNT     8
+#define MEMORY_POOL_MAX_SIZE        256
+#define MEMORY_POOL_MAX_FREE_BLOCKS 256
+#define MEMORY_SITE_TABLE_SIZE      4096
+
+// The header prefixed to every engine heap allocation.
+// It is 16 bytes so that the alignment of the underlying allocation is preserved.
+struct MemoryHeader
+{
+   U32   mSize;
+   U32   mSite;
+   U8    mTag;
+   U8    mPoolClass;
+   U16   mReserved;
+   U32   mMagic;
+};
+
+// A free pool block.  The link overlays the user data so the header remains intact.
+struct MemoryPoolBlock
+{
+   MemoryPoolBlock* mpNext;
+};
+
+// The per-thread memory state.
+struct MemoryThreadState
+{
+   MemoryTag         mTag;
+   MemoryPoolBlock*  mpFreeBlocks[MEMORY_POOL_CLASS_COUNT];
+   U32               mFreeBlockCount[MEMORY_POOL_CLASS_COUNT];
+};
+
+// An allocation site.
+struct MemorySite
+{
+   const char* mFileName;
+   U32         mLine;
+   U32         mLiveBytes;
+   U32         mLiveCount;
+   U32         mAllocationCount;
+};
+
+static const U32 sPoolClassSizes[MEMORY_POOL_CLASS_COUNT] = { 16, 32, 48, 64, 96, 128, 192, 256 };
+
+static const char* sMemoryTagNames[MemoryTag_Count] = { "General", "Scene", "Render", "Script", "Assets", "Taml", "Network", "Audio", "GUI" };
+static const char* sMemoryBackendNames[MemoryBackend_Count] = { "Heap", "Pool" };
+
+static MemoryBackend sTagBackends[MemoryTag_Count] =
+{
+   MemoryBackend_Heap,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+   MemoryBackend_Pool,
+};
+
+static volatile U32 sTagLiveBytes[MemoryTag_Count];
+static volatile U32 sTagPeakBytes[MemoryTag_Count];
+static volatile U32 sTagLiveCount[MemoryTag_Count];
+static volatile U32 sTagAllocationCount[MemoryTag_Count];
+
+// Site tracking.  Site zero is reserved for untracked allocations.
+static bool sSiteTracking = false;
+static volatile U32 sSiteLock = 0;
+static U32 sSiteCount = 0;
+static MemorySite sSites[MEMORY_SITE_TABLE_SIZE];
+
+// The thread storage is constructed on first use and never destroyed as allocations can happen during static construction and destruction.
+static union { U8 mBytes[sizeof(ThreadStorage)]; void* mAlignPointer; F64 mAlignF64; } sThreadStorageBuffer;
+static ThreadStorage* spThreadStorage = NULL;
+
+//-----------------------------------------------------------------------------
+
+static MemoryThreadState* getMemoryThreadState()
+{
+   // Construct the thread storage if required.
+   // The first allocation always happens on the main thread during static construction so this is safe.
+   if (spThreadStorage == NULL)
+      spThreadStorage = constructInPlace((ThreadStorage*)sThreadStorageBuffer.mBytes);
+
+   // Fetch the thread state.
+   MemoryThreadState* pThreadState = (MemoryThreadState*)spThreadStorage->get();
+
+   // Create the thread state if this is the first allocation on this thread.
+   if (pThreadState == NULL)
+   {
+      pThreadState = (MemoryThreadState*)malloc(sizeof(MemoryThreadState));
+      memset(pThreadState, 0, sizeof(MemoryThreadState));
+      pThreadState->mTag = MemoryTag_General;
+      spThreadStorage->set(pThreadState);
+   }
+
+   return pThreadState;
+}
+
+//-----------------------------------------------------------------------------
+
+void dReleaseThreadMemory()
+{
+   // Finish if no thread has allocated yet.
+   if (spThreadStorage == NULL)
+      return;
+
+   // Finish if this thread never allocated.
+   MemoryThreadState* pThreadState = (MemoryThreadState*)spThreadStorage->get();
+   if (pThreadState == NULL)
+      return;
+
+   // Detach the state first so any later allocation on this thread starts a fresh one.
+   spThreadStorage->set(NULL);
+
+   // Return the cached pool blocks to the heap.
+   for (U32 poolClass = 0; poolClass < MEMORY_POOL_CLASS_COUNT; ++poolClass)
+   {
+      MemoryPoolBlock* pBlock = pThreadState->mpFreeBlocks[poolClass];
+      while (pBlock != NULL)
+      {
+         MemoryPoolBlock* pNextBlock = pBlock->mpNext;
+         free(((MemoryHeader*)pBlock) - 1);
+         pBlock = pNextBlock;
+      }
+   }
+
+   free(pThreadState);
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 getMemorySite(const char* fileName, const U32 line)
+{
+   // Lock the sites.
+   while (!dAtomicCompareExchange(sSiteLock, 0, 1)) {}
+
+   // Find the site using linear probing.
+   U32 siteIndex = (((U32)(size_t)fileName >> 2) ^ (line * 2654435761U)) & (MEMORY_SITE_TABLE_SIZE - 1);
+   while (true)
+   {
+      MemorySite& site = sSites[siteIndex];
+
+      // Found the site?
+      if (siteIndex != 0 && site.mFileName == fileName && site.mLine == line)
+         break;
+
+      // Found an empty slot?
+      if (siteIndex != 0 && site.mFileName == NULL)
+      {
+         // Use the untracked site if the table is getting full.
+         if (sSiteCount >= (MEMORY_SITE_TABLE_SIZE * 3) / 4)
+         {
+            siteIndex = 0;
+            break;
+         }
+
+         site.mFileName = fileName;
+         site.mLine = line;
+         sSiteCount++;
+         break;
+      }
+
+      siteIndex = (siteIndex + 1) & (MEMORY_SITE_TABLE_SIZE - 1);
+   }
+
+   return siteIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+static void trackAllocation(MemoryHeader* pHeader, const char* fileName, const U32 line)
+{
+   const U32 tag = pHeader->mTag;
+   const U32 size = pHeader->mSize;
+
+   // Update the tag statistics.
+   const U32 liveBytes = dAtomicAdd(sTagLiveBytes[tag], size);
+   dAtomicAdd(sTagLiveCount[tag], 1);
+   dAtomicAdd(sTagAllocationCount[tag], 1);
+
+   // The peak is only a statistic so a racing update is acceptable.
+   if (liveBytes > sTagPeakBytes[tag])
+      sTagPeakBytes[tag] = liveBytes;
+
+   // Finish if not tracking sites.
+   if (!sSiteTracking)
+   {
+      pHeader->mSite = 0;
+      return;
+   }
+
+   // Update the site statistics.
+   // NOTE: The site lock is acquired whilst fetching the site.
+   const U32 siteIndex = getMemorySite(fileName != NULL ? fileName : "<unknown>", line);
+   MemorySite& site = sSites[siteIndex];
+   site.mLiveBytes += size;
+   site.mLiveCount++;
+   site.mAllocationCount++;
+   dAtomicStoreRelease(sSiteLock, 0);
+
+   pHeader->mSite = siteIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+static void untrackAllocation(MemoryHeader* pHeader)
+{
+   const U32 tag = pHeader->mTag;
+   const U32 size = pHeader->mSize;
+
+   // Update the tag statistics.
+   dAtomicAdd(sTagLiveBytes[tag], (U32)-(S32)size);
+   dAtomicAdd(sTagLiveCount[tag], (U32)-1);
+
+   // Finish if the site was not tracked.
+   if (pHeader->mSite == 0)
+      return;
+
+   // Update the site statistics.
+   while (!dAtomicCompareExchange(sSiteLock, 0, 1)) {}
+   MemorySite& site = sSites[pHeader->mSite];
+   site.mLiveBytes -= size;
+   site.mLiveCount--;
+   dAtomicStoreRelease(sSiteLock, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+static void* allocateTagged(dsize_t in_size, const MemoryTag tag, MemoryThreadState* pThreadState, const char* fileName, const dsize_t line)
+{
+   MemoryHeader* pHeader = NULL;
+   U8 poolClass = MEMORY_POOL_CLASS_NONE;
+
+   // Use a pool if the tag wants it and the allocation is small enough.
+   if (sTagBackends[tag] == MemoryBackend_Pool && in_size <= MEMORY_POOL_MAX_SIZE)
+   {
+      // Find the pool class.
+      poolClass = 0;
+      while (sPoolClassSizes[poolClass] < in_size)
+         poolClass++;
+
+      // Reuse a free block if one is available otherwise allocate a new one.
+      MemoryPoolBlock* pBlock = pThreadState->mpFreeBlocks[poolClass];
+      if (pBlock != NULL)
+      {
+         pThreadState->mpFreeBlocks[poolClass] = pBlock->mpNext;
+         pThreadState->mFreeBlockCount[poolClass]--;
+         pHeader = ((MemoryHeader*)pBlock) - 1;
+      }
+      else
+      {
+         sAllocationCount++;
+         pHeader = (MemoryHeader*)malloc(sizeof(MemoryHeader) + sPoolClassSizes[poolClass]);
+      }
+   }
+   else
+   {
+      sAllocationCount++;
+      pHeader = (MemoryHeader*)malloc(sizeof(MemoryHeader) + in_size);
+   }
+
+   if (pHeader == NULL)
+      return NULL;
+
+   pHeader->mSize = (U32)in_size;
+   pHeader->mTag = (U8)tag;
+   pHeader->mPoolClass = poolClass;
+   pHeader->mReserved = 0;
+   pHeader->mMagic = MEMORY_HEADER_MAGIC;
+   trackAllocation(pHeader, fileName, (U32)line);
+
+   return pHeader + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 dGetAllocationCount()
+{
+   return sAllocationCount;
+}
+
 //-----------------------------------------------------------------------------
 
 void* dMalloc_r(dsize_t in_size, const char* fileName, const dsize_t line)
 {
-   return malloc(in_size);
+   MemoryThreadState* pThreadState = getMemoryThreadState();
+   return allocateTagged(in_size, pThreadState->mTag, pThreadState, fileName, line);
 }
 
 //-----------------------------------------------------------------------------
 
 void dFree(void* in_pFree)
 {
-   free(in_pFree);
+   if (in_pFree == NULL)
+      return;
+
+   // Fetch the header.
+   MemoryHeader* pHeader = ((MemoryHeader*)in_pFree) - 1;
+   AssertFatal(pHeader->mMagic == MEMORY_HEADER_MAGIC, "dFree() - Memory was not allocated with dMalloc, has already been freed or has been corrupted.");
+
+   untrackAllocation(pHeader);
+   pHeader->mMagic = MEMORY_HEADER_FREED;
+
+   // Return a pool block to this thread's pool if it has room.
+   // Blocks are plain heap allocations so it does not matter which thread allocated them.
+   const U8 poolClass = pHeader->mPoolClass;
+   if (poolClass != MEMORY_POOL_CLASS_NONE)
+   {
+      MemoryThreadState* pThreadState = getMemoryThreadState();
+      if (pThreadState->mFreeBlockCount[poolClass] < MEMORY_POOL_MAX_FREE_BLOCKS)
+      {
+         MemoryPoolBlock* pBlock = (MemoryPoolBlock*)in_pFree;
+         pBlock->mpNext = pThreadState->mpFreeBlocks[poolClass];
+         pThreadState->mpFreeBlocks[poolClass] = pBlock;
+         pThreadState->mFreeBlockCount[poolClass]++;
+         return;
+      }
+   }
+
+   free(pHeader);
 }
 
 //-----------------------------------------------------------------------------
 
 void* dRealloc_r(void* in_pResize, dsize_t in_size, const char* fileName, const dsize_t line)
 {
-   return realloc(in_pResize,in_size);
+   if (in_pResize == NULL)
+      return dMalloc_r(in_size, fileName, line);
+
+   if (in_size == 0)
+   {
+      dFree(in_pResize);
+      return NULL;
+   }
+
+   // Fetch the header.
+   MemoryHeader* pHeader = ((MemoryHeader*)in_pResize) - 1;
+   AssertFatal(pHeader->mMagic == MEMORY_HEADER_MAGIC, "dRealloc() - Memory was not allocated with dMalloc, has already been freed or has been corrupted.");
+
+   // The reallocation stays with the tag of the original allocation.
+   const MemoryTag tag = (MemoryTag)pHeader->mTag;
+
+   if (pHeader->mPoolClass != MEMORY_POOL_CLASS_NONE)
+   {
+      // Resize in place if the pool block is big enough.
+      if (in_size <= sPoolClassSizes[pHeader->mPoolClass])
+      {
+         untrackAllocation(pHeader);
+         pHeader->mSize = (U32)in_size;
+         trackAllocation(pHeader, fileName, (U32)line);
+         return in_pResize;
+      }
+
+      // Move to a new allocation.
+      void* pResized = allocateTagged(in_size, tag, getMemoryThreadState(), fileName, line);
+      if (pResized != NULL)
+      {
+         dMemcpy(pResized, in_pResize, pHeader->mSize);
+         dFree(in_pResize);
+      }
+      return pResized;
+   }
+
+   sAllocationCount++;
+
+   untrackAllocation(pHeader);
+   MemoryHeader* pResizedHeader = (MemoryHeader*)realloc(pHeader, sizeof(MemoryHeader) + in_size);
+
+   // Keep the original allocation if the reallocation failed.
+   if (pResizedHeader == NULL)
+   {
+      trackAllocation(pHeader, fileName, (U32)line);
+      return NULL;
+   }
+
+   pResizedHeader->mSize = (U32)in_size;
+   trackAllocation(pResizedHeader, fileName, (U32)line);
+   return pResizedHeader + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+MemoryTag dGetMemoryTag()
+{
+   return getMemoryThreadState()->mTag;
+}
+
+//-----------------------------------------------------------------------------
+
+MemoryTag dSetMemoryTag(const MemoryTag tag)
+{
+   AssertFatal(tag < MemoryTag_Count, "dSetMemoryTag() - Invalid memory tag.");
+
+   MemoryThreadState* pThreadState = getMemoryThreadState();
+   const MemoryTag previousTag = pThreadState->mTag;
+   pThreadState->mTag = tag;
+   return previousTag;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* dGetMemoryTagName(const MemoryTag tag)
+{
+   AssertFatal(tag < MemoryTag_Count, "dGetMemoryTagName() - Invalid memory tag.");
+   return sMemoryTagNames[tag];
+}
+
+//-----------------------------------------------------------------------------
+
+MemoryTag dGetMemoryTagEnum(const char* pTagName)
+{
+   for (U32 tag = 0; tag < MemoryTag_Count; ++tag)
+   {
+      if (dStricmp(sMemoryTagNames[tag], pTagName) == 0)
+         return (MemoryTag)tag;
+   }
+
+   return MemoryTag_Count;
+}
+
+//-----------------------------------------------------------------------------
+
+void dGetMemoryTagStats(const MemoryTag tag, MemoryTagStats& stats)
+{
+   AssertFatal(tag < MemoryTag_Count, "dGetMemoryTagStats() - Invalid memory tag.");
+
+   stats.mLiveBytes = sTagLiveBytes[tag];
+   stats.mPeakBytes = sTagPeakBytes[tag];
+   stats.mLiveCount = sTagLiveCount[tag];
+   stats.mAllocationCount = sTagAllocationCount[tag];
+}
+
+//-----------------------------------------------------------------------------
+
+void dResetMemoryTagPeak(const MemoryTag tag)
+{
+   AssertFatal(tag < MemoryTag_Count, "dResetMemoryTagPeak() - Invalid memory tag.");
+
+   sTagPeakBytes[tag] = sTagLiveBytes[tag];
+}
+
+//-----------------------------------------------------------------------------
+
+void dSetMemoryTagBackend(const MemoryTag tag, const MemoryBackend backend)
+{
+   AssertFatal(tag < MemoryTag_Count, "dSetMemoryTagBackend() - Invalid memory tag.");
+   AssertFatal(backend < MemoryBackend_Count, "dSetMemoryTagBackend() - Invalid memory backend.");
+
+   // Existing allocations are unaffected as each records how it was allocated.
+   sTagBackends[tag] = backend;
+}
+
+//-----------------------------------------------------------------------------
+
+MemoryBackend dGetMemoryTagBackend(const MemoryTag tag)
+{
+   AssertFatal(tag < MemoryTag_Count, "dGetMemoryTagBackend() - Invalid memory tag.");
+   return sTagBackends[tag];
+}
+
+//-----------------------------------------------------------------------------
+
+void dSetMemorySiteTracking(const bool enabled)
+{
+   sSiteTracking = enabled;
+}
+
+//-----------------------------------------------------------------------------
+
+bool dGetMemorySiteTracking()
+{
+   return sSiteTracking;
+}
+
+//-----------------------------------------------------------------------------
+
+void dDumpMemoryTags()
+{
+   Con::printf("Memory Tags:");
+   Con::printf("%-8s %-5s %12s %12s %10s %12s", "Tag", "Type", "Live Bytes", "Peak Bytes", "Live #", "Allocs #");
+
+   for (U32 tag = 0; tag < MemoryTag_Count; ++tag)
+   {
+      MemoryTagStats stats;
+      dGetMemoryTagStats((MemoryTag)tag, stats);
+
+      Con::printf("%-8s %-5s %12u %12u %10u %12u",
+         sMemoryTagNames[tag],
+         sMemoryBackendNames[sTagBackends[tag]],
+         stats.mLiveBytes,
+         stats.mPeakBytes,
+         stats.mLiveCount,
+         stats.mAllocationCount);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareSiteLiveBytes(const void* a, const void* b)
+{
+   const U32 bytesA = ((const MemorySite*)a)->mLiveBytes;
+   const U32 bytesB = ((const MemorySite*)b)->mLiveBytes;
+   return bytesA < bytesB ? 1 : bytesA > bytesB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareSiteAllocationCount(const void* a, const void* b)
+{
+   const U32 countA = ((const MemorySite*)a)->mAllocationCount;
+   const U32 countB = ((const MemorySite*)b)->mAllocationCount;
+   return countA < countB ? 1 : countA > countB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void dDumpMemorySites(const U32 siteCount)
+{
+   if (!sSiteTracking && sSiteCount == 0)
+   {
+      Con::warnf("dDumpMemorySites() - Memory site tracking is not enabled.");
+      return;
+   }
+
+   // Take a copy of the sites.
+   // The system heap is used so as not to disturb the statistics being reported.
+   MemorySite* pSites = (MemorySite*)malloc(sizeof(sSites));
+   U32 usedSiteCount = 0;
+   while (!dAtomicCompareExchange(sSiteLock, 0, 1)) {}
+   for (U32 siteIndex = 1; siteIndex < MEMORY_SITE_TABLE_SIZE; ++siteIndex)
+   {
+      if (sSites[siteIndex].mFileName != NULL)
+         pSites[usedSiteCount++] = sSites[siteIndex];
+   }
+   dAtomicStoreRelease(sSiteLock, 0);
+
+   const U32 reportCount = getMin(siteCount, usedSiteCount);
+
+   // Report the sites by live bytes.
+   dQsort(pSites, usedSiteCount, sizeof(MemorySite), compareSiteLiveBytes);
+   Con::printf("Memory Sites by live bytes:");
+   Con::printf("%12s %10s %12s  %s", "Live Bytes", "Live #", "Allocs #", "Site");
+   for (U32 index = 0; index < reportCount; ++index)
+   {
+      const MemorySite& site = pSites[index];
+      Con::printf("%12u %10u %12u  %s(%u)", site.mLiveBytes, site.mLiveCount, site.mAllocationCount, site.mFileName, site.mLine);
+   }
+
+   // Report the sites by allocation count.
+   dQsort(pSites, usedSiteCount, sizeof(MemorySite), compareSiteAllocationCount);
+   Con::printf("Memory Sites by allocation count:");
+   Con::printf("%12s %10s %12s  %s", "Live Bytes", "Live #", "Allocs #", "Site");
+   for (U32 index = 0; index < reportCount; ++index)
+   {
+      const MemorySite& site = pSites[index];
+      Con::printf("%12u %10u %12u  %s(%u)", site.mLiveBytes, site.mLiveCount, site.mAllocationCount, site.mFileName, site.mLine);
+   }
+
+   free(pSites);
 }
@@ -69,6 +69,7 @@ extern void* dMalloc_r(dsize_t in_size, const char*, const dsize_t);
 extern void  dFree(void* in_pFree);
 extern void* dRealloc_r(void* in_pResize, dsize_t in_size, const char*, const dsize_t);
 extern void* dRealMalloc(dsize_t);
+extern U32   dGetAllocationCount();
 extern void  dRealFree(void*);
 
 extern void* dMemcpy(void *dst, const void *src, dsize_t size);
@@ -76,4 +77,78 @@ extern void* dMemmove(void *dst, const void *src, dsize_t size);
 extern void* dMemset(void *dst, int c, dsize_t size);
 extern int   dMemcmp(const void *ptr1, const void *ptr2, dsize_t size);
 
+//------------------------------------------------------------------------------
+
+/// Memory tags identify the subsystem that owns each engine heap allocation.
+/// The current tag is per-thread and is normally set with a MemoryTagScope.
+enum MemoryTag
+{
+   MemoryTag_General,
+   MemoryTag_Scene,
+   MemoryTag_Render,
+   MemoryTag_Script,
+   MemoryTag_Assets,
+   MemoryTag_Taml,
+   MemoryTag_Network,
+   MemoryTag_Audio,
+   MemoryTag_GUI,
+
+   MemoryTag_Count
+};
+
+/// The backend used to satisfy allocations made under a memory tag.
+enum MemoryBackend
+{
+   MemoryBackend_Heap,     ///< Allocations go straight to the system heap.
+   MemoryBackend_Pool,     ///< Small allocations are recycled through per-thread pools.
+
+   MemoryBackend_Count
+};
+
+/// Memory tag statistics.
+struct MemoryTagStats
+{
+   U32 mLiveBytes;
+   U32 mPeakBytes;
+   U32 mLiveCount;
+   U32 mAllocationCount;
+};
+
+extern MemoryTag     dGetMemoryTag();
+extern MemoryTag     dSetMemoryTag(const MemoryTag tag);
+extern const char*   dGetMemoryTagName(const MemoryTag tag);
+extern MemoryTag     dGetMemoryTagEnum(const char* pTagName);
+extern void          dGetMemoryTagStats(const MemoryTag tag, MemoryTagStats& stats);
+extern void          dResetMemoryTagPeak(const MemoryTag tag);
+extern void          dSetMemoryTagBackend(const MemoryTag tag, const MemoryBackend backend);
+extern MemoryBackend dGetMemoryTagBackend(const MemoryTag tag);
+extern void          dSetMemorySiteTracking(const bool enabled);
+extern bool          dGetMemorySiteTracking();
+extern void          dDumpMemoryTags();
+extern void          dDumpMemorySites(const U32 siteCount);
+
+/// Returns the calling thread's pooled blocks and memory state to the heap.
+/// Threads call this as they exit; any later allocation on the thread starts with a fresh state.
+extern void          dReleaseThreadMemory();
+
+//------------------------------------------------------------------------------
+
+/// Sets the current thread's memory tag for the lifetime of the scope.
+class MemoryTagScope
+{
+   MemoryTag mPreviousTag;
+
+public:
+   MemoryTagScope(const MemoryTag tag) { mPreviousTag = dSetMemoryTag(tag); }
+   ~MemoryTagScope()                   { dSetMemoryTag(mPreviousTag); }
+};
+
+/// Use the following macro in a class declaration to allocate its instances
+/// from the engine heap under the specified memory tag.
+#define DECLARE_MEMORY_TAGGED_NEW(tag) \
+   static void* operator new(size_t size)           { MemoryTagScope memoryTagScope(tag); return dMalloc_r((dsize_t)size, __FILE__, __LINE__); } \
+   static void* operator new(size_t, void* ptr)     { return ptr; } \
+   static void  operator delete(void* ptr)          { dFree(ptr); } \
+   static void  operator delete(void*, void*)       { }
+
 #endif // _PLATFORM_MEMORY_H_
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup MemoryFunctions Memory
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets the statistics for a memory tag.
+    @param tag The memory tag i.e. General, Scene, Render, Script, Assets, Taml, Network, Audio or GUI.
+    @return The live bytes, peak bytes, live allocation count and total allocation count separated by spaces.
+*/
+ConsoleFunctionWithDocs( getMemoryTagStats, ConsoleString, 2, 2, (tag) )
+{
+    // Fetch the memory tag.
+    const MemoryTag tag = dGetMemoryTagEnum( argv[1] );
+
+    if ( tag == MemoryTag_Count )
+    {
+        Con::warnf( "getMemoryTagStats() - Invalid memory tag '%s'.", argv[1] );
+        return StringTable->EmptyString;
+    }
+
+    MemoryTagStats stats;
+    dGetMemoryTagStats( tag, stats );
+
+    char* pBuffer = Con::getReturnBuffer( 64 );
+    dSprintf( pBuffer, 64, "%u %u %u %u", stats.mLiveBytes, stats.mPeakBytes, stats.mLiveCount, stats.mAllocationCount );
+    return pBuffer;
+}
+
+/*! Sets the backend used for new allocations made under a memory tag.
+    @param tag The memory tag.
+    @param backend Either "Heap" or "Pool".
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setMemoryTagBackend, ConsoleVoid, 3, 3, (tag, backend) )
+{
+    // Fetch the memory tag.
+    const MemoryTag tag = dGetMemoryTagEnum( argv[1] );
+
+    if ( tag == MemoryTag_Count )
+    {
+        Con::warnf( "setMemoryTagBackend() - Invalid memory tag '%s'.", argv[1] );
+        return;
+    }
+
+    // Fetch the backend.
+    if ( dStricmp( argv[2], "Heap" ) == 0 )
+    {
+        dSetMemoryTagBackend( tag, MemoryBackend_Heap );
+    }
+    else if ( dStricmp( argv[2], "Pool" ) == 0 )
+    {
+        dSetMemoryTagBackend( tag, MemoryBackend_Pool );
+    }
+    else
+    {
+        Con::warnf( "setMemoryTagBackend() - Invalid memory backend '%s'.", argv[2] );
+    }
+}
+
+/*! Gets the backend used for new allocations made under a memory tag.
+    @param tag The memory tag.
+    @return Either "Heap" or "Pool".
+*/
+ConsoleFunctionWithDocs( getMemoryTagBackend, ConsoleString, 2, 2, (tag) )
+{
+    // Fetch the memory tag.
+    const MemoryTag tag = dGetMemoryTagEnum( argv[1] );
+
+    if ( tag == MemoryTag_Count )
+    {
+        Con::warnf( "getMemoryTagBackend() - Invalid memory tag '%s'.", argv[1] );
+        return StringTable->EmptyString;
+    }
+
+    return dGetMemoryTagBackend( tag ) == MemoryBackend_Pool ? "Pool" : "Heap";
+}
+
+/*! Sets whether allocations are tracked by the file and line that made them.
+    Tracking sites is slower so it is off by default.
+    @param enabled Whether to track allocation sites.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setMemorySiteTracking, ConsoleVoid, 2, 2, (enabled) )
+{
+    dSetMemorySiteTracking( dAtob(argv[1]) );
+}
+
+/*! Dumps the statistics for all the memory tags to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpMemoryTags, ConsoleVoid, 1, 1, () )
+{
+    dDumpMemoryTags();
+}
+
+/*! Dumps the top allocation sites by live bytes and by allocation count to the console.
+    Requires site tracking to have been enabled with setMemorySiteTracking().
+    @param count The number of sites to dump.  Defaults to 20.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpMemorySites, ConsoleVoid, 1, 2, ([count]) )
+{
+    dDumpMemorySites( argc > 1 ? (U32)getMax( dAtoi(argv[1]), 1 ) : 20 );
+}
+
+/*! @} */ // group MemoryFunctions
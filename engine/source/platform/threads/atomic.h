@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#define _PLATFORM_THREADS_ATOMIC_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// Minimal atomic operations on 32-bit values shared between threads.
+//
+// A load with acquire semantics guarantees that no later reads or writes are
+// moved before it; a store with release semantics guarantees that no earlier
+// reads or writes are moved after it.  This is all that is required for
+// single-producer/single-consumer structures such as ring buffers.
+//-----------------------------------------------------------------------------
+
+#if defined(TORQUE_COMPILER_VISUALC)
+
+/// Atomically load a value with acquire semantics.
+inline U32 dAtomicLoadAcquire( volatile U32& value )
+{
+   const U32 result = value;
+   _ReadWriteBarrier();
+   return result;
+}
+
+/// Atomically store a value with release semantics.
+inline void dAtomicStoreRelease( volatile U32& value, const U32 newValue )
+{
+   _ReadWriteBarrier();
+   value = newValue;
+}
+
+/// Atomically add to a value returning the new value.
+inline U32 dAtomicAdd( volatile U32& value, const U32 delta )
+{
+   return (U32)_InterlockedExchangeAdd( (volatile long*)&value, (long)delta ) + delta;
+}
+
+/// Atomically replace a value if it matches the expected value, returning whether it was replaced.
+inline bool dAtomicCompareExchange( volatile U32& value, const U32 expectedValue, const U32 newValue )
+{
+   return (U32)_InterlockedCompareExchange( (volatile long*)&value, (long)newValue, (long)expectedValue ) == expectedValue;
+}
+
+#else
+
+/// Atomically load a value with acquire semantics.
+inline U32 dAtomicLoadAcquire( volatile U32& value )
+{
+   return __atomic_load_n( &value, __ATOMIC_ACQUIRE );
+}
+
+/// Atomically store a value with release semantics.
+inline void dAtomicStoreRelease( volatile U32& value, const U32 newValue )
+{
+   __atomic_store_n( &value, newValue, __ATOMIC_RELEASE );
+}
+
+/// Atomically add to a value returning the new value.
+inline U32 dAtomicAdd( volatile U32& value, const U32 delta )
+{
+   return __atomic_add_fetch( &value, delta, __ATOMIC_SEQ_CST );
+}
+
+/// Atomically replace a value if it matches the expected value, returning whether it was replaced.
+inline bool dAtomicCompareExchange( volatile U32& value, const U32 expectedValue, const U32 newValue )
+{
+   U32 expected = expectedValue;
+   return __atomic_compare_exchange_n( &value, &expected, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST );
+}
+
+#endif
+
+#endif // _PLATFORM_THREADS_ATOMIC_H_
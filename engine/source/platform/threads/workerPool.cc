@@ -0,0 +1,221 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/workerPool.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/semaphore.h"
+#include "console/console.h"
+#include "console/consoleTypes.h"
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_OS_EMSCRIPTEN
+static S32 sgWorkerPoolThreadCount = 0;
+#else
+static S32 sgWorkerPoolThreadCount = 3;
+#endif
+
+static const S32 MaxWorkerThreads = 32;
+
+static Vector<Thread*> sgWorkerThreads;
+static Mutex* sgWorkerMutex = NULL;
+static Semaphore* sgWorkerWakeSemaphore = NULL;
+static Semaphore* sgWorkerDoneSemaphore = NULL;
+static bool sgWorkerPoolStarted = false;
+static bool sgWorkerPoolStopping = false;
+static bool sgWorkerPoolBusy = false;
+
+static WorkerPool::WorkFunction sgWorkFunction = NULL;
+static void* sgWorkContext = NULL;
+static U32 sgWorkCount = 0;
+static U32 sgWorkNextIndex = 0;
+
+//-----------------------------------------------------------------------------
+
+static void processWorkItems( void )
+{
+   while( true )
+   {
+      // Claim the next item.
+      sgWorkerMutex->lock();
+      if ( sgWorkNextIndex >= sgWorkCount )
+      {
+         sgWorkerMutex->unlock();
+         return;
+      }
+      const U32 index = sgWorkNextIndex++;
+      sgWorkerMutex->unlock();
+
+      sgWorkFunction( sgWorkContext, index );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+static void workerThreadFunction( void* )
+{
+   while( true )
+   {
+      // Wait for work.
+      sgWorkerWakeSemaphore->acquire();
+
+      // Finish if stopping.
+      if ( sgWorkerPoolStopping )
+         return;
+
+      processWorkItems();
+
+      // Signal that this worker is done with the batch.
+      sgWorkerDoneSemaphore->release();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+static void startWorkerThreads( void )
+{
+   sgWorkerPoolStarted = true;
+
+   // Clamp the thread count.
+   const S32 threadCount = getMax( 0, getMin( sgWorkerPoolThreadCount, MaxWorkerThreads ) );
+
+   // Finish if no threads are wanted.
+   if ( threadCount == 0 )
+      return;
+
+   sgWorkerMutex = new Mutex();
+   sgWorkerWakeSemaphore = new Semaphore( 0 );
+   sgWorkerDoneSemaphore = new Semaphore( 0 );
+
+   for ( S32 index = 0; index < threadCount; ++index )
+      sgWorkerThreads.push_back( new Thread( workerThreadFunction, NULL, true ) );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorkerPool::init( void )
+{
+   Con::addVariable( "pref::WorkerPool::ThreadCount", TypeS32, &sgWorkerPoolThreadCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorkerPool::shutdown( void )
+{
+   // Finish if never started.
+   if ( !sgWorkerPoolStarted )
+      return;
+
+   // Wake all the threads so they can stop.
+   sgWorkerPoolStopping = true;
+   for ( S32 index = 0; index < sgWorkerThreads.size(); ++index )
+      sgWorkerWakeSemaphore->release();
+
+   // Wait for the threads and destroy them.
+   for ( S32 index = 0; index < sgWorkerThreads.size(); ++index )
+   {
+      sgWorkerThreads[index]->join();
+      delete sgWorkerThreads[index];
+   }
+   sgWorkerThreads.clear();
+
+   delete sgWorkerDoneSemaphore;
+   delete sgWorkerWakeSemaphore;
+   delete sgWorkerMutex;
+   sgWorkerDoneSemaphore = NULL;
+   sgWorkerWakeSemaphore = NULL;
+   sgWorkerMutex = NULL;
+
+   sgWorkerPoolStopping = false;
+   sgWorkerPoolStarted = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorkerPool::process( WorkFunction pWorkFunction, void* pContext, const U32 count )
+{
+   // Sanity!
+   AssertFatal( pWorkFunction != NULL, "WorkerPool::process() - Cannot process with a NULL work function." );
+
+   // Start the worker threads if needed.
+   if ( !sgWorkerPoolStarted )
+      startWorkerThreads();
+
+   // Is the pool available?
+   bool useWorkers = sgWorkerThreads.size() > 0 && count > 1;
+   if ( useWorkers )
+   {
+      sgWorkerMutex->lock();
+      useWorkers = !sgWorkerPoolBusy;
+      sgWorkerPoolBusy = true;
+      sgWorkerMutex->unlock();
+   }
+
+   // No, so process serially.
+   if ( !useWorkers )
+   {
+      for ( U32 index = 0; index < count; ++index )
+         pWorkFunction( pContext, index );
+
+      return;
+   }
+
+   // Set the batch.
+   sgWorkerMutex->lock();
+   sgWorkFunction = pWorkFunction;
+   sgWorkContext = pContext;
+   sgWorkCount = count;
+   sgWorkNextIndex = 0;
+   sgWorkerMutex->unlock();
+
+   // Wake only as many workers as there are items left for them.
+   const U32 wakeCount = getMin( (U32)sgWorkerThreads.size(), count - 1 );
+   for ( U32 index = 0; index < wakeCount; ++index )
+      sgWorkerWakeSemaphore->release();
+
+   // Participate in the work.
+   processWorkItems();
+
+   // Wait for the woken workers to finish.
+   for ( U32 index = 0; index < wakeCount; ++index )
+      sgWorkerDoneSemaphore->acquire();
+
+   // Release the pool.
+   sgWorkerMutex->lock();
+   sgWorkFunction = NULL;
+   sgWorkContext = NULL;
+   sgWorkCount = 0;
+   sgWorkNextIndex = 0;
+   sgWorkerPoolBusy = false;
+   sgWorkerMutex->unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorkerPool::getThreadCount( void )
+{
+   // Start the worker threads if needed.
+   if ( !sgWorkerPoolStarted )
+      startWorkerThreads();
+
+   return (U32)sgWorkerThreads.size();
+}
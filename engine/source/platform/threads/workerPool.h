@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_WORKERPOOL_H_
+#define _PLATFORM_THREADS_WORKERPOOL_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A small pool of worker threads used to split independent work items across cores.
+///
+/// Work is submitted as a function and an item count; the function is called once for each
+/// item index with the supplied context.  The calling thread participates in the work and
+/// process() only returns once every item has been completed, so the context can safely live
+/// on the caller's stack.  The work function must not touch the console, the Sim or anything
+/// else that is not thread-safe.
+///
+/// The worker threads are created on first use so that "$pref::WorkerPool::ThreadCount" can
+/// be set by script before then.  With no worker threads (or when called re-entrantly) the
+/// items are simply processed serially on the calling thread.
+class WorkerPool
+{
+public:
+   typedef void (*WorkFunction)( void* pContext, const U32 index );
+
+   /// Register the console preferences.
+   static void init( void );
+
+   /// Stop and destroy all the worker threads.
+   static void shutdown( void );
+
+   /// Process the items [0, count) with the work function, blocking until all are complete.
+   static void process( WorkFunction pWorkFunction, void* pContext, const U32 count );
+
+   /// Fetch the number of worker threads (excluding the calling thread).
+   static U32 getThreadCount( void );
+};
+
+#endif // _PLATFORM_THREADS_WORKERPOOL_H_
@@ -59,6 +59,8 @@ static void *ThreadRunHandler(void * arg)
       ThreadManager::removeThread(thread);
       delete thread;
    }
+   // return this thread's memory pools to the heap.
+   dReleaseThreadMemory();
    // return value for pthread lib's benefit
    return NULL;
    // the end of this function is where the created pthread will die.
@@ -28,6 +28,7 @@
 #import "platform/platformSemaphore.h"
 #import "platform/threads/mutex.h"
 #import "console/console.h"
+#import "platform/platformTLS.h"
 
 //-----------------------------------------------------------------------------
 
@@ -74,6 +75,9 @@ static void *ThreadRunHandler( void* arg )
         delete thread;
     }
     
+    // Return this thread's memory pools to the heap.
+    dReleaseThreadMemory();
+    
     // This is for pthread.
     return NULL;
 }
@@ -165,6 +169,47 @@ ThreadIdent Thread::getId()
    return mData->mThreadID;
 }
 
+#pragma mark ---- ThreadStorage Class Methods ----
+
+//-----------------------------------------------------------------------------
+
+class PlatformThreadStorage
+{
+public:
+   pthread_key_t mThreadKey;
+};
+
+//-----------------------------------------------------------------------------
+
+ThreadStorage::ThreadStorage()
+{
+   mThreadStorage = (PlatformThreadStorage *) mStorage;
+   constructInPlace(mThreadStorage);
+
+   pthread_key_create(&mThreadStorage->mThreadKey, NULL);
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadStorage::~ThreadStorage()
+{
+   pthread_key_delete(mThreadStorage->mThreadKey);
+}
+
+//-----------------------------------------------------------------------------
+
+void *ThreadStorage::get()
+{
+   return pthread_getspecific(mThreadStorage->mThreadKey);
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadStorage::set(void *value)
+{
+   pthread_setspecific(mThreadStorage->mThreadKey, value);
+}
+
 #pragma mark ---- ThreadManager Class Methods ----
 
 //-----------------------------------------------------------------------------
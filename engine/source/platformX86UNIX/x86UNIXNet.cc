@@ -24,6 +24,7 @@
 #include "platform/platform.h"
 #include "platform/event.h"
 #include "platform/platformNetAsync.unix.h"
+#include "platformX86UNIX/x86UNIXNetPacketRing.h"
 
 #include <unistd.h>
 #include <sys/types.h>
@@ -39,6 +40,7 @@
 #include <net/if_ppp.h>
 #include <sys/ioctl.h>   /* ioctl() */
 #include <net/ppp_defs.h>
+#include <sys/epoll.h>
 #elif defined(__OpenBSD__) || defined(__FreeBSD__)
 #include <sys/ioctl.h>   /* ioctl() */
 #include <net/ppp_defs.h>
@@ -89,17 +91,84 @@ struct Socket
 // list of polled sockets
 static Vector<Socket*> gPolledSockets;
 
+// the pool that datagrams are received into
+static NetPacketRing gPacketRing;
+
+#if defined(__linux__)
+// on linux the polled sockets are registered with epoll so that only
+// sockets with something to do are visited.  sockets waiting on a name
+// lookup have no descriptor activity so they are counted and scanned.
+static int gPollDescriptor = -1;
+static S32 gNameLookupSocketCount = 0;
+
+enum {
+   MaxPollEvents = 64,
+};
+
+static void updatePolledSocket(Socket* sock, S32 oldState)
+{
+   if (gPollDescriptor == -1)
+      return;
+
+   // fetch the events the socket states are interested in.  name lookups
+   // are not registered as an unconnected socket reports a hang-up.
+   U32 oldEvents = 0;
+   U32 newEvents = 0;
+   if (oldState == ConnectionPending)
+      oldEvents = EPOLLOUT;
+   else if (oldState == Connected || oldState == Listening)
+      oldEvents = EPOLLIN;
+   if (sock->state == ConnectionPending)
+      newEvents = EPOLLOUT;
+   else if (sock->state == Connected || sock->state == Listening)
+      newEvents = EPOLLIN;
+
+   if (oldState == NameLookupRequired)
+      gNameLookupSocketCount--;
+   if (sock->state == NameLookupRequired)
+      gNameLookupSocketCount++;
+
+   if (oldEvents == newEvents)
+      return;
+
+   epoll_event event;
+   dMemset(&event, 0, sizeof(event));
+   event.events = newEvents;
+   event.data.ptr = sock;
+
+   int op = EPOLL_CTL_MOD;
+   if (oldEvents == 0)
+      op = EPOLL_CTL_ADD;
+   else if (newEvents == 0)
+      op = EPOLL_CTL_DEL;
+
+   if (epoll_ctl(gPollDescriptor, op, sock->fd, &event) == -1)
+      Con::errorf("Error updating polled socket %d: %s", sock->fd, strerror(errno));
+}
+#else
+static void updatePolledSocket(Socket* sock, S32 oldState)
+{
+}
+#endif
+
+static void setPolledSocketState(Socket* sock, S32 state)
+{
+   S32 oldState = sock->state;
+   sock->state = state;
+   updatePolledSocket(sock, oldState);
+}
+
 static Socket* addPolledSocket(NetSocket& fd, S32 state,
                                char* remoteAddr = NULL, S32 port = -1)
 {
    Socket* sock = new Socket();
    sock->fd = fd;
-   sock->state = state;
    if (remoteAddr)
       dStrcpy(sock->remoteAddr, remoteAddr);
    if (port != -1)
       sock->remotePort = port;
    gPolledSockets.push_back(sock);
+   setPolledSocketState(sock, state);
    return sock;
 }
 
@@ -124,6 +193,11 @@ S32 Poll(NetSocket fd, S32 eventMask, S32 timeoutMs)
 
 bool Net::init()
 {
+#if defined(__linux__)
+   gPollDescriptor = epoll_create(MaxConnections);
+   if (gPollDescriptor == -1)
+      Con::warnf("Unable to create epoll descriptor, falling back to scanning sockets: %s", strerror(errno));
+#endif
    NetAsync::startAsync();
    return(true);
 }
@@ -135,6 +209,13 @@ void Net::shutdown()
    
    closePort();
    NetAsync::stopAsync();
+#if defined(__linux__)
+   if (gPollDescriptor != -1)
+   {
+      close(gPollDescriptor);
+      gPollDescriptor = -1;
+   }
+#endif
 }
 
 static void netToIPSocketAddress(const NetAddress *address, struct sockaddr_in *sockAddr)
@@ -319,6 +400,7 @@ void Net::closeConnectTo(NetSocket sock)
    for (int i = 0; i < gPolledSockets.size(); ++i)
       if (gPolledSockets[i]->fd == sock)
       {
+         setPolledSocketState(gPolledSockets[i], InvalidState);
          delete gPolledSockets[i];
          gPolledSockets.erase(i);
          break;
@@ -443,211 +525,268 @@ Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSi
    }
 }
 
-void Net::process()
+// dispatch a packet received by receivePackets().  the packet payload was
+// received straight into a PacketReceiveEvent slot of gPacketRing so only the
+// source address needs converting.  packets looped back from our own port or
+// without a payload are dropped.
+static void dispatchPacket(PacketReceiveEvent& receiveEvent, const sockaddr* sa)
 {
-   sockaddr sa;
+   if(sa->sa_family == AF_INET)
+      IPSocketToNetAddress((const sockaddr_in *) sa, &receiveEvent.sourceAddress);
+   else if(sa->sa_family == AF_IPX)
+      IPXSocketToNetAddress((const sockaddr_ipx *) sa, &receiveEvent.sourceAddress);
+   else
+      return;
+
+   NetAddress &na = receiveEvent.sourceAddress;
+   if(na.type == NetAddress::IPAddress &&
+      na.netNum[0] == 127 &&
+      na.netNum[1] == 0 &&
+      na.netNum[2] == 0 &&
+      na.netNum[3] == 1 &&
+      na.port == netPort)
+      return;
+   if(receiveEvent.size <= PacketReceiveEventHeaderSize)
+      return;
 
-   PacketReceiveEvent receiveEvent;
-   for(;;)
+#ifdef	TORQUE_ALLOW_JOURNALING
+   // when journaling the packet has to go through postEvent() so that it is
+   // recorded, or suppressed during playback.  postEvent() copies the event
+   // so the ring slot can be reused by the next batch.
+   if(Game->isJournalWriting() || Game->isJournalReading())
    {
-      U32 addrLen = sizeof(sa);
-      S32 bytesRead = -1;
-      if(udpSocket != InvalidSocket)
-         bytesRead = recvfrom(udpSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
-      if(bytesRead == -1 && ipxSocket != InvalidSocket)
-      {
-         addrLen = sizeof(sa);
-         bytesRead = recvfrom(ipxSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
-      }
-      
-      if(bytesRead == -1)
-         break;
-      
-      if(sa.sa_family == AF_INET)
-         IPSocketToNetAddress((sockaddr_in *) &sa, &receiveEvent.sourceAddress);
-      else if(sa.sa_family == AF_IPX)
-         IPXSocketToNetAddress((sockaddr_ipx *) &sa, &receiveEvent.sourceAddress);
-      else
-         continue;
-         
-      NetAddress &na = receiveEvent.sourceAddress;
-      if(na.type == NetAddress::IPAddress &&
-         na.netNum[0] == 127 &&
-         na.netNum[1] == 0 &&
-         na.netNum[2] == 0 &&
-         na.netNum[3] == 1 &&
-         na.port == netPort)
-         continue;
-      if(bytesRead <= 0)
-         continue;
-      receiveEvent.size = PacketReceiveEventHeaderSize + bytesRead;
       Game->postEvent(receiveEvent);
+      return;
    }
+#endif	//TORQUE_ALLOW_JOURNALING
 
-   // process the polled sockets.  This blob of code performs functions
-   // similar to WinsockProc in winNet.cc
+   // otherwise process the packet in place.  Net::process() runs on the main
+   // thread just before the posted events are processed so this keeps the
+   // same ordering without copying the packet into the event queue.
+   Game->processEvent(&receiveEvent);
+}
 
-   if (gPolledSockets.size() == 0)
+static void receivePackets(int socket)
+{
+   if(socket == InvalidSocket)
       return;
 
-   static ConnectedNotifyEvent notifyEvent;
-   static ConnectedAcceptEvent acceptEvent;
-   static ConnectedReceiveEvent cReceiveEvent;
+   // drain the socket a batch at a time.  each NetPacketRing::receive() is a
+   // single recvmmsg() call on Linux (recvfrom() per packet elsewhere) and a
+   // full batch means more packets may be pending.
+   U32 count;
+   do
+   {
+      count = gPacketRing.receive(socket);
+      for(U32 i = 0; i < count; ++i)
+         dispatchPacket(gPacketRing.getPacket(i), gPacketRing.getPacketAddress(i));
+   }
+   while(count == NetPacketRing::BatchSize);
+}
+
+static ConnectedNotifyEvent notifyEvent;
+static ConnectedAcceptEvent acceptEvent;
+static ConnectedReceiveEvent cReceiveEvent;
 
+// process a polled socket.  This blob of code performs functions
+// similar to WinsockProc in winNet.cc.  returns true if the socket
+// should be removed.
+static bool processPolledSocket(Socket* currentSock)
+{
    S32 optval;
    socklen_t optlen = sizeof(S32);
    S32 bytesRead;
    Net::Error err;
    bool removeSock = false;
-   Socket *currentSock = NULL;
    sockaddr_in ipAddr;
    NetSocket incoming = InvalidSocket;
    char out_h_addr[1024];
    int out_h_length = 0;
 
-   for (S32 i = 0; i < gPolledSockets.size(); 
-        /* no increment, this is done at end of loop body */)
+   switch (currentSock->state)
    {
-      removeSock = false;
-      currentSock = gPolledSockets[i];
-      switch (currentSock->state)
-      {
-         case InvalidState:
-            Con::errorf("Error, InvalidState socket in polled sockets list");
-            break;
-         case ConnectionPending:
-            notifyEvent.tag = currentSock->fd;
-            // see if it is now connected
-            if (getsockopt(currentSock->fd, SOL_SOCKET, SO_ERROR, 
-                           &optval, &optlen) == -1)
+      case InvalidState:
+         Con::errorf("Error, InvalidState socket in polled sockets list");
+         break;
+      case ConnectionPending:
+         notifyEvent.tag = currentSock->fd;
+         // see if it is now connected
+         if (getsockopt(currentSock->fd, SOL_SOCKET, SO_ERROR, 
+                        &optval, &optlen) == -1)
+         {
+            Con::errorf("Error getting socket options: %s", strerror(errno));
+            notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+            Game->postEvent(notifyEvent);
+            removeSock = true;
+         }
+         else
+         {
+            if (optval == EINPROGRESS)
+               // still connecting...
+               break;
+
+            if (optval == 0)
             {
-               Con::errorf("Error getting socket options: %s", strerror(errno));
-               notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+               // connected
+               notifyEvent.state = ConnectedNotifyEvent::Connected;
                Game->postEvent(notifyEvent);
-               removeSock = true;
+               setPolledSocketState(currentSock, Connected);
             }
             else
             {
-               if (optval == EINPROGRESS)
-                  // still connecting...
-                  break;
-
-               if (optval == 0)
-               {
-                  // connected
-                  notifyEvent.state = ConnectedNotifyEvent::Connected;
-                  Game->postEvent(notifyEvent);
-                  currentSock->state = Connected;
-               }
-               else
-               {
-                  // some kind of error
-                  Con::errorf("Error connecting: %s", strerror(errno));
-                  notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-                  Game->postEvent(notifyEvent);
-                  removeSock = true;
-               }
+               // some kind of error
+               Con::errorf("Error connecting: %s", strerror(errno));
+               notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+               Game->postEvent(notifyEvent);
+               removeSock = true;
             }
-            break;
-         case Connected:
-            bytesRead = 0;
-            // try to get some data
-            err = Net::recv(currentSock->fd, cReceiveEvent.data, 
-                            MaxPacketDataSize, &bytesRead);
-            if(err == Net::NoError)
+         }
+         break;
+      case Connected:
+         bytesRead = 0;
+         // try to get some data
+         err = Net::recv(currentSock->fd, cReceiveEvent.data, 
+                         MaxPacketDataSize, &bytesRead);
+         if(err == Net::NoError)
+         {
+            if (bytesRead > 0)
             {
-               if (bytesRead > 0)
-               {
-                  // got some data, post it
-                  cReceiveEvent.tag = currentSock->fd;
-                  cReceiveEvent.size = ConnectedReceiveEventHeaderSize + 
-                     bytesRead;
-                  Game->postEvent(cReceiveEvent);
-               }
-               else 
-               {
-                  // zero bytes read means EOF
-                  if (bytesRead < 0)
-                     // ack! this shouldn't happen
-                     Con::errorf("Unexpected error on socket: %s", 
-                                 strerror(errno));
-
-                  notifyEvent.tag = currentSock->fd;
-                  notifyEvent.state = ConnectedNotifyEvent::Disconnected;
-                  Game->postEvent(notifyEvent);
-                  removeSock = true;
-               }
+               // got some data, post it
+               cReceiveEvent.tag = currentSock->fd;
+               cReceiveEvent.size = ConnectedReceiveEventHeaderSize + 
+                  bytesRead;
+               Game->postEvent(cReceiveEvent);
             }
-            else if (err != Net::NoError && err != Net::WouldBlock)
+            else 
             {
-               Con::errorf("Error reading from socket: %s", strerror(errno));
+               // zero bytes read means EOF
+               if (bytesRead < 0)
+                  // ack! this shouldn't happen
+                  Con::errorf("Unexpected error on socket: %s", 
+                              strerror(errno));
+
                notifyEvent.tag = currentSock->fd;
                notifyEvent.state = ConnectedNotifyEvent::Disconnected;
                Game->postEvent(notifyEvent);
                removeSock = true;
             }
-            break;
-         case NameLookupRequired:
-            // is the lookup complete?
-            if (!gNetAsync.checkLookup(
-                   currentSock->fd, out_h_addr, &out_h_length, 
-                   sizeof(out_h_addr)))
-               break;
-            
+         }
+         else if (err != Net::NoError && err != Net::WouldBlock)
+         {
+            Con::errorf("Error reading from socket: %s", strerror(errno));
             notifyEvent.tag = currentSock->fd;
-            if (out_h_length == -1)
-            {
-               Con::errorf("DNS lookup failed: %s", currentSock->remoteAddr);
-               notifyEvent.state = ConnectedNotifyEvent::DNSFailed;
-               removeSock = true;
-            }
-            else
+            notifyEvent.state = ConnectedNotifyEvent::Disconnected;
+            Game->postEvent(notifyEvent);
+            removeSock = true;
+         }
+         break;
+      case NameLookupRequired:
+         // is the lookup complete?
+         if (!gNetAsync.checkLookup(
+                currentSock->fd, out_h_addr, &out_h_length, 
+                sizeof(out_h_addr)))
+            break;
+         
+         notifyEvent.tag = currentSock->fd;
+         if (out_h_length == -1)
+         {
+            Con::errorf("DNS lookup failed: %s", currentSock->remoteAddr);
+            notifyEvent.state = ConnectedNotifyEvent::DNSFailed;
+            removeSock = true;
+         }
+         else
+         {
+            // try to connect
+            dMemcpy(&(ipAddr.sin_addr.s_addr), out_h_addr, out_h_length);
+            ipAddr.sin_port = currentSock->remotePort;
+            ipAddr.sin_family = AF_INET;
+            if(::connect(currentSock->fd, (struct sockaddr *)&ipAddr, 
+                         sizeof(ipAddr)) == -1)
             {
-               // try to connect
-               dMemcpy(&(ipAddr.sin_addr.s_addr), out_h_addr, out_h_length);
-               ipAddr.sin_port = currentSock->remotePort;
-               ipAddr.sin_family = AF_INET;
-               if(::connect(currentSock->fd, (struct sockaddr *)&ipAddr, 
-                            sizeof(ipAddr)) == -1)
+               if (errno == EINPROGRESS)
                {
-                  if (errno == EINPROGRESS)
-                  {
-                     notifyEvent.state = ConnectedNotifyEvent::DNSResolved;
-                     currentSock->state = ConnectionPending;
-                  }
-                  else
-                  {
-                     Con::errorf("Error connecting to %s: %s", 
-                                 currentSock->remoteAddr, strerror(errno));
-                     notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-                     removeSock = true;
-                  }
+                  notifyEvent.state = ConnectedNotifyEvent::DNSResolved;
+                  setPolledSocketState(currentSock, ConnectionPending);
                }
                else
                {
-                  notifyEvent.state = ConnectedNotifyEvent::Connected;
-                  currentSock->state = Connected;
+                  Con::errorf("Error connecting to %s: %s", 
+                              currentSock->remoteAddr, strerror(errno));
+                  notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+                  removeSock = true;
                }
             }
-            Game->postEvent(notifyEvent);			
-            break;
-    	 case Listening:
-            incoming = 
-               Net::accept(currentSock->fd, &acceptEvent.address);
-            if(incoming != InvalidSocket)
+            else
             {
-               acceptEvent.portTag = currentSock->fd;
-               acceptEvent.connectionTag = incoming;
-               setBlocking(incoming, false);
-               addPolledSocket(incoming, Connected);
-               Game->postEvent(acceptEvent);
+               notifyEvent.state = ConnectedNotifyEvent::Connected;
+               setPolledSocketState(currentSock, Connected);
             }
-            break;
+         }
+         Game->postEvent(notifyEvent);			
+         break;
+ 	 case Listening:
+         incoming = 
+            Net::accept(currentSock->fd, &acceptEvent.address);
+         if(incoming != InvalidSocket)
+         {
+            acceptEvent.portTag = currentSock->fd;
+            acceptEvent.connectionTag = incoming;
+            Net::setBlocking(incoming, false);
+            addPolledSocket(incoming, Connected);
+            Game->postEvent(acceptEvent);
+         }
+         break;
+   }
+
+   return removeSock;
+}
+
+void Net::process()
+{
+   receivePackets(udpSocket);
+   receivePackets(ipxSocket);
+
+   if (gPolledSockets.size() == 0)
+      return;
+
+#if defined(__linux__)
+   if (gPollDescriptor != -1)
+   {
+      // visit the sockets epoll reports as ready.
+      epoll_event events[MaxPollEvents];
+      S32 count = epoll_wait(gPollDescriptor, events, MaxPollEvents, 0);
+      for (S32 i = 0; i < count; ++i)
+      {
+         Socket* currentSock = (Socket*)events[i].data.ptr;
+         if (processPolledSocket(currentSock))
+            closeConnectTo(currentSock->fd);
       }
 
+      // name lookups are not registered so scan for them.
+      if (gNameLookupSocketCount == 0)
+         return;
+
+      for (S32 i = 0; i < gPolledSockets.size(); 
+           /* no increment, this is done at end of loop body */)
+      {
+         Socket* currentSock = gPolledSockets[i];
+         if (currentSock->state == NameLookupRequired && processPolledSocket(currentSock))
+            closeConnectTo(currentSock->fd);
+         else
+            i++;
+      }
+      return;
+   }
+#endif
+
+   for (S32 i = 0; i < gPolledSockets.size(); 
+        /* no increment, this is done at end of loop body */)
+   {
+      Socket* currentSock = gPolledSockets[i];
+
       // only increment index if we're not removing the connection, since 
       // the removal will shift the indices down by one
-      if (removeSock)
+      if (processPolledSocket(currentSock))
          closeConnectTo(currentSock->fd);
       else
          i++;
@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platformX86UNIX/platformX86UNIX.h"
+#include "platformX86UNIX/x86UNIXNetPacketRing.h"
+
+#include <errno.h>
+
+NetPacketRing::NetPacketRing()
+{
+   mReceivedCount = 0;
+
+   // Point each receive vector at its event payload.
+   for (U32 i = 0; i < BatchSize; ++i)
+   {
+      mVectors[i].iov_base = mPackets[i].data;
+      mVectors[i].iov_len = MaxPacketDataSize;
+
+#if defined(__linux__)
+      dMemset(&mMessages[i], 0, sizeof(mmsghdr));
+      mMessages[i].msg_hdr.msg_name = &mAddresses[i];
+      mMessages[i].msg_hdr.msg_iov = &mVectors[i];
+      mMessages[i].msg_hdr.msg_iovlen = 1;
+#endif
+   }
+}
+
+U32 NetPacketRing::receive(S32 socket)
+{
+   U32 count = 0;
+
+#if defined(__linux__)
+   // The address lengths are overwritten by each receive.
+   for (U32 i = 0; i < BatchSize; ++i)
+      mMessages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+
+   S32 result;
+   do
+   {
+      result = recvmmsg(socket, mMessages, BatchSize, MSG_DONTWAIT, NULL);
+   }
+   while (result == -1 && errno == EINTR);
+
+   if (result <= 0)
+      return 0;
+
+   count = (U32)result;
+   for (U32 i = 0; i < count; ++i)
+      mPackets[i].size = PacketReceiveEventHeaderSize + mMessages[i].msg_len;
+#else
+   while (count < BatchSize)
+   {
+      socklen_t addressLength = sizeof(sockaddr_storage);
+      S32 bytesRead = recvfrom(socket, (char*)mPackets[count].data, MaxPacketDataSize, MSG_DONTWAIT,
+                               (sockaddr*)&mAddresses[count], &addressLength);
+      if (bytesRead == -1)
+      {
+         if (errno == EINTR)
+            continue;
+         break;
+      }
+
+      mPackets[count].size = PacketReceiveEventHeaderSize + bytesRead;
+      count++;
+   }
+#endif
+
+   mReceivedCount += count;
+   return count;
+}
@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _X86UNIXNETPACKETRING_H_
+#define _X86UNIXNETPACKETRING_H_
+
+#ifndef _EVENT_H_
+#include "platform/event.h"
+#endif
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+// A pool of packet receive events that a datagram socket is drained into.
+// Packets are received directly into the event payloads so they can be handed
+// on without being copied.  On Linux a whole batch is received with a single
+// recvmmsg() call, elsewhere it falls back to recvfrom() per packet.
+class NetPacketRing
+{
+public:
+   enum { BatchSize = 32 };
+
+   NetPacketRing();
+
+   // Receive up to BatchSize pending packets from a non-blocking socket.
+   // Returns the number of packets received.  The packets remain valid until the next receive.
+   U32 receive(S32 socket);
+
+   // Fetch a received packet.  The event size already accounts for the payload.
+   inline PacketReceiveEvent& getPacket(const U32 index) { return mPackets[index]; }
+   inline const sockaddr* getPacketAddress(const U32 index) const { return (const sockaddr*)&mAddresses[index]; }
+
+   // Fetch the number of packets received so far.
+   inline U32 getReceivedCount() const { return mReceivedCount; }
+
+private:
+   PacketReceiveEvent mPackets[BatchSize];
+   sockaddr_storage   mAddresses[BatchSize];
+   iovec              mVectors[BatchSize];
+#if defined(__linux__)
+   mmsghdr            mMessages[BatchSize];
+#endif
+   U32                mReceivedCount;
+};
+
+#endif // _X86UNIXNETPACKETRING_H_
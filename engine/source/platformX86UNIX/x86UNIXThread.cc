@@ -24,6 +24,7 @@
 #include "platform/threads/thread.h"
 #include "platformX86UNIX/platformX86UNIX.h"
 #include "platform/platformSemaphore.h"
+#include "platform/platformTLS.h"
 
 //--------------------------------------------------------------------------
 struct PlatformThreadData
@@ -89,6 +90,9 @@ static void *ThreadRunHandler(void * arg)
    
    if( autoDelete )
       delete thread;
+
+   // Return this thread's memory pools to the heap.
+   dReleaseThreadMemory();
       
    // return value for pthread lib's benefit
    return NULL;
@@ -146,31 +150,30 @@ bool ThreadManager::compare(U32 threadId_1, U32 threadId_2)
 
 class PlatformThreadStorage
 {
-	public:
-		  pthread_key_t mThreadKey;
+public:
+   pthread_key_t mThreadKey;
 };
 
-/*ThreadStorage::ThreadStorage()
+ThreadStorage::ThreadStorage()
 {
-	  mThreadStorage = (PlatformThreadStorage *) mStorage;
-	    constructInPlace(mThreadStorage);
+   mThreadStorage = (PlatformThreadStorage *) mStorage;
+   constructInPlace(mThreadStorage);
 
-	      pthread_key_create(&mThreadStorage->mThreadKey, NULL);
+   pthread_key_create(&mThreadStorage->mThreadKey, NULL);
 }
 
 ThreadStorage::~ThreadStorage()
 {
-	  pthread_key_delete(mThreadStorage->mThreadKey);
+   pthread_key_delete(mThreadStorage->mThreadKey);
 }
 
 void *ThreadStorage::get()
 {
-	  return pthread_getspecific(mThreadStorage->mThreadKey);
+   return pthread_getspecific(mThreadStorage->mThreadKey);
 }
 
 void ThreadStorage::set(void *value)
 {
-	  pthread_setspecific(mThreadStorage->mThreadKey, value);
+   pthread_setspecific(mThreadStorage->mThreadKey, value);
 }
-*/
 
@@ -21,115 +21,308 @@
 //-----------------------------------------------------------------------------
 
 #include "sim/simFieldDictionary.h"
-#include "memory/dataChunker.h"
+#include "console/console.h"
 #include "console/consoleInternal.h"
 #include "memory/frameAllocator.h"
+#include "math/mMathFn.h"
 
 //-----------------------------------------------------------------------------
 
-SimFieldDictionary::Entry *SimFieldDictionary::mFreeList = NULL;
+// Pool of released tables, one free-list per power-of-two table size.
+// The first pointer-sized word of a released table links to the next one.
+static SimFieldDictionary::Entry *sTablePool[32] = { NULL };
+static U32 sTablePoolCount[32] = { 0 };
 
-static Chunker<SimFieldDictionary::Entry> fieldChunker;
+static inline U32 getTablePoolIndex(U32 tableSize)
+{
+   return getBinLog2(tableSize);
+}
 
-SimFieldDictionary::Entry *SimFieldDictionary::allocEntry()
+SimFieldDictionary::Entry *SimFieldDictionary::allocTable(U32 tableSize)
 {
-   if(mFreeList)
+   AssertFatal(Con::isMainThread(), "SimFieldDictionary::allocTable() - The table pool can only be used from the main thread.");
+
+   Entry *table;
+
+   // Reuse a pooled table if one is available.
+   const U32 poolIndex = getTablePoolIndex(tableSize);
+   if(sTablePool[poolIndex])
    {
-      Entry *ret = mFreeList;
-      mFreeList = ret->next;
-      return ret;
+      table = sTablePool[poolIndex];
+      sTablePool[poolIndex] = *((Entry**)table);
+      sTablePoolCount[poolIndex]--;
    }
    else
-      return fieldChunker.alloc();
+   {
+      table = (Entry*)dMalloc(sizeof(Entry) * tableSize);
+   }
+
+   for(U32 i = 0; i < tableSize; i++)
+      table[i].slotName = NULL;
+
+   return table;
 }
 
-void SimFieldDictionary::freeEntry(SimFieldDictionary::Entry *ent)
+void SimFieldDictionary::freeTable(Entry *table, U32 tableSize)
 {
-   ent->next = mFreeList;
-   mFreeList = ent;
+   if(!table)
+      return;
+
+   AssertFatal(Con::isMainThread(), "SimFieldDictionary::freeTable() - The table pool can only be used from the main thread.");
+
+   // Only pool the common table sizes and only so many of them.
+   const U32 poolIndex = getTablePoolIndex(tableSize);
+   if(tableSize > MaxPooledTableSize || sTablePoolCount[poolIndex] >= MaxPooledTables)
+   {
+      dFree(table);
+      return;
+   }
+
+   *((Entry**)table) = sTablePool[poolIndex];
+   sTablePool[poolIndex] = table;
+   sTablePoolCount[poolIndex]++;
 }
 
-SimFieldDictionary::SimFieldDictionary()
+//-----------------------------------------------------------------------------
+
+void SimFieldDictionary::setEntryValue(Entry *entry, const char *value)
+{
+   // Nothing to do if the value is being set to itself.
+   if(value == entry->value)
+      return;
+
+   const U32 size = dStrlen(value) + 1;
+
+   if(size <= entry->valueCapacity)
+   {
+      // The value fits in the existing allocation.
+      // NOTE: The value may be part of the existing value.
+      dMemmove(entry->value, value, size);
+   }
+   else
+   {
+      // The value does not fit so copy it before releasing the existing allocation.
+      const U32 capacity = (size + ValueGranularity - 1) & ~(ValueGranularity - 1);
+      char *newValue = (char *)dMalloc(capacity);
+      dMemcpy(newValue, value, size);
+
+      if(entry->valueCapacity)
+         dFree(entry->value);
+
+      entry->value = newValue;
+      entry->valueCapacity = capacity;
+   }
+
+   entry->numericValid = false;
+}
+
+void SimFieldDictionary::freeEntryValue(Entry *entry)
+{
+   if(entry->valueCapacity)
+      dFree(entry->value);
+
+   entry->valueCapacity = 0;
+   entry->value = NULL;
+}
+
+void SimFieldDictionary::moveEntry(Entry *dst, Entry *src)
 {
-   for(U32 i = 0; i < HashTableSize; i++)
-      mHashTable[i] = 0;
+   // NOTE: The value is allocated separately so it doesn't move with the entry.
+   dMemcpy(dst, src, sizeof(Entry));
+   src->slotName = NULL;
+}
+
+void SimFieldDictionary::updateNumericValue(Entry *entry)
+{
+   entry->intValue = dAtoi(entry->value);
+   entry->floatValue = dAtof(entry->value);
+   entry->numericValid = true;
+}
+
+//-----------------------------------------------------------------------------
 
+SimFieldDictionary::SimFieldDictionary()
+{
+   mTable = NULL;
+   mTableSize = 0;
+   mHashShift = 32;
+   mCount = 0;
    mVersion = 0;
 }
 
 SimFieldDictionary::~SimFieldDictionary()
 {
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(U32 i = 0; i < mTableSize; i++)
    {
-      for(Entry *walk = mHashTable[i]; walk;)
-      {
-         Entry *temp = walk;
-         walk = temp->next;
+      if(mTable[i].slotName)
+         freeEntryValue(&mTable[i]);
+   }
 
-         dFree(temp->value);
-         freeEntry(temp);
+   freeTable(mTable, mTableSize);
+}
+
+inline U32 SimFieldDictionary::getHomeIndex(StringTableEntry slotName) const
+{
+   // Fibonacci hashing spreads the pointer bits across the table.
+   return (HashPointer(slotName) * 2654435769u) >> mHashShift;
+}
+
+SimFieldDictionary::Entry *SimFieldDictionary::findEntry(StringTableEntry slotName) const
+{
+   if(!mCount)
+      return NULL;
+
+   const U32 mask = mTableSize - 1;
+   for(U32 index = getHomeIndex(slotName);; index = (index + 1) & mask)
+   {
+      Entry *entry = &mTable[index];
+      if(entry->slotName == slotName)
+         return entry;
+      if(!entry->slotName)
+         return NULL;
+   }
+}
+
+void SimFieldDictionary::growTable()
+{
+   Entry *oldTable = mTable;
+   const U32 oldTableSize = mTableSize;
+
+   mTableSize = oldTableSize ? oldTableSize * 2 : (U32)MinTableSize;
+   mHashShift = 32 - getBinLog2(mTableSize);
+   mTable = allocTable(mTableSize);
+
+   // Reinsert the existing entries.
+   const U32 mask = mTableSize - 1;
+   for(U32 i = 0; i < oldTableSize; i++)
+   {
+      Entry *oldEntry = &oldTable[i];
+      if(!oldEntry->slotName)
+         continue;
+
+      U32 index = getHomeIndex(oldEntry->slotName);
+      while(mTable[index].slotName)
+         index = (index + 1) & mask;
+
+      moveEntry(&mTable[index], oldEntry);
+   }
+
+   freeTable(oldTable, oldTableSize);
+}
+
+void SimFieldDictionary::removeEntry(Entry *entry)
+{
+   freeEntryValue(entry);
+   entry->slotName = NULL;
+   mCount--;
+
+   // Shift any following entries of the probe sequence back so no tombstones are needed.
+   const U32 mask = mTableSize - 1;
+   U32 hole = (U32)(entry - mTable);
+   for(U32 index = (hole + 1) & mask; mTable[index].slotName; index = (index + 1) & mask)
+   {
+      const U32 home = getHomeIndex(mTable[index].slotName);
+
+      // Move the entry if the hole lies cyclically between its home and its current index.
+      if(((index - home) & mask) >= ((index - hole) & mask))
+      {
+         moveEntry(&mTable[hole], &mTable[index]);
+         hole = index;
       }
    }
 }
 
 void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
-   Entry **walk = &mHashTable[bucket];
-   while(*walk && (*walk)->slotName != slotName)
-      walk = &((*walk)->next);
+   Entry *field = findEntry(slotName);
 
-   Entry *field = *walk;
    if(!*value)
    {
       if(field)
       {
          mVersion++;
-
-         dFree(field->value);
-         *walk = field->next;
-         freeEntry(field);
+         removeEntry(field);
       }
+      return;
    }
-   else
-   {
-      if(field)
-      {
-         dFree(field->value);
-         field->value = dStrdup(value);
-      }
-      else
-      {
-         mVersion++;
 
-         field = allocEntry();
-         field->value = dStrdup(value);
-         field->slotName = slotName;
-         field->next = NULL;
-         *walk = field;
-      }
+   if(!field)
+   {
+      mVersion++;
+
+      // Keep the load factor at or below 3/4.
+      if((mCount + 1) * 4 > mTableSize * 3)
+         growTable();
+
+      const U32 mask = mTableSize - 1;
+      U32 index = getHomeIndex(slotName);
+      while(mTable[index].slotName)
+         index = (index + 1) & mask;
+
+      field = &mTable[index];
+      field->slotName = slotName;
+      field->value = NULL;
+      field->valueCapacity = 0;
+      mCount++;
    }
+
+   setEntryValue(field, value);
 }
 
 const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
+   Entry *field = findEntry(slotName);
+   return field ? field->value : NULL;
+}
+
+F32 SimFieldDictionary::getFieldValueFloat(StringTableEntry slotName)
+{
+   Entry *field = findEntry(slotName);
+   if(!field)
+      return 0.0f;
 
-   for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
-      if(walk->slotName == slotName)
-         return walk->value;
+   if(!field->numericValid)
+      updateNumericValue(field);
 
-   return NULL;
+   return field->floatValue;
 }
 
+S32 SimFieldDictionary::getFieldValueInt(StringTableEntry slotName)
+{
+   Entry *field = findEntry(slotName);
+   if(!field)
+      return 0;
+
+   if(!field->numericValid)
+      updateNumericValue(field);
+
+   return field->intValue;
+}
+
+U32 SimFieldDictionary::getMemoryFootprint() const
+{
+   U32 footprint = sizeof(SimFieldDictionary) + mTableSize * sizeof(Entry);
+
+   for(U32 i = 0; i < mTableSize; i++)
+   {
+      if(mTable[i].slotName)
+         footprint += mTable[i].valueCapacity;
+   }
+
+   return footprint;
+}
 
 void SimFieldDictionary::assignFrom(SimFieldDictionary *dict)
 {
    mVersion++;
 
-   for(U32 i = 0; i < HashTableSize; i++)
-      for(Entry *walk = dict->mHashTable[i];walk; walk = walk->next)
+   for(U32 i = 0; i < dict->mTableSize; i++)
+   {
+      // Note that the source entry is copied as setting the value may grow our table.
+      Entry *walk = &dict->mTable[i];
+      if(walk->slotName)
          setFieldValue(walk->slotName, walk->value);
+   }
 }
 
 static S32 QSORT_CALLBACK compareEntries(const void* a,const void* b)
@@ -145,25 +338,26 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
    const AbstractClassRep::FieldList &list = obj->getFieldList();
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(U32 i = 0; i < mTableSize; i++)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = &mTable[i];
+      if(!walk->slotName)
+         continue;
 
-         if(i != list.size())
-            continue;
+      // make sure we haven't written this out yet:
+      U32 j;
+      for(j = 0; j < (U32)list.size(); j++)
+         if(list[j].pFieldname == walk->slotName)
+            break;
 
+      if(j != (U32)list.size())
+         continue;
 
-         if (!obj->writeField(walk->slotName, walk->value))
-            continue;
 
-         flist.push_back(walk);
-      }
+      if (!obj->writeField(walk->slotName, walk->value))
+         continue;
+
+      flist.push_back(walk);
    }
 
    // Sort Entries to prevent version control conflicts
@@ -191,21 +385,22 @@ void SimFieldDictionary::printFields(SimObject *obj)
    char expandedBuffer[4096];
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(U32 i = 0; i < mTableSize; i++)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = &mTable[i];
+      if(!walk->slotName)
+         continue;
 
-         if(i != list.size())
-            continue;
+      // make sure we haven't written this out yet:
+      U32 j;
+      for(j = 0; j < (U32)list.size(); j++)
+         if(list[j].pFieldname == walk->slotName)
+            break;
 
-         flist.push_back(walk);
-      }
+      if(j != (U32)list.size())
+         continue;
+
+      flist.push_back(walk);
    }
    dQsort(flist.address(),flist.size(),sizeof(Entry *),compareEntries);
 
@@ -222,7 +417,7 @@ void SimFieldDictionary::printFields(SimObject *obj)
 SimFieldDictionaryIterator::SimFieldDictionaryIterator(SimFieldDictionary * dictionary)
 {
    mDictionary = dictionary;
-   mHashIndex = -1;
+   mIndex = -1;
    mEntry = 0;
    operator++();
 }
@@ -232,11 +427,15 @@ SimFieldDictionary::Entry* SimFieldDictionaryIterator::operator++()
    if(!mDictionary)
       return(mEntry);
 
-   if(mEntry)
-      mEntry = mEntry->next;
+   mEntry = NULL;
 
-   while(!mEntry && (mHashIndex < (SimFieldDictionary::HashTableSize-1)))
-      mEntry = mDictionary->mHashTable[++mHashIndex];
+   // Skip the empty slots.
+   while(!mEntry && (mIndex < (S32)mDictionary->mTableSize - 1))
+   {
+      SimFieldDictionary::Entry *entry = &mDictionary->mTable[++mIndex];
+      if(entry->slotName)
+         mEntry = entry;
+   }
 
    return(mEntry);
 }
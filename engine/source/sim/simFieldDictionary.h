@@ -34,34 +34,65 @@ class SimObject;
 //-----------------------------------------------------------------------------
 
 /// Dictionary to keep track of dynamic fields on SimObject.
+///
+/// This is an open-addressed (linear probing) table keyed by the field's StringTableEntry.
+/// A numeric interpretation of the value is cached on demand so repeated numeric reads from
+/// script do not re-parse the string.
+///
+/// Tables are allocated from a pool shared by all dictionaries so that objects being created
+/// and destroyed reuse the same memory.  The pool is main-thread only.
+///
+/// Note that entries move when the table grows or when a field is removed so an Entry pointer
+/// must not be held across a call that adds or removes a field.  Values are allocated separately
+/// from the entries so a value returned by getFieldValue() stays valid until that field is changed.
 
 class SimFieldDictionary
 {
    friend class SimFieldDictionaryIterator;
 
   public:
-   struct Entry
+   enum
    {
-      StringTableEntry slotName;
-      char *value;
-      Entry *next;
+      ValueGranularity = 16,     ///< Value allocations are rounded up to this so small changes reuse them.
+      MinTableSize = 8,          ///< The smallest table allocated (must be a power of two).
+      MaxPooledTableSize = 256,  ///< Tables larger than this are not returned to the pool.
+      MaxPooledTables = 64,      ///< The most tables of each size kept in the pool.
    };
-   enum
+
+   struct Entry
    {
-      HashTableSize = 19
+      StringTableEntry slotName;    ///< NULL if the entry is empty.
+      char *value;                  ///< The heap allocated value.
+      U32 valueCapacity;            ///< Capacity of the value allocation.
+      bool numericValid;            ///< Whether the cached numeric values are valid.
+      S32 intValue;                 ///< Cached integer value.
+      F32 floatValue;               ///< Cached float value.
    };
-   Entry *mHashTable[HashTableSize];
-  private:
 
-   static Entry *mFreeList;
-   static void freeEntry(Entry *entry);
-   static Entry *allocEntry();
+  private:
+   Entry *mTable;
+   U32 mTableSize;
+   U32 mHashShift;
+   U32 mCount;
 
    /// In order to efficiently detect when a dynamic field has been
    /// added or deleted, we increment this every time we add or
    /// remove a field.
    U32 mVersion;
 
+   static Entry *allocTable(U32 tableSize);
+   static void freeTable(Entry *table, U32 tableSize);
+
+   U32 getHomeIndex(StringTableEntry slotName) const;
+   Entry *findEntry(StringTableEntry slotName) const;
+   void growTable();
+   void removeEntry(Entry *entry);
+
+   static void setEntryValue(Entry *entry, const char *value);
+   static void freeEntryValue(Entry *entry);
+   static void moveEntry(Entry *dst, Entry *src);
+   static void updateNumericValue(Entry *entry);
+
 public:
    const U32 getVersion() const { return mVersion; }
 
@@ -69,9 +100,16 @@ public:
    ~SimFieldDictionary();
    void setFieldValue(StringTableEntry slotName, const char *value);
    const char *getFieldValue(StringTableEntry slotName);
+   F32 getFieldValueFloat(StringTableEntry slotName);
+   S32 getFieldValueInt(StringTableEntry slotName);
    void writeFields(SimObject *obj, Stream &strem, U32 tabStop);
    void printFields(SimObject *obj);
    void assignFrom(SimFieldDictionary *dict);
+
+   inline U32 getFieldCount() const { return mCount; }
+
+   /// Get the memory used by the dictionary including heap allocated values.
+   U32 getMemoryFootprint() const;
 };
 
 //-----------------------------------------------------------------------------
@@ -79,7 +117,7 @@ public:
 class SimFieldDictionaryIterator
 {
    SimFieldDictionary *          mDictionary;
-   S32                           mHashIndex;
+   S32                           mIndex;
    SimFieldDictionary::Entry *   mEntry;
 
   public:
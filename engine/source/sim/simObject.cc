@@ -608,6 +608,28 @@ const char *SimObject::getDataField(StringTableEntry slotName, const char *array
 
 //-----------------------------------------------------------------------------
 
+F32 SimObject::getDataFieldFloat(StringTableEntry slotName, const char *array)
+{
+   // Use the cached numeric value for non-array dynamic fields.
+   if(mFieldDictionary && mFlags.test(ModDynamicFields) && (!array || !*array) && (!mFlags.test(ModStaticFields) || !findField(slotName)))
+      return mFieldDictionary->getFieldValueFloat(slotName);
+
+   return dAtof(getDataField(slotName, array));
+}
+
+//-----------------------------------------------------------------------------
+
+S32 SimObject::getDataFieldInt(StringTableEntry slotName, const char *array)
+{
+   // Use the cached numeric value for non-array dynamic fields.
+   if(mFieldDictionary && mFlags.test(ModDynamicFields) && (!array || !*array) && (!mFlags.test(ModStaticFields) || !findField(slotName)))
+      return mFieldDictionary->getFieldValueInt(slotName);
+
+   return dAtoi(getDataField(slotName, array));
+}
+
+//-----------------------------------------------------------------------------
+
 const char *SimObject::getPrefixedDataField(StringTableEntry fieldName, const char *array)
 {
     // Sanity!
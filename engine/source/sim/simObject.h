@@ -388,6 +388,21 @@ public:
     ///                      (if field is an array); if NULL, it is ignored.
     const char *getDataField(StringTableEntry slotName, const char *array);
 
+    /// Get the value of a field on the object as a float.
+    ///
+    /// Dynamic fields use the numeric value cached by the field dictionary so
+    /// repeated reads do not re-parse the field string.
+    ///
+    /// @param   slotName    Field to access.
+    /// @param   array       String containing index into array
+    ///                      (if field is an array); if NULL, it is ignored.
+    F32 getDataFieldFloat(StringTableEntry slotName, const char *array);
+
+    /// Get the value of a field on the object as an integer.
+    ///
+    /// @see getDataFieldFloat
+    S32 getDataFieldInt(StringTableEntry slotName, const char *array);
+
     /// Set the value of a field on the object.
     ///
     /// See @ref simobject_console "here" for a detailed discussion of what this
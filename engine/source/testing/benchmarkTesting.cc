@@ -0,0 +1,289 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _FINDMATCH_H_
+#include "string/findMatch.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#include <stdarg.h>
+
+//-----------------------------------------------------------------------------
+
+BenchmarkScenario* BenchmarkScenario::smpFirst = NULL;
+
+//-----------------------------------------------------------------------------
+
+BenchmarkScenario::BenchmarkScenario( const char* pGroupName, const char* pScenarioName, BenchmarkFunction pFunction ) :
+    mGroupName( pGroupName ),
+    mScenarioName( pScenarioName ),
+    mpFunction( pFunction )
+{
+    // Link into the scenario list.
+    mpNext = smpFirst;
+    smpFirst = this;
+}
+
+//-----------------------------------------------------------------------------
+
+Benchmark::Benchmark( const U32 warmupIterations, const U32 iterations ) :
+    mWarmupIterations( warmupIterations ),
+    mIterations( getMax( iterations, (U32)1 ) ),
+    mIteration( 0 ),
+    mObjectCount( 1 ),
+    mStartTime( 0 ),
+    mStartAllocationCount( 0 ),
+    mElapsedMilliseconds( 0 ),
+    mAllocationCount( 0 ),
+    mCompleted( false ),
+    mFailed( false ),
+    mMetricCount( 0 )
+{
+    mFailureMessage[0] = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Benchmark::iterate( void )
+{
+    // Finish if already completed or failed.
+    if ( mCompleted || mFailed )
+        return false;
+
+    // Start measuring after the warm-up iterations.
+    if ( mIteration == mWarmupIterations )
+    {
+        mStartAllocationCount = dGetAllocationCount();
+        mStartTime = Platform::getRealMilliseconds();
+    }
+
+    // Finish measuring after the measured iterations.
+    if ( mIteration == mWarmupIterations + mIterations )
+    {
+        mElapsedMilliseconds = Platform::getRealMilliseconds() - mStartTime;
+        mAllocationCount = dGetAllocationCount() - mStartAllocationCount;
+        mCompleted = true;
+        return false;
+    }
+
+    mIteration++;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+F64 Benchmark::getNanosecondsPerObject( void ) const
+{
+    // Calculate the total objects processed.
+    const F64 objectsProcessed = (F64)mIterations * (F64)getMax( mObjectCount, (U32)1 );
+
+    return ((F64)mElapsedMilliseconds * 1000000.0) / objectsProcessed;
+}
+
+//-----------------------------------------------------------------------------
+
+F64 Benchmark::getAllocationsPerIteration( void ) const
+{
+    return (F64)mAllocationCount / (F64)mIterations;
+}
+
+//-----------------------------------------------------------------------------
+
+void Benchmark::fail( const char* pFormat, ... )
+{
+    va_list args;
+    va_start( args, pFormat );
+    dVsprintf( mFailureMessage, sizeof(mFailureMessage), pFormat, args );
+    va_end( args );
+
+    mFailed = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Benchmark::addMetric( const char* pName, const F64 value )
+{
+    // Sanity!
+    AssertFatal( pName != NULL, "Benchmark::addMetric() - Cannot use a NULL metric name." );
+
+    // Update the metric if it already exists.
+    for( U32 index = 0; index < mMetricCount; ++index )
+    {
+        if ( dStrcmp( mMetricNames[index], pName ) == 0 )
+        {
+            mMetricValues[index] = value;
+            return;
+        }
+    }
+
+    // Warn if there are too many metrics.
+    if ( mMetricCount == MaxMetrics )
+    {
+        Con::warnf( "Benchmark::addMetric() - Cannot add metric '%s' as the maximum of %d metrics has been reached.", pName, MaxMetrics );
+        return;
+    }
+
+    mMetricNames[mMetricCount] = pName;
+    mMetricValues[mMetricCount] = value;
+    mMetricCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 runBenchmarks( const char* pPattern, const char* pOutputFile, const U32 warmupIterations, const U32 iterations )
+{
+    // Sanity!
+    AssertFatal( pPattern != NULL, "runBenchmarks() - Cannot use a NULL pattern." );
+
+    FileStream outputStream;
+    bool outputValid = false;
+
+    // Open the output file if specified.
+    if ( pOutputFile != NULL && *pOutputFile != 0 )
+    {
+        char outputFilePath[1024];
+        Con::expandPath( outputFilePath, sizeof(outputFilePath), pOutputFile );
+
+        outputValid = outputStream.open( outputFilePath, FileStream::Write );
+
+        // Warn if we could not open the output file.
+        if ( !outputValid )
+            Con::warnf( "runBenchmarks() - Could not open output file '%s'.", outputFilePath );
+    }
+
+    // Write the output header.
+    if ( outputValid )
+    {
+        char headerBuffer[256];
+        dSprintf( headerBuffer, sizeof(headerBuffer), "{\n    \"warmupIterations\": %d,\n    \"iterations\": %d,\n    \"benchmarks\": [", warmupIterations, iterations );
+        outputStream.writeStringBuffer( headerBuffer );
+    }
+
+    S32 failedCount = 0;
+    U32 scenarioCount = 0;
+
+    // Iterate scenarios.
+    for( BenchmarkScenario* pScenario = BenchmarkScenario::getFirst(); pScenario != NULL; pScenario = pScenario->getNext() )
+    {
+        char scenarioName[256];
+        dSprintf( scenarioName, sizeof(scenarioName), "%s.%s", pScenario->getGroupName(), pScenario->getScenarioName() );
+
+        // Skip if the scenario is not wanted.
+        if ( !FindMatch::isMatch( pPattern, scenarioName, false ) )
+            continue;
+
+        Con::printf( "> Starting Benchmark '%s'", scenarioName );
+
+        // Run the scenario.
+        Benchmark benchmark( warmupIterations, iterations );
+        pScenario->getFunction()( benchmark );
+
+        // Treat a scenario that did not complete its iterations as failed.
+        if ( !benchmark.getFailed() && !benchmark.getCompleted() )
+            benchmark.fail( "Scenario did not complete its iterations." );
+
+        char resultBuffer[1024];
+
+        if ( benchmark.getFailed() )
+        {
+            failedCount++;
+
+            Con::warnf( ">> Failed with '%s'", benchmark.getFailureMessage() );
+
+            dSprintf( resultBuffer, sizeof(resultBuffer),
+                "%s\n        { \"name\": \"%s\", \"failed\": true }",
+                scenarioCount == 0 ? "" : ",",
+                scenarioName );
+        }
+        else
+        {
+            Con::printf( ">> %d object(s), %d iteration(s), %dms, %.2f ns/object, %.2f allocation(s)/iteration",
+                benchmark.getObjectCount(),
+                benchmark.getIterations(),
+                benchmark.getElapsedMilliseconds(),
+                benchmark.getNanosecondsPerObject(),
+                benchmark.getAllocationsPerIteration() );
+
+            dSprintf( resultBuffer, sizeof(resultBuffer),
+                "%s\n        { \"name\": \"%s\", \"objects\": %d, \"iterations\": %d, \"elapsedMs\": %d, \"nsPerObject\": %.3f, \"allocationsPerIteration\": %.3f",
+                scenarioCount == 0 ? "" : ",",
+                scenarioName,
+                benchmark.getObjectCount(),
+                benchmark.getIterations(),
+                benchmark.getElapsedMilliseconds(),
+                benchmark.getNanosecondsPerObject(),
+                benchmark.getAllocationsPerIteration() );
+
+            // Output the metrics.
+            for( U32 index = 0; index < benchmark.getMetricCount(); ++index )
+            {
+                Con::printf( ">> %s: %.2f", benchmark.getMetricName( index ), benchmark.getMetricValue( index ) );
+
+                const U32 resultLength = dStrlen( resultBuffer );
+                dSprintf( resultBuffer + resultLength, sizeof(resultBuffer) - resultLength, ", \"%s\": %.3f", benchmark.getMetricName( index ), benchmark.getMetricValue( index ) );
+            }
+
+            dStrcat( resultBuffer, " }" );
+        }
+
+        // Write the result.
+        if ( outputValid )
+            outputStream.writeStringBuffer( resultBuffer );
+
+        scenarioCount++;
+
+        Con::printf( "> Ending Benchmark '%s'", scenarioName );
+        Con::printBlankLine();
+    }
+
+    // Write the output footer.
+    if ( outputValid )
+    {
+        outputStream.writeStringBuffer( "\n    ]\n}\n" );
+        outputStream.close();
+    }
+
+    return failedCount;
+}
+
+#include "benchmarkTesting_ScriptBinding.h"
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BENCHMARK_TESTING_H_
+#define _BENCHMARK_TESTING_H_
+
+#ifndef TORQUE_SHIPPING
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Benchmark;
+
+//-----------------------------------------------------------------------------
+
+/// A benchmark scenario registered with the BENCHMARK() macro.
+/// Scenarios are deterministic and headless i.e. they must not rely on a rendering context.
+class BenchmarkScenario
+{
+public:
+    typedef void (*BenchmarkFunction)( Benchmark& benchmark );
+
+    BenchmarkScenario( const char* pGroupName, const char* pScenarioName, BenchmarkFunction pFunction );
+
+    inline const char* getGroupName( void ) const               { return mGroupName; }
+    inline const char* getScenarioName( void ) const            { return mScenarioName; }
+    inline BenchmarkFunction getFunction( void ) const          { return mpFunction; }
+    inline BenchmarkScenario* getNext( void ) const             { return mpNext; }
+
+    static inline BenchmarkScenario* getFirst( void )           { return smpFirst; }
+
+private:
+    const char*                 mGroupName;
+    const char*                 mScenarioName;
+    BenchmarkFunction           mpFunction;
+    BenchmarkScenario*          mpNext;
+
+    static BenchmarkScenario*   smpFirst;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The measurement state handed to a running benchmark scenario.
+///
+/// A scenario performs any set-up, declares how many objects each iteration processes
+/// then loops on iterate().  The first "warm-up" iterations are not measured.  The time and
+/// the engine heap allocations (see dGetAllocationCount()) are measured across the remaining iterations.
+///
+/// @code
+/// BENCHMARK( Scene, SpriteTick )
+/// {
+///     // Set-up...
+///     benchmark.setObjectCount( spriteCount );
+///
+///     while( benchmark.iterate() )
+///         pScene->processTick();
+///
+///     // Tear-down...
+/// }
+/// @endcode
+class Benchmark
+{
+public:
+    Benchmark( const U32 warmupIterations, const U32 iterations );
+
+    /// Set-up.
+    inline void setObjectCount( const U32 objectCount )         { mObjectCount = objectCount; }
+    inline U32 getObjectCount( void ) const                     { return mObjectCount; }
+    inline void setIterations( const U32 iterations )           { mIterations = iterations; }
+    inline U32 getIterations( void ) const                      { return mIterations; }
+    inline U32 getWarmupIterations( void ) const                { return mWarmupIterations; }
+
+    /// Measurement.
+    bool iterate( void );
+    inline bool isMeasuring( void ) const                       { return mIteration > mWarmupIterations; }
+    inline bool getCompleted( void ) const                      { return mCompleted; }
+
+    /// Results.
+    inline U32 getElapsedMilliseconds( void ) const             { return mElapsedMilliseconds; }
+    inline U32 getAllocationCount( void ) const                 { return mAllocationCount; }
+    F64 getNanosecondsPerObject( void ) const;
+    F64 getAllocationsPerIteration( void ) const;
+
+    /// Failure.
+    void fail( const char* pFormat, ... );
+    inline bool getFailed( void ) const                         { return mFailed; }
+    inline const char* getFailureMessage( void ) const          { return mFailureMessage; }
+
+    /// Additional scenario-specific metrics e.g. memory footprint.
+    void addMetric( const char* pName, const F64 value );
+    inline U32 getMetricCount( void ) const                     { return mMetricCount; }
+    inline const char* getMetricName( const U32 index ) const   { return mMetricNames[index]; }
+    inline F64 getMetricValue( const U32 index ) const          { return mMetricValues[index]; }
+
+private:
+    enum { MaxMetrics = 8 };
+
+    U32     mWarmupIterations;
+    U32     mIterations;
+    U32     mIteration;
+    U32     mObjectCount;
+    U32     mStartTime;
+    U32     mStartAllocationCount;
+    U32     mElapsedMilliseconds;
+    U32     mAllocationCount;
+    bool    mCompleted;
+    bool    mFailed;
+    char    mFailureMessage[256];
+    U32     mMetricCount;
+    const char* mMetricNames[MaxMetrics];
+    F64     mMetricValues[MaxMetrics];
+};
+
+//-----------------------------------------------------------------------------
+
+/// Runs all registered benchmark scenarios whose "Group.Name" matches the specified pattern,
+/// echoing the results to the console and optionally writing them as JSON to the specified file.
+/// Returns the number of scenarios that failed.
+extern S32 runBenchmarks( const char* pPattern, const char* pOutputFile, const U32 warmupIterations, const U32 iterations );
+
+//-----------------------------------------------------------------------------
+
+#define BENCHMARK( group, name ) \
+    static void benchmark_##group##_##name( Benchmark& benchmark ); \
+    static BenchmarkScenario benchmarkScenario_##group##_##name( #group, #name, benchmark_##group##_##name ); \
+    static void benchmark_##group##_##name( Benchmark& benchmark )
+
+#endif // TORQUE_SHIPPING
+
+#endif // _BENCHMARK_TESTING_H_
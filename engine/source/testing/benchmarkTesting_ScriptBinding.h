@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef TORQUE_SHIPPING
+
+/*! @defgroup BenchmarkTesting Benchmark Testing
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Runs the registered benchmark scenarios.
+    The results are echoed to the console and can optionally be written as JSON to a file so that they can be tracked across builds.
+    @param pattern An optional pattern matched against the "Group.Name" of each scenario e.g. "Scene.*".  Defaults to all scenarios.
+    @param outputFile An optional file to write the JSON results to.
+    @param iterations An optional number of measured iterations for each scenario.  Defaults to 100.
+    @param warmupIterations An optional number of unmeasured iterations for each scenario.  Defaults to 5.
+    @return The number of scenarios that failed.
+*/
+ConsoleFunctionWithDocs( runAllBenchmarks, ConsoleInt, 1, 5, ([pattern], [outputFile], [iterations], [warmupIterations]) )
+{
+    // Fetch the arguments.
+    const char* pPattern = argc > 1 && *argv[1] != 0 ? argv[1] : "*";
+    const char* pOutputFile = argc > 2 ? argv[2] : NULL;
+    const U32 iterations = argc > 3 ? (U32)getMax( dAtoi(argv[3]), 1 ) : 100;
+    const U32 warmupIterations = argc > 4 ? (U32)getMax( dAtoi(argv[4]), 0 ) : 5;
+
+    Con::printBlankLine();
+    Con::printSeparator();
+    Con::printf( "Benchmarks Starting..." );
+    Con::printBlankLine();
+
+    const S32 result = runBenchmarks( pPattern, pOutputFile, warmupIterations, iterations );
+
+    Con::printBlankLine();
+    Con::printf( "... Benchmarks Ended." );
+    Con::printSeparator();
+    Con::printBlankLine();
+
+    return result;
+}
+
+/*! @} */ // end group BenchmarkTesting
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,116 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _SMALLVECTOR_H_
+#include "collection/smallVector.h"
+#endif
+
+#ifndef _WORLD_QUERY_RESULT_H_
+#include "2d/scene/WorldQueryResult.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static const U32 vectorElementCount = 100000;
+static const U32 shortVectorCount = 10000;
+static const U32 shortVectorElementCount = 12;
+
+// Stops the short-lived vectors from being optimized away.
+static volatile U32 vectorBenchmarkSink = 0;
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Vector, PushBack )
+{
+    benchmark.setObjectCount( vectorElementCount );
+
+    // Append to a fresh vector each iteration so every growth step is measured.
+    while( benchmark.iterate() )
+    {
+        Vector<U32> elements;
+        for ( U32 index = 0; index < vectorElementCount; ++index )
+            elements.push_back( index );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Vector, QueryResults )
+{
+    benchmark.setObjectCount( vectorElementCount );
+
+    // Mimic world query results being gathered into a fresh vector.
+    while( benchmark.iterate() )
+    {
+        typeWorldQueryResultVector queryResults;
+        for ( U32 index = 0; index < vectorElementCount; ++index )
+            queryResults.push_back( WorldQueryResult() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Vector, ShortLived )
+{
+    benchmark.setObjectCount( shortVectorCount * shortVectorElementCount );
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 vectorIndex = 0; vectorIndex < shortVectorCount; ++vectorIndex )
+        {
+            Vector<U32> elements;
+            for ( U32 index = 0; index < shortVectorElementCount; ++index )
+                elements.push_back( index );
+
+            vectorBenchmarkSink += elements.last();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( SmallVector, ShortLived )
+{
+    benchmark.setObjectCount( shortVectorCount * shortVectorElementCount );
+
+    // The elements fit in the inline storage so no allocations should occur.
+    while( benchmark.iterate() )
+    {
+        for ( U32 vectorIndex = 0; vectorIndex < shortVectorCount; ++vectorIndex )
+        {
+            SmallVector<U32, 16> elements;
+            for ( U32 index = 0; index < shortVectorElementCount; ++index )
+                elements.push_back( index );
+
+            vectorBenchmarkSink += elements.last();
+        }
+    }
+}
+
+#endif // TORQUE_SHIPPING
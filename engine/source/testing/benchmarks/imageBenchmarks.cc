@@ -0,0 +1,185 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// The image modules whose bitmaps are decoded.
+static const char* imageBenchmarkModules[] = { "ToyAssets", "TropicalAssets" };
+
+//-----------------------------------------------------------------------------
+
+static bool findImageBenchmarkFiles( Benchmark& benchmark, Vector<StringTableEntry>& imageFiles )
+{
+    for ( U32 moduleIndex = 0; moduleIndex < sizeof(imageBenchmarkModules) / sizeof(const char*); ++moduleIndex )
+    {
+        // Find the bitmap files in the module tree.
+        char modulePathBuffer[1024];
+        dSprintf( modulePathBuffer, sizeof(modulePathBuffer), "%s/modules/%s", Platform::getMainDotCsDir(), imageBenchmarkModules[moduleIndex] );
+
+        Vector<Platform::FileInfo> files;
+        Platform::dumpPath( modulePathBuffer, files );
+
+        for ( U32 index = 0; index < (U32)files.size(); ++index )
+        {
+            if ( !TextureManager::canDecodeBitmap( files[index].pFileName ) )
+                continue;
+
+            char filenameBuffer[1024];
+            dSprintf( filenameBuffer, sizeof(filenameBuffer), "%s/%s", files[index].pFullPath, files[index].pFileName );
+            imageFiles.push_back( StringTable->insert( filenameBuffer ) );
+        }
+    }
+
+    if ( imageFiles.size() == 0 )
+    {
+        benchmark.fail( "No image files found in the ToyAssets or TropicalAssets modules." );
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void releaseDecodedBitmaps( Vector<TextureManager::DecodedBitmap>& decodedBitmaps, F64& pixelCount )
+{
+    pixelCount = 0.0;
+
+    for ( U32 index = 0; index < (U32)decodedBitmaps.size(); ++index )
+    {
+        TextureManager::DecodedBitmap& decodedBitmap = decodedBitmaps[index];
+
+        if ( decodedBitmap.mpBitmap != NULL )
+            pixelCount += decodedBitmap.mpBitmap->getWidth() * decodedBitmap.mpBitmap->getHeight();
+
+        if ( decodedBitmap.mpPowerOfTwoBitmap != decodedBitmap.mpBitmap )
+            delete decodedBitmap.mpPowerOfTwoBitmap;
+
+        delete decodedBitmap.mpBitmap;
+        decodedBitmap.mpBitmap = NULL;
+        decodedBitmap.mpPowerOfTwoBitmap = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Image, DecodeSerial )
+{
+    Vector<StringTableEntry> imageFiles;
+    if ( !findImageBenchmarkFiles( benchmark, imageFiles ) )
+        return;
+
+    benchmark.setObjectCount( imageFiles.size() );
+
+    Vector<TextureManager::DecodedBitmap> decodedBitmaps;
+    decodedBitmaps.setSize( imageFiles.size() );
+    for ( U32 index = 0; index < (U32)imageFiles.size(); ++index )
+        decodedBitmaps[index] = TextureManager::DecodedBitmap();
+
+    F64 pixelCount = 0.0;
+
+    // Decode and pad each bitmap on this thread as loading a texture used to.
+    while( benchmark.iterate() )
+    {
+        for ( U32 index = 0; index < (U32)imageFiles.size(); ++index )
+        {
+            const char* pExtension = dStrrchr( imageFiles[index], '.' );
+
+            FileStream stream;
+            GBitmap* pBitmap = new GBitmap();
+
+            if ( !stream.open( imageFiles[index], FileStream::Read ) ||
+                !(dStricmp( pExtension, ".png" ) == 0 ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream )) )
+            {
+                delete pBitmap;
+                releaseDecodedBitmaps( decodedBitmaps, pixelCount );
+                benchmark.fail( "Could not decode '%s'.", imageFiles[index] );
+                return;
+            }
+
+            decodedBitmaps[index].mpBitmap = pBitmap;
+            decodedBitmaps[index].mpPowerOfTwoBitmap = TextureManager::createPowerOfTwoBitmap( pBitmap );
+        }
+
+        releaseDecodedBitmaps( decodedBitmaps, pixelCount );
+    }
+
+    benchmark.addMetric( "pixels", pixelCount );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Image, DecodeWorkerPool )
+{
+    Vector<StringTableEntry> imageFiles;
+    if ( !findImageBenchmarkFiles( benchmark, imageFiles ) )
+        return;
+
+    benchmark.setObjectCount( imageFiles.size() );
+
+    Vector<TextureManager::DecodedBitmap> decodedBitmaps;
+    decodedBitmaps.setSize( imageFiles.size() );
+    for ( U32 index = 0; index < (U32)imageFiles.size(); ++index )
+    {
+        decodedBitmaps[index] = TextureManager::DecodedBitmap();
+        decodedBitmaps[index].mFilePath = imageFiles[index];
+    }
+
+    F64 pixelCount = 0.0;
+
+    // Decode and pad the bitmaps across the worker pool.
+    while( benchmark.iterate() )
+    {
+        TextureManager::decodeBitmaps( decodedBitmaps.address(), decodedBitmaps.size() );
+
+        for ( U32 index = 0; index < (U32)decodedBitmaps.size(); ++index )
+        {
+            if ( decodedBitmaps[index].mpBitmap == NULL )
+            {
+                releaseDecodedBitmaps( decodedBitmaps, pixelCount );
+                benchmark.fail( "Could not decode '%s'.", imageFiles[index] );
+                return;
+            }
+        }
+
+        releaseDecodedBitmaps( decodedBitmaps, pixelCount );
+    }
+
+    benchmark.addMetric( "pixels", pixelCount );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,201 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+// The loopback benchmarks exercise the Linux datagram receive path.
+#if defined(TORQUE_OS_LINUX)
+
+#include "platformX86UNIX/x86UNIXNetPacketRing.h"
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+//-----------------------------------------------------------------------------
+
+static const U32 loopbackPacketCount = 20000;
+static const U32 loopbackPacketSize = 256;
+static const U32 loopbackSendBurst = 64;
+
+//-----------------------------------------------------------------------------
+
+struct LoopbackSockets
+{
+    int mSender;
+    int mReceiver;
+    sockaddr_in mReceiverAddress;
+};
+
+//-----------------------------------------------------------------------------
+
+static bool openLoopbackSockets( LoopbackSockets& sockets )
+{
+    sockets.mSender = -1;
+    sockets.mReceiver = -1;
+
+    sockets.mSender = socket( AF_INET, SOCK_DGRAM, 0 );
+    sockets.mReceiver = socket( AF_INET, SOCK_DGRAM, 0 );
+    if ( sockets.mSender == -1 || sockets.mReceiver == -1 )
+        return false;
+
+    // Bind the receiver to an ephemeral loopback port.
+    dMemset( &sockets.mReceiverAddress, 0, sizeof(sockets.mReceiverAddress) );
+    sockets.mReceiverAddress.sin_family = AF_INET;
+    sockets.mReceiverAddress.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    sockets.mReceiverAddress.sin_port = 0;
+    if ( bind( sockets.mReceiver, (sockaddr*)&sockets.mReceiverAddress, sizeof(sockets.mReceiverAddress) ) == -1 )
+        return false;
+
+    socklen_t addressLength = sizeof(sockets.mReceiverAddress);
+    if ( getsockname( sockets.mReceiver, (sockaddr*)&sockets.mReceiverAddress, &addressLength ) == -1 )
+        return false;
+
+    // Make room for a whole burst.
+    S32 bufferSize = 1024 * 1024;
+    setsockopt( sockets.mReceiver, SOL_SOCKET, SO_RCVBUF, (char*)&bufferSize, sizeof(bufferSize) );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void closeLoopbackSockets( LoopbackSockets& sockets )
+{
+    if ( sockets.mSender != -1 )
+        close( sockets.mSender );
+    if ( sockets.mReceiver != -1 )
+        close( sockets.mReceiver );
+}
+
+//-----------------------------------------------------------------------------
+
+static void sendLoopbackBurst( LoopbackSockets& sockets, const U8* pPayload, const U32 count )
+{
+    for ( U32 index = 0; index < count; ++index )
+        sendto( sockets.mSender, (const char*)pPayload, loopbackPacketSize, 0, (sockaddr*)&sockets.mReceiverAddress, sizeof(sockets.mReceiverAddress) );
+}
+
+//-----------------------------------------------------------------------------
+
+static void addPacketsPerSecondMetric( Benchmark& benchmark )
+{
+    if ( benchmark.getElapsedMilliseconds() == 0 )
+        return;
+
+    const F64 packetCount = (F64)benchmark.getObjectCount() * (F64)benchmark.getIterations();
+    benchmark.addMetric( "packetsPerSecond", packetCount * 1000.0 / (F64)benchmark.getElapsedMilliseconds() );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Net, LoopbackRecvFrom )
+{
+    LoopbackSockets sockets;
+    if ( !openLoopbackSockets( sockets ) )
+    {
+        benchmark.fail( "Could not open the loopback sockets." );
+        closeLoopbackSockets( sockets );
+        return;
+    }
+
+    U8 payload[loopbackPacketSize];
+    dMemset( payload, 0xAB, sizeof(payload) );
+
+    benchmark.setObjectCount( loopbackPacketCount );
+
+    // Receive one datagram per call as the original Net::process() did.
+    PacketReceiveEvent receiveEvent;
+    while( benchmark.iterate() )
+    {
+        U32 receivedCount = 0;
+        while ( receivedCount < loopbackPacketCount )
+        {
+            sendLoopbackBurst( sockets, payload, loopbackSendBurst );
+
+            sockaddr_storage address;
+            socklen_t addressLength = sizeof(address);
+            while ( recvfrom( sockets.mReceiver, (char*)receiveEvent.data, MaxPacketDataSize, MSG_DONTWAIT, (sockaddr*)&address, &addressLength ) > 0 )
+            {
+                receivedCount++;
+                addressLength = sizeof(address);
+            }
+        }
+    }
+
+    addPacketsPerSecondMetric( benchmark );
+
+    closeLoopbackSockets( sockets );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Net, LoopbackPacketRing )
+{
+    LoopbackSockets sockets;
+    if ( !openLoopbackSockets( sockets ) )
+    {
+        benchmark.fail( "Could not open the loopback sockets." );
+        closeLoopbackSockets( sockets );
+        return;
+    }
+
+    U8 payload[loopbackPacketSize];
+    dMemset( payload, 0xAB, sizeof(payload) );
+
+    benchmark.setObjectCount( loopbackPacketCount );
+
+    // Receive a batch of datagrams per call as Net::process() now does.
+    NetPacketRing* pPacketRing = new NetPacketRing();
+    while( benchmark.iterate() )
+    {
+        U32 receivedCount = 0;
+        while ( receivedCount < loopbackPacketCount )
+        {
+            sendLoopbackBurst( sockets, payload, loopbackSendBurst );
+
+            U32 count;
+            do
+            {
+                count = pPacketRing->receive( sockets.mReceiver );
+                receivedCount += count;
+            }
+            while ( count == NetPacketRing::BatchSize );
+        }
+    }
+
+    addPacketsPerSecondMetric( benchmark );
+
+    delete pPacketRing;
+
+    closeLoopbackSockets( sockets );
+}
+
+#endif // TORQUE_OS_LINUX
+
+#endif // TORQUE_SHIPPING
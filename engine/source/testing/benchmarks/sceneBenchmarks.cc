@@ -0,0 +1,562 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+#ifndef _TRIGGER_H_
+#include "2d/sceneobject/Trigger.h"
+#endif
+
+#ifndef _PARTICLE_PLAYER_H_
+#include "2d/sceneobject/ParticlePlayer.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_H_
+#include "2d/assets/ParticleAsset.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _SCENE_PREFAB_H_
+#include "2d/scene/ScenePrefab.h"
+#endif
+
+#ifndef _SCENE_RENDER_QUEUE_H_
+#include "2d/scene/SceneRenderQueue.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BENCHMARK_SCENE_SEED                1376312589
+#define BENCHMARK_SCENE_EXTENT              500.0f
+#define BENCHMARK_RENDER_REQUEST_COUNT      100000
+#define BENCHMARK_RENDER_OBJECT_COUNT       64
+
+//-----------------------------------------------------------------------------
+
+static Scene* createBenchmarkScene( void )
+{
+    // Create and register the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static void destroyBenchmarkScene( Scene* pScene )
+{
+    // Clear and delete the scene.
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+template<class T> static T* createBenchmarkObject( Scene* pScene, const Vector2& position, const Vector2& size, const b2BodyType bodyType )
+{
+    // Create and register the object.
+    T* pSceneObject = new T();
+    pSceneObject->registerObject();
+
+    // Configure the object.
+    pSceneObject->setBodyType( bodyType );
+    pSceneObject->setPosition( position );
+    pSceneObject->setSize( size );
+
+    // Add to the scene.
+    pScene->addToScene( pSceneObject );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+static Vector2 getRandomBenchmarkPosition( RandomLCG& random )
+{
+    return Vector2(
+        random.randRangeF( -BENCHMARK_SCENE_EXTENT, BENCHMARK_SCENE_EXTENT ),
+        random.randRangeF( -BENCHMARK_SCENE_EXTENT, BENCHMARK_SCENE_EXTENT ) );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, SpriteTick )
+{
+    const U32 spriteCount = 10000;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+    pScene->setGravity( b2Vec2_zero );
+
+    // Create moving sprites without any collision shapes.
+    for ( U32 index = 0; index < spriteCount; ++index )
+    {
+        Sprite* pSprite = createBenchmarkObject<Sprite>( pScene, getRandomBenchmarkPosition( random ), Vector2( 1.0f, 1.0f ), b2_dynamicBody );
+        pSprite->setSleepingAllowed( false );
+        pSprite->setLinearVelocity( Vector2( random.randRangeF( -5.0f, 5.0f ), random.randRangeF( -5.0f, 5.0f ) ) );
+        pSprite->setAngularVelocity( random.randRangeF( -1.0f, 1.0f ) );
+    }
+
+    benchmark.setObjectCount( spriteCount );
+
+    while( benchmark.iterate() )
+        pScene->processTick();
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, SleepingWorld )
+{
+    const U32 staticCount = 50000;
+    const U32 movingCount = 500;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+    pScene->setGravity( b2Vec2_zero );
+
+    // Create the static scenery.
+    for ( U32 index = 0; index < staticCount; ++index )
+        createBenchmarkObject<Sprite>( pScene, getRandomBenchmarkPosition( random ), Vector2( 1.0f, 1.0f ), b2_staticBody );
+
+    // Create a few moving sprites.
+    for ( U32 index = 0; index < movingCount; ++index )
+    {
+        Sprite* pSprite = createBenchmarkObject<Sprite>( pScene, getRandomBenchmarkPosition( random ), Vector2( 1.0f, 1.0f ), b2_dynamicBody );
+        pSprite->setSleepingAllowed( false );
+        pSprite->setLinearVelocity( Vector2( random.randRangeF( -5.0f, 5.0f ), random.randRangeF( -5.0f, 5.0f ) ) );
+    }
+
+    // Let the scenery settle.
+    pScene->processTick();
+    pScene->processTick();
+
+    benchmark.setObjectCount( staticCount + movingCount );
+
+    while( benchmark.iterate() )
+    {
+        pScene->processTick();
+        pScene->interpolateTick( 0.5f );
+    }
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, ParticleBurst )
+{
+    const U32 playerCount = 100;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    // Create a private particle asset with a single high quantity emitter.
+    ParticleAsset* pParticleAsset = new ParticleAsset();
+    ParticleAssetEmitter* pEmitter = pParticleAsset->createEmitter();
+    pEmitter->getQuantityBaseField().setSingleDataKey( 200.0f );
+    pEmitter->getParticleLifeBaseField().setSingleDataKey( 2.0f );
+    pEmitter->getSpeedBaseField().setSingleDataKey( 5.0f );
+    pEmitter->getEmissionArcBaseField().setSingleDataKey( 360.0f );
+    pEmitter->getSizeXLifeField().addDataKey( 1.0f, 0.1f );
+    pEmitter->getAlphaChannelLifeField().addDataKey( 1.0f, 0.0f );
+    const StringTableEntry particleAssetId = AssetDatabase.addPrivateAsset( pParticleAsset );
+
+    Scene* pScene = createBenchmarkScene();
+
+    // Create the particle players.
+    for ( U32 index = 0; index < playerCount; ++index )
+    {
+        ParticlePlayer* pParticlePlayer = createBenchmarkObject<ParticlePlayer>( pScene, getRandomBenchmarkPosition( random ), Vector2( 1.0f, 1.0f ), b2_staticBody );
+        pParticlePlayer->setParticle( particleAssetId );
+        pParticlePlayer->setCameraIdleDistance( 0.0f );
+        pParticlePlayer->play( true );
+    }
+
+    while( benchmark.iterate() )
+        pScene->processTick();
+
+    // Use the active particles as the object count.
+    benchmark.setObjectCount( ParticleSystem::Instance->getActiveParticleCount() );
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Physics, Pyramid )
+{
+    const U32 pyramidRows = 30;
+
+    Scene* pScene = createBenchmarkScene();
+
+    // Create the ground.
+    SceneObject* pGround = createBenchmarkObject<SceneObject>( pScene, Vector2( 0.0f, -1.0f ), Vector2( 100.0f, 2.0f ), b2_staticBody );
+    pGround->createPolygonBoxCollisionShape( 100.0f, 2.0f );
+
+    U32 boxCount = 0;
+
+    // Create the pyramid boxes.
+    for ( U32 row = 0; row < pyramidRows; ++row )
+    {
+        const U32 rowBoxCount = pyramidRows - row;
+        const F32 rowStart = -(F32)rowBoxCount * 0.5f;
+
+        for ( U32 column = 0; column < rowBoxCount; ++column )
+        {
+            Sprite* pBox = createBenchmarkObject<Sprite>( pScene, Vector2( rowStart + (F32)column + 0.5f, 0.5f + (F32)row ), Vector2( 1.0f, 1.0f ), b2_dynamicBody );
+            pBox->createPolygonBoxCollisionShape( 1.0f, 1.0f );
+            boxCount++;
+        }
+    }
+
+    benchmark.setObjectCount( boxCount );
+
+    while( benchmark.iterate() )
+        pScene->processTick();
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, TriggerTick )
+{
+    const U32 triggerCount = 1000;
+    const U32 spriteCount = 5000;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+    pScene->setGravity( b2Vec2_zero );
+
+    // Create the triggers.
+    for ( U32 index = 0; index < triggerCount; ++index )
+    {
+        Trigger* pTrigger = createBenchmarkObject<Trigger>( pScene, getRandomBenchmarkPosition( random ), Vector2( 10.0f, 10.0f ), b2_staticBody );
+        pTrigger->createPolygonBoxCollisionShape( 10.0f, 10.0f );
+        pTrigger->setEnterCallback( true );
+        pTrigger->setStayCallback( true );
+        pTrigger->setLeaveCallback( true );
+    }
+
+    // Create the sprites moving through the triggers.
+    for ( U32 index = 0; index < spriteCount; ++index )
+    {
+        Sprite* pSprite = createBenchmarkObject<Sprite>( pScene, getRandomBenchmarkPosition( random ), Vector2( 1.0f, 1.0f ), b2_dynamicBody );
+        pSprite->createCircleCollisionShape( 0.5f );
+        pSprite->setSleepingAllowed( false );
+        pSprite->setLinearVelocity( Vector2( random.randRangeF( -20.0f, 20.0f ), random.randRangeF( -20.0f, 20.0f ) ) );
+    }
+
+    benchmark.setObjectCount( triggerCount + spriteCount );
+
+    while( benchmark.iterate() )
+        pScene->processTick();
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+static void runDebrisBenchmark( Benchmark& benchmark, const U32 recycleLimit, const U32 deleteBudget )
+{
+    const U32 debrisCount = 2000;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+    pScene->setRecycleLimit( "Sprite", recycleLimit );
+    pScene->setDeleteBudget( deleteBudget );
+
+    Vector<SceneObject*> debris;
+    debris.setSize( debrisCount );
+
+    benchmark.setObjectCount( debrisCount );
+
+    while( benchmark.iterate() )
+    {
+        // Spawn the debris.
+        for ( U32 index = 0; index < debrisCount; ++index )
+        {
+            SceneObject* pSceneObject = pScene->create( "Sprite" );
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( getRandomBenchmarkPosition( random ) );
+            pSceneObject->setSize( Vector2( 0.5f, 0.5f ) );
+
+            // Only new objects need a collision shape.
+            if ( pSceneObject->getCollisionShapeCount() == 0 )
+                pSceneObject->createCircleCollisionShape( 0.25f );
+
+            debris[index] = pSceneObject;
+        }
+
+        // Remove the debris.
+        for ( U32 index = 0; index < debrisCount; ++index )
+            debris[index]->safeDelete();
+
+        pScene->processTick();
+    }
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, DebrisDelete )    { runDebrisBenchmark( benchmark, 0, 0 ); }
+BENCHMARK( Scene, DebrisRecycle )   { runDebrisBenchmark( benchmark, 2000, 0 ); }
+BENCHMARK( Scene, DebrisAmortized ) { runDebrisBenchmark( benchmark, 0, 2000 ); }
+
+//-----------------------------------------------------------------------------
+
+static Sprite* createSpawnTemplate( void )
+{
+    // Create a typical projectile.
+    Sprite* pSprite = new Sprite();
+    pSprite->registerObject();
+    pSprite->setBodyType( b2_dynamicBody );
+    pSprite->setSize( Vector2( 0.5f, 0.5f ) );
+    pSprite->setSceneLayer( 5 );
+    pSprite->setBullet( true );
+    pSprite->setGravityScale( 0.0f );
+    pSprite->setBlendColor( ColorF( 1.0f, 0.5f, 0.5f, 1.0f ) );
+    pSprite->createCircleCollisionShape( 0.25f );
+
+    return pSprite;
+}
+
+//-----------------------------------------------------------------------------
+
+static void finishSpawnBenchmark( Benchmark& benchmark )
+{
+    // Finish if the benchmark did not complete.
+    if ( !benchmark.getCompleted() || benchmark.getElapsedMilliseconds() == 0 )
+        return;
+
+    // NOTE:-   Each iteration also deletes the spawned objects so this is a lower bound.
+    const F64 spawnCount = (F64)benchmark.getObjectCount() * (F64)benchmark.getIterations();
+    benchmark.addMetric( "spawnsPerSecond", spawnCount * 1000.0 / (F64)benchmark.getElapsedMilliseconds() );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, CloneSpawn )
+{
+    const U32 spawnCount = 10000;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+    Sprite* pTemplate = createSpawnTemplate();
+
+    benchmark.setObjectCount( spawnCount );
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 index = 0; index < spawnCount; ++index )
+        {
+            SceneObject* pSceneObject = static_cast<SceneObject*>( pTemplate->clone( true ) );
+            pSceneObject->setPosition( getRandomBenchmarkPosition( random ) );
+            pScene->addToScene( pSceneObject );
+        }
+
+        pScene->clearScene( true );
+    }
+
+    finishSpawnBenchmark( benchmark );
+
+    pTemplate->deleteObject();
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Scene, PrefabSpawn )
+{
+    const U32 spawnCount = 10000;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+    Sprite* pTemplate = createSpawnTemplate();
+
+    // Compile the prefab.
+    ScenePrefab* pPrefab = new ScenePrefab();
+    pPrefab->registerObject();
+    if ( !pPrefab->compile( pTemplate ) )
+        benchmark.fail( "Failed to compile the prefab." );
+
+    benchmark.setObjectCount( spawnCount );
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 index = 0; index < spawnCount; ++index )
+            pPrefab->instantiate( pScene, getRandomBenchmarkPosition( random ) );
+
+        pScene->clearScene( true );
+    }
+
+    finishSpawnBenchmark( benchmark );
+
+    pPrefab->deleteObject();
+    pTemplate->deleteObject();
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( WorldQuery, PickStorm )
+{
+    const U32 objectCount = 10000;
+    const U32 pickCount = 1000;
+
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+
+    // Create the static pick targets.
+    for ( U32 index = 0; index < objectCount; ++index )
+    {
+        Sprite* pSprite = createBenchmarkObject<Sprite>( pScene, getRandomBenchmarkPosition( random ), Vector2( 2.0f, 2.0f ), b2_staticBody );
+        pSprite->createPolygonBoxCollisionShape( 2.0f, 2.0f );
+    }
+
+    // Tick once so that the world query is up-to-date.
+    pScene->processTick();
+
+    // Generate the pick points up-front so they are identical for each iteration.
+    Vector<Vector2> pickPoints;
+    pickPoints.setSize( pickCount );
+    for ( U32 index = 0; index < pickCount; ++index )
+        pickPoints[index] = getRandomBenchmarkPosition( random );
+
+    benchmark.setObjectCount( pickCount * 4 );
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 index = 0; index < pickCount; ++index )
+        {
+            const Vector2& pickPoint = pickPoints[index];
+
+            // Pick point, area, circle and ray.
+            pScene->getWorldQuery( true )->anyQueryPoint( pickPoint );
+
+            b2AABB pickArea;
+            pickArea.lowerBound.Set( pickPoint.x - 10.0f, pickPoint.y - 10.0f );
+            pickArea.upperBound.Set( pickPoint.x + 10.0f, pickPoint.y + 10.0f );
+            pScene->getWorldQuery( true )->anyQueryAABB( pickArea );
+
+            pScene->getWorldQuery( true )->collisionQueryCircle( pickPoint, 10.0f );
+
+            pScene->getWorldQuery( true )->collisionQueryRay( pickPoint, pickPoint + Vector2( 50.0f, 50.0f ) );
+        }
+    }
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+static void runRenderSortBenchmark( Benchmark& benchmark, const SceneRenderQueue::RenderSort sortMode )
+{
+    RandomLCG random( BENCHMARK_SCENE_SEED );
+
+    Scene* pScene = createBenchmarkScene();
+
+    // Create the render objects, a quarter of which are batch isolated.
+    Vector<SceneObject*> renderObjects;
+    for ( U32 index = 0; index < BENCHMARK_RENDER_OBJECT_COUNT; ++index )
+    {
+        Sprite* pSprite = createBenchmarkObject<Sprite>( pScene, getRandomBenchmarkPosition( random ), Vector2( 1.0f, 1.0f ), b2_staticBody );
+        pSprite->setBatchIsolated( (index & 3) == 0 );
+        renderObjects.push_back( pSprite );
+    }
+
+    // Use a handful of render groups.
+    StringTableEntry renderGroups[4] = { StringTable->insert("Background"), StringTable->insert("Actors"), StringTable->insert("Effects"), StringTable->insert("Foreground") };
+
+    // Create the render requests.
+    SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();
+    for ( U32 index = 0; index < BENCHMARK_RENDER_REQUEST_COUNT; ++index )
+    {
+        pSceneRenderQueue->createRenderRequest()->set(
+            renderObjects[random.randI() % BENCHMARK_RENDER_OBJECT_COUNT],
+            getRandomBenchmarkPosition( random ),
+            random.randRangeF( -100.0f, 100.0f ),
+            Vector2::getZero(),
+            (S32)random.randI(),
+            renderGroups[random.randI() % 4] );
+    }
+
+    // Take a copy of the unsorted requests so each iteration sorts the same order.
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = pSceneRenderQueue->getRenderRequests();
+    SceneRenderQueue::typeRenderRequestVector unsortedRenderRequests( renderRequests );
+
+    pSceneRenderQueue->setSortMode( sortMode );
+
+    benchmark.setObjectCount( BENCHMARK_RENDER_REQUEST_COUNT );
+
+    while( benchmark.iterate() )
+    {
+        dMemcpy( renderRequests.address(), unsortedRenderRequests.address(), renderRequests.memSize() );
+        pSceneRenderQueue->sort();
+    }
+
+    SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
+
+    destroyBenchmarkScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( RenderSort, Newest )     { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_NEWEST ); }
+BENCHMARK( RenderSort, Oldest )     { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_OLDEST ); }
+BENCHMARK( RenderSort, Batch )      { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_BATCH ); }
+BENCHMARK( RenderSort, Group )      { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_GROUP ); }
+BENCHMARK( RenderSort, XAxis )      { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_XAXIS ); }
+BENCHMARK( RenderSort, YAxis )      { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_YAXIS ); }
+BENCHMARK( RenderSort, ZAxis )      { runRenderSortBenchmark( benchmark, SceneRenderQueue::RENDER_SORT_ZAXIS ); }
+
+#endif // TORQUE_SHIPPING
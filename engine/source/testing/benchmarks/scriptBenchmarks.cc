@@ -0,0 +1,199 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+#ifndef _CODEBLOCK_H_
+#include "console/codeBlock.h"
+#endif
+
+#ifndef _SCRIPT_IMAGE_H_
+#include "console/scriptImage.h"
+#endif
+
+#ifndef _RESMANAGER_H_
+#include "io/resource/resourceManager.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Script, FunctionCallStorm )
+{
+    const U32 callCount = 10000;
+
+    // Define the script function being called.
+    Con::evaluate( "function benchmarkScriptFunction( %a, %b ) { return %a + %b; }" );
+
+    benchmark.setObjectCount( callCount );
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 index = 0; index < callCount; ++index )
+            Con::executef( 3, "benchmarkScriptFunction", "1", "2" );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Script, UpdateCallbackStorm )
+{
+    const U32 spriteCount = 2000;
+
+    // Define the update callback.
+    Con::evaluate( "function BenchmarkUpdateSprite::onUpdate( %this ) { %this.updateCount++; }" );
+
+    // Create and register the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+
+    // Create sprites that each perform a script update callback.
+    for ( U32 index = 0; index < spriteCount; ++index )
+    {
+        Sprite* pSprite = new Sprite();
+        pSprite->setClassNamespace( "BenchmarkUpdateSprite" );
+        pSprite->registerObject();
+        pSprite->setUpdateCallback( true );
+        pScene->addToScene( pSprite );
+    }
+
+    benchmark.setObjectCount( spriteCount );
+
+    while( benchmark.iterate() )
+        pScene->processTick();
+
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+static void compileBenchmarkModuleScripts( Vector<StringTableEntry>& scriptFiles )
+{
+    char pathExpressionBuffer[1024];
+    dSprintf( pathExpressionBuffer, sizeof(pathExpressionBuffer), "%s/modules/*.cs", Platform::getMainDotCsDir() );
+
+    // Compile all the module scripts so that only loading is measured.
+    ResourceObject* pMatch = NULL;
+    const char* pMatchFile = NULL;
+    while ( (pMatch = ResourceManager->findMatch( pathExpressionBuffer, &pMatchFile, pMatch )) )
+    {
+        StringTableEntry scriptFile = StringTable->insert( pMatchFile );
+        Con::executef( 2, "compile", scriptFile );
+        scriptFiles.push_back( scriptFile );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Script, LoadModulesDso )
+{
+    Vector<StringTableEntry> scriptFiles;
+    compileBenchmarkModuleScripts( scriptFiles );
+
+    benchmark.setObjectCount( scriptFiles.size() );
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 index = 0; index < (U32)scriptFiles.size(); ++index )
+        {
+            char compiledFileBuffer[1024];
+            dSprintf( compiledFileBuffer, sizeof(compiledFileBuffer), "%s.dso", scriptFiles[index] );
+
+            Stream* pStream = ResourceManager->openStream( compiledFileBuffer );
+            if ( pStream == NULL )
+            {
+                benchmark.fail( "Could not open '%s'.", compiledFileBuffer );
+                return;
+            }
+
+            U32 version;
+            pStream->read( &version );
+            CodeBlock* pCodeBlock = new CodeBlock();
+            pCodeBlock->read( scriptFiles[index], *pStream );
+            ResourceManager->closeStream( pStream );
+            delete pCodeBlock;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Script, LoadModulesImage )
+{
+    char pathExpressionBuffer[1024];
+    dSprintf( pathExpressionBuffer, sizeof(pathExpressionBuffer), "%s/modules/*.cs", Platform::getMainDotCsDir() );
+
+    char imageFileBuffer[1024];
+    dSprintf( imageFileBuffer, sizeof(imageFileBuffer), "%s/BenchmarkModules.dsi", Platform::getTemporaryDirectory() );
+
+    // Build the image of all the module scripts.
+    U32 scriptCount;
+    U32 failedCount;
+    if ( !ScriptImage::build( imageFileBuffer, pathExpressionBuffer, scriptCount, failedCount ) )
+    {
+        benchmark.fail( "Could not build '%s'.", imageFileBuffer );
+        return;
+    }
+
+    Vector<StringTableEntry> scriptFiles;
+    ResourceObject* pMatch = NULL;
+    const char* pMatchFile = NULL;
+    while ( (pMatch = ResourceManager->findMatch( pathExpressionBuffer, &pMatchFile, pMatch )) )
+        scriptFiles.push_back( StringTable->insert( pMatchFile ) );
+
+    benchmark.setObjectCount( scriptFiles.size() );
+
+    while( benchmark.iterate() )
+    {
+        if ( !ScriptImage::load( imageFileBuffer ) )
+        {
+            benchmark.fail( "Could not load '%s'.", imageFileBuffer );
+            return;
+        }
+
+        for ( U32 index = 0; index < (U32)scriptFiles.size(); ++index )
+            delete ScriptImage::readCodeBlock( scriptFiles[index] );
+
+        ScriptImage::unload( imageFileBuffer );
+    }
+
+    benchmark.addMetric( "failed", (F64)failedCount );
+}
+
+#endif // TORQUE_SHIPPING
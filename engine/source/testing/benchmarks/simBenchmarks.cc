@@ -0,0 +1,218 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _SIM_FIELD_DICTIONARY_H_
+#include "sim/simFieldDictionary.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static const U32 dynamicFieldObjectCount = 1000;
+static const U32 dynamicFieldCount = 40;
+
+//-----------------------------------------------------------------------------
+
+static void createDynamicFieldNames( StringTableEntry* pFieldNames )
+{
+    char fieldName[32];
+
+    for ( U32 fieldIndex = 0; fieldIndex < dynamicFieldCount; ++fieldIndex )
+    {
+        dSprintf( fieldName, sizeof(fieldName), "benchmarkField%d", fieldIndex );
+        pFieldNames[fieldIndex] = StringTable->insert( fieldName );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void createDynamicFieldObjects( Vector<SimObject*>& objects, const StringTableEntry* pFieldNames )
+{
+    char fieldValue[32];
+
+    for ( U32 objectIndex = 0; objectIndex < dynamicFieldObjectCount; ++objectIndex )
+    {
+        SimObject* pObject = new SimObject();
+        pObject->registerObject();
+
+        // Use a mix of numeric and string values.
+        for ( U32 fieldIndex = 0; fieldIndex < dynamicFieldCount; ++fieldIndex )
+        {
+            if ( fieldIndex & 1 )
+                dSprintf( fieldValue, sizeof(fieldValue), "%d", objectIndex + fieldIndex );
+            else
+                dSprintf( fieldValue, sizeof(fieldValue), "value%d", fieldIndex );
+
+            pObject->setDataField( pFieldNames[fieldIndex], NULL, fieldValue );
+        }
+
+        objects.push_back( pObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void destroyDynamicFieldObjects( Vector<SimObject*>& objects )
+{
+    for ( U32 objectIndex = 0; objectIndex < (U32)objects.size(); ++objectIndex )
+        objects[objectIndex]->deleteObject();
+
+    objects.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Sim, DynamicFieldLookup )
+{
+    StringTableEntry fieldNames[dynamicFieldCount];
+    createDynamicFieldNames( fieldNames );
+
+    Vector<SimObject*> objects;
+    createDynamicFieldObjects( objects, fieldNames );
+
+    benchmark.setObjectCount( dynamicFieldObjectCount * dynamicFieldCount );
+
+    U32 valueLength = 0;
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 objectIndex = 0; objectIndex < dynamicFieldObjectCount; ++objectIndex )
+        {
+            SimObject* pObject = objects[objectIndex];
+
+            for ( U32 fieldIndex = 0; fieldIndex < dynamicFieldCount; ++fieldIndex )
+                valueLength += dStrlen( pObject->getDataField( fieldNames[fieldIndex], NULL ) );
+        }
+    }
+
+    if ( valueLength == 0 )
+        benchmark.fail( "Dynamic fields were not found." );
+
+    destroyDynamicFieldObjects( objects );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Sim, DynamicFieldNumericRead )
+{
+    StringTableEntry fieldNames[dynamicFieldCount];
+    createDynamicFieldNames( fieldNames );
+
+    Vector<SimObject*> objects;
+    createDynamicFieldObjects( objects, fieldNames );
+
+    benchmark.setObjectCount( dynamicFieldObjectCount * (dynamicFieldCount / 2) );
+
+    F32 total = 0.0f;
+
+    while( benchmark.iterate() )
+    {
+        for ( U32 objectIndex = 0; objectIndex < dynamicFieldObjectCount; ++objectIndex )
+        {
+            SimObject* pObject = objects[objectIndex];
+
+            // Read the numeric fields as the script interpreter does.
+            for ( U32 fieldIndex = 1; fieldIndex < dynamicFieldCount; fieldIndex += 2 )
+                total += pObject->getDataFieldFloat( fieldNames[fieldIndex], NULL );
+        }
+    }
+
+    if ( total <= 0.0f )
+        benchmark.fail( "Numeric dynamic fields were not read." );
+
+    destroyDynamicFieldObjects( objects );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Sim, DynamicFieldSet )
+{
+    StringTableEntry fieldNames[dynamicFieldCount];
+    createDynamicFieldNames( fieldNames );
+
+    Vector<SimObject*> objects;
+    createDynamicFieldObjects( objects, fieldNames );
+
+    benchmark.setObjectCount( dynamicFieldObjectCount * dynamicFieldCount );
+
+    char fieldValue[32];
+    U32 iteration = 0;
+
+    while( benchmark.iterate() )
+    {
+        dSprintf( fieldValue, sizeof(fieldValue), "%d", iteration++ );
+
+        for ( U32 objectIndex = 0; objectIndex < dynamicFieldObjectCount; ++objectIndex )
+        {
+            SimObject* pObject = objects[objectIndex];
+
+            for ( U32 fieldIndex = 0; fieldIndex < dynamicFieldCount; ++fieldIndex )
+                pObject->setDataField( fieldNames[fieldIndex], NULL, fieldValue );
+        }
+    }
+
+    destroyDynamicFieldObjects( objects );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Sim, DynamicFieldCreate )
+{
+    StringTableEntry fieldNames[dynamicFieldCount];
+    createDynamicFieldNames( fieldNames );
+
+    benchmark.setObjectCount( dynamicFieldObjectCount * dynamicFieldCount );
+    benchmark.setIterations( getMax( benchmark.getIterations() / 10, (U32)1 ) );
+
+    Vector<SimObject*> objects;
+    F64 footprint = 0.0;
+
+    while( benchmark.iterate() )
+    {
+        createDynamicFieldObjects( objects, fieldNames );
+
+        // Measure the dictionary footprint.
+        footprint = 0.0;
+        for ( U32 objectIndex = 0; objectIndex < (U32)objects.size(); ++objectIndex )
+            footprint += objects[objectIndex]->getFieldDictionary()->getMemoryFootprint();
+
+        destroyDynamicFieldObjects( objects );
+    }
+
+    benchmark.addMetric( "dictionaryBytesPerObject", footprint / (F64)dynamicFieldObjectCount );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,338 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_TESTING_H_
+#include "testing/benchmarkTesting.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+#ifndef _TAML_XMLDOCUMENT_H_
+#include "persistence/taml/xml/tamlXmlDocument.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BENCHMARK_TAML_OBJECT_COUNT         1000
+#define BENCHMARK_TAML_LARGE_OBJECT_COUNT   100000
+
+//-----------------------------------------------------------------------------
+
+static Scene* createBenchmarkTamlScene( const U32 objectCount = BENCHMARK_TAML_OBJECT_COUNT )
+{
+    // Create and register the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+
+    // Populate the scene with sprites that each have a collision shape and some dynamic fields.
+    for ( U32 index = 0; index < objectCount; ++index )
+    {
+        Sprite* pSprite = new Sprite();
+        pSprite->registerObject();
+        pSprite->setBodyType( b2_dynamicBody );
+        pSprite->setPosition( Vector2( (F32)(index % 100), (F32)(index / 100) ) );
+        pSprite->setSize( Vector2( 1.0f, 1.0f ) );
+        pSprite->createPolygonBoxCollisionShape( 1.0f, 1.0f );
+        pSprite->setDataField( StringTable->insert( "Health" ), NULL, "100" );
+        pSprite->setDataField( StringTable->insert( "Team" ), NULL, "Red" );
+        pScene->addToScene( pSprite );
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static void destroyBenchmarkTamlScene( Scene* pScene )
+{
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+static void getBenchmarkTamlFilename( char* pFilenameBuffer, const U32 bufferSize, const char* pExtension )
+{
+    // Use the temporary directory for the benchmark files.
+    dSprintf( pFilenameBuffer, bufferSize, "%s/BenchmarkScene.%s", Platform::getTemporaryDirectory(), pExtension );
+}
+
+//-----------------------------------------------------------------------------
+
+static void benchmarkTamlWrite( Benchmark& benchmark, const char* pExtension )
+{
+    char filenameBuffer[1024];
+    getBenchmarkTamlFilename( filenameBuffer, sizeof(filenameBuffer), pExtension );
+    const char* pFilename = filenameBuffer;
+
+    Scene* pScene = createBenchmarkTamlScene();
+
+    Taml taml;
+
+    benchmark.setObjectCount( BENCHMARK_TAML_OBJECT_COUNT );
+
+    while( benchmark.iterate() )
+    {
+        if ( !taml.write( pScene, pFilename ) )
+        {
+            benchmark.fail( "Could not write '%s'.", pFilename );
+            break;
+        }
+    }
+
+    destroyBenchmarkTamlScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+static void benchmarkTamlRead( Benchmark& benchmark, const char* pExtension )
+{
+    char filenameBuffer[1024];
+    getBenchmarkTamlFilename( filenameBuffer, sizeof(filenameBuffer), pExtension );
+    const char* pFilename = filenameBuffer;
+
+    Taml taml;
+
+    // Write the scene to be read.
+    Scene* pScene = createBenchmarkTamlScene();
+    const bool written = taml.write( pScene, pFilename );
+    destroyBenchmarkTamlScene( pScene );
+
+    if ( !written )
+    {
+        benchmark.fail( "Could not write '%s'.", pFilename );
+        return;
+    }
+
+    benchmark.setObjectCount( BENCHMARK_TAML_OBJECT_COUNT );
+
+    while( benchmark.iterate() )
+    {
+        // Read the scene.
+        Scene* pReadScene = taml.read<Scene>( pFilename );
+
+        if ( pReadScene == NULL )
+        {
+            benchmark.fail( "Could not read '%s'.", pFilename );
+            break;
+        }
+
+        destroyBenchmarkTamlScene( pReadScene );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, WriteXml )
+{
+    benchmarkTamlWrite( benchmark, "scene.taml" );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, ReadXml )
+{
+    benchmarkTamlRead( benchmark, "scene.taml" );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, WriteBinary )
+{
+    benchmarkTamlWrite( benchmark, "scene.baml" );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, ReadBinary )
+{
+    benchmarkTamlRead( benchmark, "scene.baml" );
+}
+
+//-----------------------------------------------------------------------------
+
+static void benchmarkTamlLargeWrite( Benchmark& benchmark, const bool incremental )
+{
+    char filenameBuffer[1024];
+    getBenchmarkTamlFilename( filenameBuffer, sizeof(filenameBuffer), "large.baml" );
+    const char* pFilename = filenameBuffer;
+
+    Scene* pScene = createBenchmarkTamlScene( BENCHMARK_TAML_LARGE_OBJECT_COUNT );
+
+    Taml taml;
+
+    benchmark.setObjectCount( BENCHMARK_TAML_LARGE_OBJECT_COUNT );
+
+    MemoryTagStats stats;
+    U32 peakBytes = 0;
+    U32 longestStall = 0;
+    U32 sliceCount = 0;
+
+    while( benchmark.iterate() )
+    {
+        // Only measure the memory used by the save.
+        dResetMemoryTagPeak( MemoryTag_Taml );
+        dGetMemoryTagStats( MemoryTag_Taml, stats );
+        const U32 startBytes = stats.mLiveBytes;
+
+        bool status;
+
+        if ( incremental )
+        {
+            taml.writeIncremental( pScene, pFilename );
+
+            // Process the slices as the frame scheduler would.
+            sliceCount = 0;
+            longestStall = 0;
+            while ( taml.isWritingIncremental() )
+            {
+                const U32 sliceStartTime = Platform::getRealMilliseconds();
+                if ( taml.processIdleTask() )
+                    sliceCount++;
+                longestStall = getMax( longestStall, Platform::getRealMilliseconds() - sliceStartTime );
+            }
+
+            status = taml.getIncrementalStatus();
+        }
+        else
+        {
+            const U32 writeStartTime = Platform::getRealMilliseconds();
+            status = taml.write( pScene, pFilename );
+            longestStall = Platform::getRealMilliseconds() - writeStartTime;
+            sliceCount = 1;
+        }
+
+        if ( !status )
+        {
+            benchmark.fail( "Could not write '%s'.", pFilename );
+            break;
+        }
+
+        dGetMemoryTagStats( MemoryTag_Taml, stats );
+        peakBytes = stats.mPeakBytes - startBytes;
+    }
+
+    benchmark.addMetric( "peakKB", peakBytes / 1024.0 );
+    benchmark.addMetric( "longestStallMs", longestStall );
+    benchmark.addMetric( "slices", sliceCount );
+
+    destroyBenchmarkTamlScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, LargeWriteBinary )
+{
+    benchmarkTamlLargeWrite( benchmark, false );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, LargeWriteBinaryIncremental )
+{
+    benchmarkTamlLargeWrite( benchmark, true );
+}
+
+//-----------------------------------------------------------------------------
+
+static void benchmarkTamlParseModules( Benchmark& benchmark, const bool inSitu )
+{
+    // Find the Taml XML files in the modules tree.
+    char modulesPathBuffer[1024];
+    dSprintf( modulesPathBuffer, sizeof(modulesPathBuffer), "%s/modules", Platform::getMainDotCsDir() );
+
+    Vector<Platform::FileInfo> files;
+    Platform::dumpPath( modulesPathBuffer, files );
+
+    Vector<StringTableEntry> tamlFiles;
+    for ( U32 index = 0; index < (U32)files.size(); ++index )
+    {
+        const char* pExtension = dStrrchr( files[index].pFileName, '.' );
+
+        if ( pExtension == NULL || dStricmp( pExtension, ".taml" ) != 0 )
+            continue;
+
+        char filenameBuffer[1024];
+        dSprintf( filenameBuffer, sizeof(filenameBuffer), "%s/%s", files[index].pFullPath, files[index].pFileName );
+        tamlFiles.push_back( StringTable->insert( filenameBuffer ) );
+    }
+
+    if ( tamlFiles.size() == 0 )
+    {
+        benchmark.fail( "No Taml XML files found in '%s'.", modulesPathBuffer );
+        return;
+    }
+
+    benchmark.setObjectCount( tamlFiles.size() );
+
+    TamlXmlDocument xmlDocument;
+    U32 elementCount = 0;
+
+    while( benchmark.iterate() )
+    {
+        elementCount = 0;
+
+        for ( U32 index = 0; index < (U32)tamlFiles.size(); ++index )
+        {
+            FileStream stream;
+
+            if ( !stream.open( tamlFiles[index], FileStream::Read ) || !xmlDocument.load( stream, inSitu ) )
+            {
+                benchmark.fail( "Could not parse '%s'.", tamlFiles[index] );
+                return;
+            }
+
+            elementCount += xmlDocument.getElementCount();
+        }
+    }
+
+    benchmark.addMetric( "elements", elementCount );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, ParseModulesXmlInSitu )
+{
+    benchmarkTamlParseModules( benchmark, true );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Taml, ParseModulesXmlTinyXml )
+{
+    benchmarkTamlParseModules( benchmark, false );
+}
+
+#endif // TORQUE_SHIPPING
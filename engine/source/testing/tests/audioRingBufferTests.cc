@@ -0,0 +1,88 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _AUDIORINGBUFFER_H_
+#include "audio/audioRingBuffer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioRingBufferTests, CapacityTest )
+{
+    AudioRingBuffer ringBuffer;
+
+    // Check the capacity is rounded up to a power of two.
+    ringBuffer.allocate( 100 );
+    ASSERT_EQ( ringBuffer.getCapacity(), 128U );
+    ASSERT_EQ( ringBuffer.getReadAvailable(), 0U );
+    ASSERT_EQ( ringBuffer.getWriteAvailable(), 128U );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioRingBufferTests, WrapTest )
+{
+    AudioRingBuffer ringBuffer;
+    ringBuffer.allocate( 16 );
+
+    U8 writeData[16];
+    U8 readData[16];
+    U8 nextWrite = 0;
+    U8 nextRead = 0;
+
+    // Write and read uneven chunks so that the positions wrap around the buffer.
+    for ( U32 iteration = 0; iteration < 100; ++iteration )
+    {
+        const U32 writeSize = 1 + (iteration % 11);
+        for ( U32 index = 0; index < writeSize; ++index )
+            writeData[index] = nextWrite + (U8)index;
+
+        const U32 written = ringBuffer.write( writeData, writeSize );
+        ASSERT_LE( written, writeSize );
+        nextWrite += (U8)written;
+
+        const U32 readSize = 1 + (iteration % 7);
+        const U32 read = ringBuffer.read( readData, readSize );
+        ASSERT_LE( read, readSize );
+
+        // Check the bytes arrive in order.
+        for ( U32 index = 0; index < read; ++index )
+        {
+            ASSERT_EQ( readData[index], nextRead++ );
+        }
+
+        ASSERT_EQ( ringBuffer.getReadAvailable() + ringBuffer.getWriteAvailable(), ringBuffer.getCapacity() );
+    }
+
+    // Check a reset empties the buffer.
+    ringBuffer.reset();
+    ASSERT_EQ( ringBuffer.getReadAvailable(), 0U );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static void submitTestQuad( BatchRender& batchRenderer, TextureHandle& texture, const F32 offset )
+{
+    batchRenderer.SubmitQuad(
+        Vector2( offset, 0.0f ), Vector2( offset + 1.0f, 0.0f ), Vector2( offset + 1.0f, 1.0f ), Vector2( offset, 1.0f ),
+        Vector2( 0.0f, 1.0f ), Vector2( 1.0f, 1.0f ), Vector2( 1.0f, 0.0f ), Vector2( 0.0f, 0.0f ),
+        texture );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderStreamTests, ConsecutiveQuadsAreRecordedTogether )
+{
+    BatchRenderStream renderStream;
+    BatchRender recordingRenderer( &renderStream );
+    ASSERT_TRUE( recordingRenderer.getRecording() );
+
+    TextureHandle textureA;
+    TextureHandle textureB;
+
+    // Quads with the same texture and color should share a command.
+    renderStream.beginSegment();
+    submitTestQuad( recordingRenderer, textureA, 0.0f );
+    submitTestQuad( recordingRenderer, textureA, 1.0f );
+    submitTestQuad( recordingRenderer, textureA, 2.0f );
+    ASSERT_EQ( (U32)1, renderStream.getCommandCount() );
+
+    // A texture change or a state change should start a new command.
+    submitTestQuad( recordingRenderer, textureB, 3.0f );
+    ASSERT_EQ( (U32)2, renderStream.getCommandCount() );
+    recordingRenderer.setBlendOff();
+    submitTestQuad( recordingRenderer, textureB, 4.0f );
+    ASSERT_EQ( (U32)4, renderStream.getCommandCount() );
+
+    // Quads should never be merged across segments.
+    const U32 segmentStart = renderStream.beginSegment();
+    ASSERT_EQ( (U32)4, segmentStart );
+    submitTestQuad( recordingRenderer, textureB, 5.0f );
+    ASSERT_EQ( (U32)5, renderStream.getCommandCount() );
+
+    renderStream.clear();
+    ASSERT_EQ( (U32)0, renderStream.getCommandCount() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderStreamTests, RecordingDoesNotBatch )
+{
+    BatchRenderStream renderStream;
+    BatchRender recordingRenderer( &renderStream );
+
+    TextureHandle texture;
+    submitTestQuad( recordingRenderer, texture, 0.0f );
+
+    // Flushes should be recorded rather than counted.
+    recordingRenderer.flush( recordingRenderer.getDebugStats()->batchColorStateFlush );
+    recordingRenderer.flush();
+    ASSERT_EQ( (U32)3, renderStream.getCommandCount() );
+    ASSERT_EQ( (U32)0, renderStream.getDebugStats()->batchColorStateFlush );
+    ASSERT_EQ( (U32)0, renderStream.getDebugStats()->batchAnonymousFlush );
+    ASSERT_EQ( (U32)0, renderStream.getDebugStats()->batchTrianglesSubmitted );
+}
+
+#endif // TORQUE_SHIPPING
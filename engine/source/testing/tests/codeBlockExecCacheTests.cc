@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _CONSOLEINTERNAL_H_
+#include "console/consoleInternal.h"
+#endif
+
+#ifndef _CODEBLOCK_H_
+#include "console/codeBlock.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockExecCacheTests, IdenticalScriptsHitTheCache )
+{
+    CodeBlock::clearExecCache();
+    const U32 hits = CodeBlock::smExecCacheHits;
+    const U32 misses = CodeBlock::smExecCacheMisses;
+
+    Con::evaluate( "$ExecCacheTest = 1 + 2;" );
+    Con::evaluate( "$ExecCacheTest = 1 + 2;" );
+
+    ASSERT_EQ( misses + 1, CodeBlock::smExecCacheMisses );
+    ASSERT_EQ( hits + 1, CodeBlock::smExecCacheHits );
+    ASSERT_EQ( 3, Con::getIntVariable( "$ExecCacheTest" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockExecCacheTests, RedefiningFunctionsInvalidatesTheCache )
+{
+    CodeBlock::clearExecCache();
+
+    Con::evaluate( "function execCacheTestFunction() { return 1; }" );
+    Con::evaluate( "$ExecCacheTest = execCacheTestFunction();" );
+    ASSERT_EQ( 1, Con::getIntVariable( "$ExecCacheTest" ) );
+
+    // Redefine the function the cached script resolved.
+    const U32 invalidations = CodeBlock::smExecCacheInvalidations;
+    Con::evaluate( "function execCacheTestFunction() { return 2; }" );
+    Con::evaluate( "$ExecCacheTest = execCacheTestFunction();" );
+
+    ASSERT_EQ( invalidations + 1, CodeBlock::smExecCacheInvalidations );
+    ASSERT_EQ( 2, Con::getIntVariable( "$ExecCacheTest" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockExecCacheTests, LeastRecentlyUsedScriptsAreEvicted )
+{
+    CodeBlock::clearExecCache();
+    const S32 cacheSize = CodeBlock::smExecCacheSize;
+    CodeBlock::smExecCacheSize = 2;
+
+    const U32 evictions = CodeBlock::smExecCacheEvictions;
+    Con::evaluate( "$ExecCacheTest = 1;" );
+    Con::evaluate( "$ExecCacheTest = 2;" );
+    Con::evaluate( "$ExecCacheTest = 1;" );
+    Con::evaluate( "$ExecCacheTest = 3;" );
+    ASSERT_EQ( evictions + 1, CodeBlock::smExecCacheEvictions );
+
+    // The most recently used script should still be cached.
+    const U32 hits = CodeBlock::smExecCacheHits;
+    Con::evaluate( "$ExecCacheTest = 1;" );
+    ASSERT_EQ( hits + 1, CodeBlock::smExecCacheHits );
+
+    CodeBlock::smExecCacheSize = cacheSize;
+    CodeBlock::clearExecCache();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _FRAME_SCHEDULER_H_
+#include "game/frameScheduler.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+#ifndef _SIM_OBJECT_H_
+#include "sim/simObject.h"
+#endif
+
+#ifndef _SIM_EVENT_H_
+#include "sim/simEvent.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class CountingIdleTask : public FrameIdleTask
+{
+public:
+    CountingIdleTask( const U32 workCount ) : mWorkCount( workCount ), mSliceCount( 0 ) {}
+
+    virtual bool processIdleTask( void )
+    {
+        mSliceCount++;
+        if ( mWorkCount > 0 )
+            mWorkCount--;
+        return mWorkCount > 0;
+    }
+
+    U32 mWorkCount;
+    U32 mSliceCount;
+};
+
+//-----------------------------------------------------------------------------
+
+class CountingIdleEvent : public SimEvent
+{
+public:
+    CountingIdleEvent( U32& processCount, U32& deleteCount ) : mProcessCount( processCount ), mDeleteCount( deleteCount ) {}
+    virtual ~CountingIdleEvent() { mDeleteCount++; }
+
+    virtual void process( SimObject* object ) { mProcessCount++; }
+
+    U32& mProcessCount;
+    U32& mDeleteCount;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameSchedulerTests, LimitElapsedTime )
+{
+    const S32 previousMaxCatchUpTicks = Con::getIntVariable( "$pref::Game::MaxCatchUpTicks" );
+    Con::setIntVariable( "$pref::Game::MaxCatchUpTicks", 4 );
+
+    const U32 maxElapsedTime = 4 * Tickable::smTickMs;
+    const U32 startDroppedTime = FrameScheduler::getDroppedTime();
+
+    // Check short frames are not limited.
+    ASSERT_EQ( Tickable::smTickMs, FrameScheduler::limitElapsedTime( Tickable::smTickMs ) ) << "Elapsed time should not be limited.";
+    ASSERT_EQ( startDroppedTime, FrameScheduler::getDroppedTime() ) << "Dropped time is incorrect.";
+
+    // Check long frames are limited and the dropped time recorded.
+    ASSERT_EQ( maxElapsedTime, FrameScheduler::limitElapsedTime( maxElapsedTime + 100 ) ) << "Elapsed time was not limited.";
+    ASSERT_EQ( startDroppedTime + 100, FrameScheduler::getDroppedTime() ) << "Dropped time is incorrect.";
+
+    Con::setIntVariable( "$pref::Game::MaxCatchUpTicks", previousMaxCatchUpTicks );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameSchedulerTests, TimingHistogram )
+{
+    const U32 startFrameCount = FrameScheduler::getFrameCount();
+    const U32 startZeroCount = FrameScheduler::getHistogramCount( FrameScheduler::FrameTiming, 0 );
+    const U32 startFiveCount = FrameScheduler::getHistogramCount( FrameScheduler::FrameTiming, 3 );
+    const U32 startLongCount = FrameScheduler::getHistogramCount( FrameScheduler::FrameTiming, FrameScheduler::HistogramBucketCount-1 );
+
+    // Check the timings land in the power-of-two buckets.
+    FrameScheduler::recordTiming( FrameScheduler::FrameTiming, 0 );
+    FrameScheduler::recordTiming( FrameScheduler::FrameTiming, 5 );
+    FrameScheduler::recordTiming( FrameScheduler::FrameTiming, 1000 );
+
+    ASSERT_EQ( startZeroCount + 1, FrameScheduler::getHistogramCount( FrameScheduler::FrameTiming, 0 ) ) << "Histogram bucket is incorrect.";
+    ASSERT_EQ( startFiveCount + 1, FrameScheduler::getHistogramCount( FrameScheduler::FrameTiming, 3 ) ) << "Histogram bucket is incorrect.";
+    ASSERT_EQ( startLongCount + 1, FrameScheduler::getHistogramCount( FrameScheduler::FrameTiming, FrameScheduler::HistogramBucketCount-1 ) ) << "Histogram bucket is incorrect.";
+    ASSERT_EQ( startFrameCount + 3, FrameScheduler::getFrameCount() ) << "Frame count is incorrect.";
+
+    // Check the category names.
+    ASSERT_EQ( FrameScheduler::RenderTiming, FrameScheduler::getTimingCategoryEnum( "render" ) ) << "Timing category is incorrect.";
+    ASSERT_EQ( FrameScheduler::TimingCategoryCount, FrameScheduler::getTimingCategoryEnum( "invalid" ) ) << "Timing category is incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameSchedulerTests, IdleTasks )
+{
+    CountingIdleTask idleTask( 3 );
+    FrameScheduler::addIdleTask( &idleTask );
+
+    // Check the work is completed across the frames.
+    for ( U32 frame = 0; frame < 10 && idleTask.mWorkCount > 0; ++frame )
+        FrameScheduler::processIdleTasks( Platform::getRealMilliseconds() );
+
+    ASSERT_EQ( 0, idleTask.mWorkCount ) << "Idle work was not completed.";
+
+    // Check a task without work is not processed repeatedly.
+    const U32 sliceCount = idleTask.mSliceCount;
+    FrameScheduler::processIdleTasks( Platform::getRealMilliseconds() );
+    ASSERT_GE( sliceCount + 1, idleTask.mSliceCount ) << "Idle task was processed repeatedly.";
+
+    FrameScheduler::removeIdleTask( &idleTask );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameSchedulerTests, IdleEventsForDeletedObjects )
+{
+    SimObject* pObject = new SimObject();
+    ASSERT_TRUE( pObject->registerObject() );
+
+    U32 processCount = 0;
+    U32 deleteCount = 0;
+    const U32 startEventCount = FrameScheduler::getIdleEventCount();
+    FrameScheduler::postIdleEvent( pObject, new CountingIdleEvent( processCount, deleteCount ) );
+    ASSERT_EQ( startEventCount + 1, FrameScheduler::getIdleEventCount() );
+
+    // Check the event is discarded without being processed once its object is deleted.
+    pObject->deleteObject();
+    FrameScheduler::processIdleTasks( Platform::getRealMilliseconds() );
+    ASSERT_EQ( (U32)0, processCount ) << "Idle event was processed for a deleted object.";
+    ASSERT_EQ( (U32)1, deleteCount ) << "Idle event was not deleted.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _GAMEINTERFACE_H_
+#include "game/gameInterface.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define GAME_UNITTEST_JOURNAL_FILE      "_unitTestJournal_RemoveMe.jrn"
+#define GAME_UNITTEST_JOURNAL_DATA      "Journal data."
+
+//-----------------------------------------------------------------------------
+
+TEST( GameJournalTests, RecordAndPlayback )
+{
+    const S32 previousSeed = gRandGen.getSeed();
+    gRandGen.setSeed( 1234 );
+
+    // Record some values.
+    Game->saveJournal( GAME_UNITTEST_JOURNAL_FILE );
+    ASSERT_TRUE( Game->isJournalWriting() ) << "Journal was not opened for writing.";
+
+    const U32 expectedRandom = gRandGen.randI();
+    Game->journalWrite( 42 );
+    Game->journalWrite( sizeof(GAME_UNITTEST_JOURNAL_DATA), GAME_UNITTEST_JOURNAL_DATA );
+
+    // Play the journal back.
+    Game->playJournal( GAME_UNITTEST_JOURNAL_FILE );
+    ASSERT_TRUE( Game->isJournalReading() ) << "Journal was not opened for reading.";
+    ASSERT_FALSE( Game->isJournalHeadless() ) << "Journal should not be headless.";
+
+    // Check the random state was restored.
+    ASSERT_EQ( expectedRandom, gRandGen.randI() ) << "Random state was not restored.";
+
+    // Check the values are read back.
+    U32 value = 0;
+    Game->journalRead( &value );
+    ASSERT_EQ( 42, value ) << "Journal value is incorrect.";
+
+    char buffer[sizeof(GAME_UNITTEST_JOURNAL_DATA)];
+    Game->journalRead( sizeof(buffer), buffer );
+    ASSERT_STREQ( GAME_UNITTEST_JOURNAL_DATA, buffer ) << "Journal data is incorrect.";
+
+    // Check reading a value that was not recorded stops the playback.
+    Game->journalRead( &value );
+    ASSERT_FALSE( Game->isJournalReading() ) << "Playback did not stop.";
+    ASSERT_EQ( 0, value ) << "Journal value is incorrect.";
+
+    gRandGen.setSeed( previousSeed );
+    ASSERT_TRUE( Platform::fileDelete( GAME_UNITTEST_JOURNAL_FILE ) );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,112 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PACK_ARCHIVE_H_
+#include "io/resource/packArchive.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PACK_UNITTEST_SOURCE_PATH   "_unitTestPack_RemoveMe"
+#define PACK_UNITTEST_PACK_FILE     "_unitTestPack_RemoveMe.pak"
+
+//-----------------------------------------------------------------------------
+
+static void writePackTestFile( const char* pFilename, const void* pData, const U32 size )
+{
+    FileStream fileStream;
+    ASSERT_TRUE( fileStream.open( pFilename, FileStream::Write ) ) << "Failed to open pack source file for writing.";
+    ASSERT_TRUE( fileStream.write( size, pData ) ) << "Failed to write pack source file.";
+    fileStream.close();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PackArchiveTests, BuildReadRoundTrip )
+{
+    // A compressible file and a small incompressible one.
+    char repetitive[8192];
+    for ( U32 index = 0; index < sizeof(repetitive); ++index )
+        repetitive[index] = 'a' + (index % 7);
+
+    U8 noise[100];
+    for ( U32 index = 0; index < sizeof(noise); ++index )
+        noise[index] = (U8)((index * 2654435761U) >> 13);
+
+    ASSERT_TRUE( Platform::createPath( PACK_UNITTEST_SOURCE_PATH "/sub/" ) );
+    writePackTestFile( PACK_UNITTEST_SOURCE_PATH "/repetitive.txt", repetitive, sizeof(repetitive) );
+    writePackTestFile( PACK_UNITTEST_SOURCE_PATH "/sub/noise.bin", noise, sizeof(noise) );
+
+    ASSERT_TRUE( PackArchive::buildArchive( PACK_UNITTEST_PACK_FILE, PACK_UNITTEST_SOURCE_PATH ) );
+
+    PackArchive pack;
+    ASSERT_TRUE( pack.openArchive( PACK_UNITTEST_PACK_FILE ) );
+    ASSERT_EQ( pack.getEntryCount(), (U32)2 );
+
+    // Check the lookup ignores case and slash direction.
+    const PackArchive::Entry* pRepetitive = pack.findEntry( "Repetitive.TXT" );
+    const PackArchive::Entry* pNoise = pack.findEntry( "sub\\noise.bin" );
+    ASSERT_TRUE( pRepetitive != NULL );
+    ASSERT_TRUE( pNoise != NULL );
+    ASSERT_TRUE( pack.findEntry( "missing.txt" ) == NULL );
+
+    // Check the storage method and alignment.
+    ASSERT_EQ( pRepetitive->mMethod, (U32)PackArchive::Deflated );
+    ASSERT_LT( pRepetitive->mStoredSize, pRepetitive->mSize );
+    ASSERT_EQ( pNoise->mMethod, (U32)PackArchive::Stored );
+    ASSERT_EQ( pRepetitive->mOffset % PackArchive::EntryAlignment, (U32)0 );
+    ASSERT_EQ( pNoise->mOffset % PackArchive::EntryAlignment, (U32)0 );
+
+    // Check the contents.
+    Stream* pStream = pack.openEntryForRead( pRepetitive );
+    ASSERT_TRUE( pStream != NULL );
+    ASSERT_EQ( pStream->getStreamSize(), (U32)sizeof(repetitive) );
+    char repetitiveRead[sizeof(repetitive)];
+    ASSERT_TRUE( pStream->read( sizeof(repetitiveRead), repetitiveRead ) );
+    ASSERT_EQ( dMemcmp( repetitive, repetitiveRead, sizeof(repetitive) ), 0 );
+    delete pStream;
+
+    pStream = pack.openEntryForRead( pNoise );
+    ASSERT_TRUE( pStream != NULL );
+    U8 noiseRead[sizeof(noise)];
+    ASSERT_TRUE( pStream->read( sizeof(noiseRead), noiseRead ) );
+    ASSERT_EQ( dMemcmp( noise, noiseRead, sizeof(noise) ), 0 );
+    delete pStream;
+
+    pack.closeArchive();
+
+    ASSERT_TRUE( Platform::fileDelete( PACK_UNITTEST_PACK_FILE ) );
+    ASSERT_TRUE( Platform::deleteDirectory( PACK_UNITTEST_SOURCE_PATH ) );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_FIELD_H_
+#include "2d/assets/ParticleAssetField.h"
+#endif
+
+#ifndef _MMATH_H_
+#include "math/mMath.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, ConstantFieldHasNoBakedSamples )
+{
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 10.0f, 2.0f );
+    field.setValueScale( 2.0f );
+
+    // A single key should not need a lookup-table.
+    ASSERT_EQ( 0, field.getBakedSampleCount() );
+    ASSERT_EQ( 0, field.getBakedMemory() );
+    ASSERT_FLOAT_EQ( 4.0f, field.getFieldValue( 0.0f ) );
+    ASSERT_FLOAT_EQ( 4.0f, field.getFieldValue( 0.5f ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, BakedFieldMatchesExactEvaluation )
+{
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 1.0f, 0.0f );
+    field.addDataKey( 0.25f, 1.0f );
+    field.addDataKey( 0.5f, 0.5f );
+    field.addDataKey( 1.0f, 0.0f );
+
+    // Keys on the sample grid should bake exactly at the minimum resolution.
+    ASSERT_EQ( (U32)ParticleAssetField::BakedIntervalsMin + 1, field.getBakedSampleCount() );
+    ASSERT_FLOAT_EQ( 0.0f, field.getBakedError() );
+
+    for ( U32 step = 0; step <= 1000; ++step )
+    {
+        const F32 time = (F32)step / 1000.0f;
+        ASSERT_NEAR( field.getFieldValueExact( time ), field.getFieldValue( time ), 1e-5f );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, BakedFieldRefinesSharpKeys )
+{
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 1.0f, 0.0f );
+    field.addDataKey( 3.0f / 1024.0f, 1.0f );
+    field.addDataKey( 1.0f, 1.0f );
+
+    // A key between samples should raise the resolution to bound the error.
+    ASSERT_EQ( (U32)ParticleAssetField::BakedIntervalsMax + 1, field.getBakedSampleCount() );
+    ASSERT_FLOAT_EQ( 0.0f, field.getBakedError() );
+    ASSERT_GE( field.getBakedMemory(), field.getBakedSampleCount() * sizeof(F32) );
+
+    for ( U32 step = 0; step <= 1000; ++step )
+    {
+        const F32 time = (F32)step / 1000.0f;
+        ASSERT_NEAR( field.getFieldValueExact( time ), field.getFieldValue( time ), field.getBakedError() + 1e-5f );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, BakedFieldRepeatsAndRebakes )
+{
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 1.0f, 0.0f );
+    field.addDataKey( 1.0f, 1.0f );
+    field.setRepeatTime( 3.0f );
+
+    for ( U32 step = 0; step <= 100; ++step )
+    {
+        const F32 time = (F32)step / 100.0f;
+        ASSERT_NEAR( field.getFieldValueExact( time ), field.getFieldValue( time ), 1e-5f );
+    }
+
+    // Changing a key must refresh the baked curve.
+    field.setDataKeyValue( 1, 0.5f );
+    field.setValueScale( 2.0f );
+    ASSERT_NEAR( 0.5f, field.getFieldValue( 0.5f / 3.0f ), 1e-5f );
+    ASSERT_NEAR( field.getFieldValueExact( 0.3f ), field.getFieldValue( 0.3f ), 1e-5f );
+}
+
+#endif // TORQUE_SHIPPING
@@ -165,4 +165,113 @@ TEST( PlatformMemoryTests, dMemcmpTest )
     ASSERT_GT( 0, result3 ) << "Memory compare is incorrect.";
 }
 
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, dGetAllocationCountTest )
+{
+    // Fetch the current allocation count.
+    const U32 startCount = dGetAllocationCount();
+
+    // Allocate, reallocate and free some memory.
+    void* pResult = dMalloc_r( PLATFORM_UNITTEST_MEMORY_BUFFERSIZE, __FILE__, __LINE__ );
+    pResult = dRealloc_r( pResult, PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 2, __FILE__, __LINE__ );
+    dFree( pResult );
+
+    // Check.
+    ASSERT_EQ( startCount + 2, dGetAllocationCount() ) << "Allocation count is incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, MemoryTagStatsTest )
+{
+    // Allocate under a specific tag.
+    MemoryTagScope memoryTagScope( MemoryTag_Network );
+
+    MemoryTagStats startStats;
+    dGetMemoryTagStats( MemoryTag_Network, startStats );
+
+    void* pResult = dMalloc_r( PLATFORM_UNITTEST_MEMORY_BUFFERSIZE, __FILE__, __LINE__ );
+
+    // Check the allocation is attributed to the tag.
+    MemoryTagStats stats;
+    dGetMemoryTagStats( MemoryTag_Network, stats );
+    ASSERT_EQ( startStats.mLiveBytes + PLATFORM_UNITTEST_MEMORY_BUFFERSIZE, stats.mLiveBytes ) << "Live bytes are incorrect.";
+    ASSERT_EQ( startStats.mLiveCount + 1, stats.mLiveCount ) << "Live count is incorrect.";
+    ASSERT_LE( stats.mLiveBytes, stats.mPeakBytes ) << "Peak bytes are incorrect.";
+
+    // Check a reallocation stays with the tag.
+    pResult = dRealloc_r( pResult, PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 2, __FILE__, __LINE__ );
+    dGetMemoryTagStats( MemoryTag_Network, stats );
+    ASSERT_EQ( startStats.mLiveBytes + PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 2, stats.mLiveBytes ) << "Live bytes are incorrect.";
+
+    dFree( pResult );
+
+    // Check the free is accounted for.
+    dGetMemoryTagStats( MemoryTag_Network, stats );
+    ASSERT_EQ( startStats.mLiveBytes, stats.mLiveBytes ) << "Live bytes are incorrect.";
+    ASSERT_EQ( startStats.mLiveCount, stats.mLiveCount ) << "Live count is incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, MemoryPoolTest )
+{
+    // Use a pooled tag.
+    MemoryTagScope memoryTagScope( MemoryTag_Network );
+    const MemoryBackend previousBackend = dGetMemoryTagBackend( MemoryTag_Network );
+    dSetMemoryTagBackend( MemoryTag_Network, MemoryBackend_Pool );
+
+    // Check a freed small block is recycled without touching the heap.
+    void* pFirst = dMalloc_r( 24, __FILE__, __LINE__ );
+    dFree( pFirst );
+    const U32 startCount = dGetAllocationCount();
+    void* pSecond = dMalloc_r( 20, __FILE__, __LINE__ );
+    ASSERT_EQ( pFirst, pSecond ) << "Pool block was not recycled.";
+    ASSERT_EQ( startCount, dGetAllocationCount() ) << "Pool block was not recycled.";
+
+    // Check a reallocation within the pool block size happens in place.
+    void* pResized = dRealloc_r( pSecond, 32, __FILE__, __LINE__ );
+    ASSERT_EQ( pSecond, pResized ) << "Pool block was not resized in place.";
+
+    // Check a reallocation beyond the pool block size preserves the contents.
+    dMemset( pResized, 0x5A, 32 );
+    pResized = dRealloc_r( pResized, PLATFORM_UNITTEST_MEMORY_BUFFERSIZE, __FILE__, __LINE__ );
+    for( U32 index = 0; index < 32; ++index )
+    {
+        ASSERT_EQ( 0x5A, ((U8*)pResized)[index] ) << "Reallocated memory is incorrect.";
+    }
+
+    dFree( pResized );
+
+    dSetMemoryTagBackend( MemoryTag_Network, previousBackend );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, ReleaseThreadMemoryTest )
+{
+    // Use a pooled tag.
+    const MemoryBackend previousBackend = dGetMemoryTagBackend( MemoryTag_Network );
+    dSetMemoryTagBackend( MemoryTag_Network, MemoryBackend_Pool );
+    const MemoryTag previousTag = dSetMemoryTag( MemoryTag_Network );
+
+    // Cache a pool block then release the thread memory.
+    dFree( dMalloc_r( 24, __FILE__, __LINE__ ) );
+    dReleaseThreadMemory();
+
+    // Check the thread starts again with the default tag.
+    ASSERT_EQ( MemoryTag_General, dGetMemoryTag() ) << "Thread memory state was not released.";
+
+    // Check the cached pool block was returned to the heap.
+    dSetMemoryTag( MemoryTag_Network );
+    const U32 startCount = dGetAllocationCount();
+    void* pResult = dMalloc_r( 24, __FILE__, __LINE__ );
+    ASSERT_EQ( startCount + 1, dGetAllocationCount() ) << "Pool blocks were not released.";
+    dFree( pResult );
+
+    dSetMemoryTag( previousTag );
+    dSetMemoryTagBackend( MemoryTag_Network, previousBackend );
+}
+
 #endif // TORQUE_SHIPPING
@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRecycleTests, DeleteBudgetIsACount )
+{
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+    pScene->setDeleteBudget( 2 );
+
+    // Delete some objects.
+    for ( U32 index = 0; index < 5; ++index )
+        pScene->create( "Sprite" )->safeDelete();
+
+    // The same number of objects should be destroyed each tick.
+    pScene->processTick();
+    ASSERT_EQ( (U32)3, pScene->getRetiredCount() );
+    pScene->processTick();
+    ASSERT_EQ( (U32)1, pScene->getRetiredCount() );
+    pScene->processTick();
+    ASSERT_EQ( (U32)0, pScene->getRetiredCount() );
+
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRecycleTests, RecycledObjectsAreReset )
+{
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+    pScene->setRecycleLimit( "Sprite", 1 );
+    pScene->setDeleteBudget( 1 );
+
+    StringTableEntry fieldName = StringTable->insert( "recycleTestField" );
+
+    // Configure and delete an object.
+    SceneObject* pSceneObject = pScene->create( "Sprite" );
+    ASSERT_TRUE( pSceneObject != NULL );
+    pSceneObject->setVisible( false );
+    pSceneObject->assignName( "SceneRecycleTestObject" );
+    pSceneObject->setDataField( fieldName, NULL, "1" );
+    const SimObjectId deletedId = pSceneObject->getId();
+    pSceneObject->safeDelete();
+    pScene->processTick();
+    ASSERT_EQ( (U32)1, pScene->getRecycleCount( "Sprite" ) );
+
+    // References to the deleted object should no longer find it.
+    ASSERT_TRUE( Sim::findObject( deletedId ) == NULL ) << "The deleted id still finds the recycled object.";
+    ASSERT_TRUE( Sim::findObject( "SceneRecycleTestObject" ) == NULL ) << "The deleted name still finds the recycled object.";
+
+    // The recycled object should have the state it had before it was deleted but not its identity.
+    SceneObject* pRecycledObject = pScene->create( "Sprite" );
+    ASSERT_EQ( pSceneObject, pRecycledObject ) << "The object was not recycled.";
+    ASSERT_NE( deletedId, pRecycledObject->getId() );
+    ASSERT_FALSE( pRecycledObject->getVisible() );
+    ASSERT_TRUE( pRecycledObject->isEnabled() );
+    ASSERT_STREQ( "", pRecycledObject->getDataField( fieldName, NULL ) );
+    ASSERT_TRUE( pRecycledObject->getName() == NULL );
+
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneTickTests, WokenBodiesAreActivated )
+{
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+
+    SceneObject* pSceneObject = pScene->create( "Sprite" );
+    ASSERT_TRUE( pSceneObject != NULL );
+
+    // Settle the object then put its body to sleep.
+    pScene->processTick();
+    pSceneObject->setAwake( false );
+    pScene->processTick();
+    ASSERT_TRUE( pSceneObject->getTickPassive() );
+    ASSERT_EQ( (U32)0, pScene->getActiveSceneObjectCount() );
+    ASSERT_EQ( (U32)1, pScene->getPassiveSceneObjectCount() );
+
+    // Waking the body should activate the object straight away.
+    pSceneObject->setLinearVelocity( Vector2( 1.0f, 0.0f ) );
+    ASSERT_FALSE( pSceneObject->getTickPassive() );
+    ASSERT_EQ( (U32)1, pScene->getActiveSceneObjectCount() );
+    ASSERT_EQ( (U32)0, pScene->getPassiveSceneObjectCount() );
+
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneTickTests, TombstonesAreCompacted )
+{
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+
+    // Add some objects and remove the middle one.
+    SceneObject* pSceneObjects[3];
+    for ( U32 index = 0; index < 3; ++index )
+        pSceneObjects[index] = pScene->create( "Sprite" );
+
+    pScene->removeFromScene( pSceneObjects[1] );
+    ASSERT_EQ( (U32)2, pScene->getActiveSceneObjectCount() );
+
+    // The remaining objects should keep their order.
+    pScene->processTick();
+    ASSERT_EQ( 0, pSceneObjects[0]->getTickIndex() );
+    ASSERT_EQ( 1, pSceneObjects[2]->getTickIndex() );
+
+    pSceneObjects[1]->deleteObject();
+    pScene->clearScene( true );
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,164 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SIM_FIELD_DICTIONARY_H_
+#include "sim/simFieldDictionary.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIM_UNITTEST_FIELD_COUNT     200
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry getTestFieldName( const U32 index )
+{
+    char fieldName[32];
+    dSprintf( fieldName, sizeof(fieldName), "testField%d", index );
+    return StringTable->insert( fieldName );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, SetGetRemoveTest )
+{
+    SimFieldDictionary dictionary;
+    char fieldValue[32];
+
+    // Add fields.
+    for ( U32 index = 0; index < SIM_UNITTEST_FIELD_COUNT; ++index )
+    {
+        dSprintf( fieldValue, sizeof(fieldValue), "%d", index );
+        dictionary.setFieldValue( getTestFieldName( index ), fieldValue );
+    }
+
+    ASSERT_EQ( dictionary.getFieldCount(), (U32)SIM_UNITTEST_FIELD_COUNT ) << "Field count is incorrect after adding fields.";
+
+    // Remove every other field.
+    for ( U32 index = 0; index < SIM_UNITTEST_FIELD_COUNT; index += 2 )
+        dictionary.setFieldValue( getTestFieldName( index ), "" );
+
+    ASSERT_EQ( dictionary.getFieldCount(), (U32)(SIM_UNITTEST_FIELD_COUNT / 2) ) << "Field count is incorrect after removing fields.";
+
+    // Check the remaining fields are still found.
+    for ( U32 index = 0; index < SIM_UNITTEST_FIELD_COUNT; ++index )
+    {
+        const char* pValue = dictionary.getFieldValue( getTestFieldName( index ) );
+
+        if ( index & 1 )
+        {
+            dSprintf( fieldValue, sizeof(fieldValue), "%d", index );
+            ASSERT_STREQ( fieldValue, pValue ) << "Field value is incorrect after removing fields.";
+        }
+        else
+        {
+            ASSERT_TRUE( pValue == NULL ) << "Removed field was found.";
+        }
+    }
+
+    // Check the iterator visits only the remaining fields.
+    U32 iteratedCount = 0;
+    for ( SimFieldDictionaryIterator itr( &dictionary ); *itr; ++itr )
+        iteratedCount++;
+
+    ASSERT_EQ( iteratedCount, dictionary.getFieldCount() ) << "Iterator visited the wrong number of fields.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, ValueStorageTest )
+{
+    SimFieldDictionary dictionary;
+    StringTableEntry fieldName = getTestFieldName( 0 );
+
+    // Switch between short and long values.
+    const char* pLongValue = "This value is too long to fit in the allocation of the short value.";
+    dictionary.setFieldValue( fieldName, "short" );
+    ASSERT_STREQ( "short", dictionary.getFieldValue( fieldName ) );
+    dictionary.setFieldValue( fieldName, pLongValue );
+    ASSERT_STREQ( pLongValue, dictionary.getFieldValue( fieldName ) );
+    dictionary.setFieldValue( fieldName, "short" );
+    ASSERT_STREQ( "short", dictionary.getFieldValue( fieldName ) );
+
+    // Check the numeric values follow the string value.
+    dictionary.setFieldValue( fieldName, "42" );
+    ASSERT_EQ( dictionary.getFieldValueInt( fieldName ), 42 );
+    ASSERT_EQ( dictionary.getFieldValueFloat( fieldName ), 42.0f );
+    dictionary.setFieldValue( fieldName, "1.5" );
+    ASSERT_EQ( dictionary.getFieldValueInt( fieldName ), 1 );
+    ASSERT_EQ( dictionary.getFieldValueFloat( fieldName ), 1.5f );
+
+    // Check missing fields.
+    ASSERT_EQ( dictionary.getFieldValueInt( getTestFieldName( 1 ) ), 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, ValueStabilityTest )
+{
+    SimFieldDictionary dictionary;
+    StringTableEntry fieldNameA = getTestFieldName( 0 );
+    StringTableEntry fieldNameB = getTestFieldName( 1 );
+    char fieldValue[32];
+
+    // Fetch a value and then grow the table well past the pooled table size.
+    dictionary.setFieldValue( fieldNameB, "value of b" );
+    const char* pValueB = dictionary.getFieldValue( fieldNameB );
+    for ( U32 index = 2; index < 1024; ++index )
+    {
+        dSprintf( fieldValue, sizeof(fieldValue), "%d", index );
+        dictionary.setFieldValue( getTestFieldName( index ), fieldValue );
+    }
+
+    // The value should not have moved with the entry.
+    ASSERT_TRUE( pValueB == dictionary.getFieldValue( fieldNameB ) ) << "Value moved when the table grew.";
+    ASSERT_STREQ( "value of b", pValueB );
+
+    // Removing unrelated fields should not move the value either.
+    for ( U32 index = 2; index < 1024; index += 2 )
+        dictionary.setFieldValue( getTestFieldName( index ), "" );
+
+    ASSERT_TRUE( pValueB == dictionary.getFieldValue( fieldNameB ) ) << "Value moved when fields were removed.";
+
+    // Assigning one field from another in the same dictionary.
+    dictionary.setFieldValue( fieldNameA, dictionary.getFieldValue( fieldNameB ) );
+    ASSERT_STREQ( "value of b", dictionary.getFieldValue( fieldNameA ) );
+
+    // Assigning a field from itself or part of itself.
+    dictionary.setFieldValue( fieldNameA, dictionary.getFieldValue( fieldNameA ) );
+    ASSERT_STREQ( "value of b", dictionary.getFieldValue( fieldNameA ) );
+    dictionary.setFieldValue( fieldNameA, dictionary.getFieldValue( fieldNameA ) + 9 );
+    ASSERT_STREQ( "b", dictionary.getFieldValue( fieldNameA ) );
+}
+
+#endif // TORQUE_SHIPPING
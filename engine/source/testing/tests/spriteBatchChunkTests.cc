@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SPRITE_BATCH_H_
+#include "2d/core/SpriteBatch.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( SpriteBatchChunkTests, SpritesAreGroupedIntoChunks )
+{
+    SpriteBatch spriteBatch;
+    spriteBatch.setBatchChunkSize( 4.0f );
+
+    spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "0 0" ) );
+    spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "1 1" ) );
+    spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "5 0" ) );
+    spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "-1 0" ) );
+
+    // Updating the local extents updates the sprite local transforms and so the chunks.
+    spriteBatch.getLocalExtents();
+    ASSERT_EQ( (U32)3, spriteBatch.getBatchChunkCount() );
+
+    // Moving the only sprite out of a chunk should remove the chunk.
+    ASSERT_TRUE( spriteBatch.selectSprite( SpriteBatchItem::LogicalPosition( "5 0" ) ) );
+    spriteBatch.setSpriteLocalPosition( Vector2( 2.0f, 2.0f ) );
+    spriteBatch.getLocalExtents();
+    ASSERT_EQ( (U32)2, spriteBatch.getBatchChunkCount() );
+
+    // Turning chunking off and on should rebuild the same chunks.
+    spriteBatch.setBatchChunkSize( 0.0f );
+    ASSERT_EQ( (U32)0, spriteBatch.getBatchChunkCount() );
+    spriteBatch.setBatchChunkSize( 4.0f );
+    ASSERT_EQ( (U32)2, spriteBatch.getBatchChunkCount() );
+
+    // Removing the sprites should remove the chunks.
+    spriteBatch.clearSprites();
+    ASSERT_EQ( (U32)0, spriteBatch.getBatchChunkCount() );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SPRITE_BATCH_H_
+#include "2d/core/SpriteBatch.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( SpriteBatchTransformsTests, TransformVerticesMatchesBox2D )
+{
+    const b2Transform transform( b2Vec2( 3.0f, -2.0f ), b2Rot( 0.7f ) );
+
+    const F32 inputX[5] = { 0.0f, 1.0f, -1.5f, 2.25f, 10.0f };
+    const F32 inputY[5] = { 0.0f, -1.0f, 0.5f, 4.0f, -10.0f };
+    F32 outputX[5];
+    F32 outputY[5];
+
+    SpriteBatchTransforms::transformVertices( transform, inputX, inputY, outputX, outputY, 5 );
+
+    for ( U32 n = 0; n < 5; ++n )
+    {
+        const b2Vec2 expected = b2Mul( transform, b2Vec2( inputX[n], inputY[n] ) );
+        ASSERT_NEAR( expected.x, outputX[n], 0.0001f );
+        ASSERT_NEAR( expected.y, outputY[n], 0.0001f );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SpriteBatchTransformsTests, SlotsStayCompactWhenSpritesAreRemoved )
+{
+    SpriteBatch spriteBatch;
+
+    const U32 firstId = spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "0 0" ) );
+    spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "1 0" ) );
+    spriteBatch.addSprite( SpriteBatchItem::LogicalPosition( "2 0" ) );
+    ASSERT_EQ( (U32)3, spriteBatch.getSpriteTransforms().getSlotCount() );
+
+    // Removing the first sprite should move the last sprite into its slot.
+    ASSERT_TRUE( spriteBatch.selectSpriteId( firstId ) );
+    ASSERT_TRUE( spriteBatch.removeSprite() );
+    ASSERT_EQ( (U32)2, spriteBatch.getSpriteTransforms().getSlotCount() );
+
+    // The moved sprite should still resolve to its own transform slot.
+    ASSERT_TRUE( spriteBatch.selectSprite( SpriteBatchItem::LogicalPosition( "2 0" ) ) );
+    spriteBatch.setSpriteLocalPosition( Vector2( 5.0f, 6.0f ) );
+    const Vector2 localExtents = spriteBatch.getLocalExtents();
+    ASSERT_FLOAT_EQ( 11.0f, localExtents.x );
+    ASSERT_FLOAT_EQ( 13.0f, localExtents.y );
+
+    spriteBatch.clearSprites();
+    ASSERT_EQ( (U32)0, spriteBatch.getSpriteTransforms().getSlotCount() );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAML_UNITTEST_INCREMENTAL_FILE      "_unitTestTaml_RemoveMe.taml"
+
+//-----------------------------------------------------------------------------
+
+static SimSet* createIncrementalWriteSet( const U32 childCount )
+{
+    SimSet* pSet = new SimSet();
+    pSet->registerObject();
+
+    for ( U32 index = 0; index < childCount; ++index )
+    {
+        SimObject* pChild = new SimObject();
+        pChild->registerObject();
+        pSet->addObject( pChild );
+    }
+
+    return pSet;
+}
+
+//-----------------------------------------------------------------------------
+
+static void deleteIncrementalWriteSet( SimSet* pSet )
+{
+    while( pSet->size() > 0 )
+        pSet->first()->deleteObject();
+
+    pSet->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlIncrementalWriteTests, WriteCompletes )
+{
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), TAML_UNITTEST_INCREMENTAL_FILE );
+
+    Taml* pTaml = new Taml();
+    ASSERT_TRUE( pTaml->registerObject() );
+    pTaml->setIncrementalSliceSize( 1 );
+
+    SimSet* pSet = createIncrementalWriteSet( 3 );
+
+    // Write the set over several slices.
+    ASSERT_TRUE( pTaml->writeIncremental( pSet, filePathBuffer ) );
+    ASSERT_TRUE( pTaml->isWritingIncremental() );
+    ASSERT_TRUE( pTaml->processIdleTask() );
+    pTaml->finishIncrementalWrite( false );
+    ASSERT_FALSE( pTaml->isWritingIncremental() );
+    ASSERT_TRUE( pTaml->getIncrementalStatus() ) << "Incremental write failed.";
+
+    // Check the file was written.
+    ASSERT_TRUE( Platform::isFile( filePathBuffer ) );
+    ASSERT_TRUE( Platform::fileDelete( filePathBuffer ) );
+
+    deleteIncrementalWriteSet( pSet );
+    pTaml->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlIncrementalWriteTests, DeletedObjectAbortsWrite )
+{
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), TAML_UNITTEST_INCREMENTAL_FILE );
+
+    Taml* pTaml = new Taml();
+    ASSERT_TRUE( pTaml->registerObject() );
+    pTaml->setIncrementalSliceSize( 1 );
+
+    SimSet* pSet = createIncrementalWriteSet( 3 );
+
+    // Start the write then delete the set part way through.
+    ASSERT_TRUE( pTaml->writeIncremental( pSet, filePathBuffer ) );
+    ASSERT_TRUE( pTaml->processIdleTask() );
+    deleteIncrementalWriteSet( pSet );
+
+    // The write should fail without writing the file.
+    pTaml->finishIncrementalWrite( false );
+    ASSERT_FALSE( pTaml->isWritingIncremental() );
+    ASSERT_FALSE( pTaml->getIncrementalStatus() ) << "Incremental write did not abort.";
+    ASSERT_FALSE( Platform::isFile( filePathBuffer ) );
+
+    pTaml->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
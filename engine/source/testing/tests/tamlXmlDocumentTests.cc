@@ -0,0 +1,86 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TAML_XMLDOCUMENT_H_
+#include "persistence/taml/xml/tamlXmlDocument.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlXmlDocumentTests, ParseInSituTest )
+{
+    char buffer[] =
+        "<?xml version=\"1.0\"?>\n"
+        "<!-- Comment -->\n"
+        "<Scene Name='Test' Value=\"a &amp; b &#65;\">\n"
+        "    <Sprite Size=\"1 1\"/>\n"
+        "    <Scene.Custom>\n"
+        "        <Node>  some   text  </Node>\n"
+        "    </Scene.Custom>\n"
+        "</Scene>\n";
+
+    TamlXmlDocument xmlDocument;
+    ASSERT_TRUE( xmlDocument.parse( buffer ) ) << "Parse failed.";
+
+    // Check the root element.
+    const TamlXmlDocument::Element& rootElement = xmlDocument.getElement( xmlDocument.getRootElement() );
+    ASSERT_STREQ( "Scene", rootElement.mpName );
+    ASSERT_EQ( rootElement.mRow, (U32)3 ) << "Root element row is incorrect.";
+    ASSERT_EQ( rootElement.mAttributeCount, (U32)2 );
+    ASSERT_STREQ( "Test", xmlDocument.findAttribute( rootElement, "name" ) ) << "Attribute lookup failed.";
+    ASSERT_STREQ( "a & b A", xmlDocument.findAttribute( rootElement, "Value" ) ) << "Entity decoding failed.";
+
+    // Check the children.
+    ASSERT_NE( rootElement.mFirstChild, -1 );
+    const TamlXmlDocument::Element& spriteElement = xmlDocument.getElement( rootElement.mFirstChild );
+    ASSERT_STREQ( "Sprite", spriteElement.mpName );
+    ASSERT_STREQ( "1 1", xmlDocument.findAttribute( spriteElement, "Size" ) );
+    ASSERT_NE( spriteElement.mNextSibling, -1 );
+    const TamlXmlDocument::Element& customElement = xmlDocument.getElement( spriteElement.mNextSibling );
+    ASSERT_STREQ( "Scene.Custom", customElement.mpName );
+    ASSERT_EQ( customElement.mNextSibling, -1 );
+
+    // Check the text is condensed.
+    const TamlXmlDocument::Element& nodeElement = xmlDocument.getElement( customElement.mFirstChild );
+    ASSERT_STREQ( "some text", nodeElement.mpText ) << "Element text is incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlXmlDocumentTests, ParseInvalidTest )
+{
+    char mismatchedBuffer[] = "<Scene><Sprite></Scene></Sprite>";
+    char truncatedBuffer[] = "<Scene><Sprite/>";
+
+    TamlXmlDocument xmlDocument;
+    ASSERT_FALSE( xmlDocument.parse( mismatchedBuffer ) ) << "Mismatched end tag was accepted.";
+    ASSERT_FALSE( xmlDocument.parse( truncatedBuffer ) ) << "Truncated document was accepted.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,139 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SMALLVECTOR_H_
+#include "collection/smallVector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define VECTOR_UNITTEST_ELEMENT_COUNT   100000
+
+//-----------------------------------------------------------------------------
+
+TEST( VectorTests, GrowthTest )
+{
+    Vector<U32> elements;
+
+    const U32 startAllocationCount = dGetAllocationCount();
+
+    // Append the elements.
+    for ( U32 index = 0; index < VECTOR_UNITTEST_ELEMENT_COUNT; ++index )
+    {
+        elements.push_back( index );
+    }
+
+    // Check the geometric growth means only a handful of reallocations were needed.
+    ASSERT_LT( dGetAllocationCount() - startAllocationCount, 32U );
+    ASSERT_GE( elements.capacity(), (U32)VECTOR_UNITTEST_ELEMENT_COUNT );
+
+    // Check the elements survived the relocations.
+    for ( U32 index = 0; index < VECTOR_UNITTEST_ELEMENT_COUNT; ++index )
+    {
+        ASSERT_EQ( elements[index], index );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( VectorTests, AssignmentTest )
+{
+    Vector<U32> source;
+    Vector<U32> destination;
+
+    source.setSize( 100 );
+    for ( U32 index = 0; index < 100; ++index )
+        source[index] = index;
+
+    destination = source;
+    ASSERT_EQ( destination.size(), 100 );
+
+    // Check that assigning fewer elements reuses the existing capacity.
+    const U32 capacity = destination.capacity();
+    source.setSize( 10 );
+    destination = source;
+    ASSERT_EQ( destination.size(), 10 );
+    ASSERT_EQ( destination.capacity(), capacity );
+    ASSERT_EQ( destination[9], 9U );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SmallVectorTests, InlineTest )
+{
+    SmallVector<U32, 8> elements;
+
+    const U32 startAllocationCount = dGetAllocationCount();
+
+    // Check the inline storage is used without allocating.
+    for ( U32 index = 0; index < 8; ++index )
+    {
+        elements.push_back( index );
+    }
+
+    ASSERT_TRUE( elements.isInline() );
+    ASSERT_EQ( dGetAllocationCount(), startAllocationCount );
+
+    // Check the elements are relocated to the heap when the inline storage is exceeded.
+    for ( U32 index = 8; index < 1000; ++index )
+    {
+        elements.push_back( index );
+    }
+
+    ASSERT_FALSE( elements.isInline() );
+    ASSERT_EQ( elements.size(), 1000 );
+
+    for ( U32 index = 0; index < 1000; ++index )
+    {
+        ASSERT_EQ( elements[index], index );
+    }
+
+    // Check erasing maintains order.
+    elements.erase( 0U );
+    ASSERT_EQ( elements.first(), 1U );
+    ASSERT_EQ( elements.last(), 999U );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SmallVectorTests, CopyTest )
+{
+    SmallVector<U32, 4> source;
+    for ( U32 index = 0; index < 10; ++index )
+        source.push_back( index );
+
+    // Check a copy of a heap vector is independent.
+    SmallVector<U32, 4> copy( source );
+    source[0] = 100;
+    ASSERT_EQ( copy.size(), 10 );
+    ASSERT_EQ( copy[0], 0U );
+    ASSERT_EQ( copy[9], 9U );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_WORKERPOOL_H_
+#include "platform/threads/workerPool.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define WORKERPOOL_UNITTEST_ITEM_COUNT     1000
+
+//-----------------------------------------------------------------------------
+
+static void countWorkItem( void* pContext, const U32 index )
+{
+    // Each item is only ever processed by a single thread.
+    ((U32*)pContext)[index]++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void nestedWorkItem( void* pContext, const U32 index )
+{
+    // Re-entrant processing is done serially on the calling thread.
+    WorkerPool::process( countWorkItem, pContext, 0 );
+
+    ((U32*)pContext)[index]++;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorkerPoolTests, ProcessTest )
+{
+    Vector<U32> itemCounts;
+    itemCounts.setSize( WORKERPOOL_UNITTEST_ITEM_COUNT );
+
+    // Process batches of varying sizes.
+    for ( U32 itemCount = 0; itemCount <= WORKERPOOL_UNITTEST_ITEM_COUNT; itemCount += 97 )
+    {
+        dMemset( itemCounts.address(), 0, itemCounts.memSize() );
+
+        WorkerPool::process( countWorkItem, itemCounts.address(), itemCount );
+
+        // Check each item was processed exactly once.
+        for ( U32 index = 0; index < WORKERPOOL_UNITTEST_ITEM_COUNT; ++index )
+        {
+            ASSERT_EQ( itemCounts[index], index < itemCount ? 1U : 0U );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorkerPoolTests, NestedProcessTest )
+{
+    Vector<U32> itemCounts;
+    itemCounts.setSize( WORKERPOOL_UNITTEST_ITEM_COUNT );
+    dMemset( itemCounts.address(), 0, itemCounts.memSize() );
+
+    WorkerPool::process( nestedWorkItem, itemCounts.address(), WORKERPOOL_UNITTEST_ITEM_COUNT );
+
+    // Check each item was processed exactly once.
+    for ( U32 index = 0; index < WORKERPOOL_UNITTEST_ITEM_COUNT; ++index )
+    {
+        ASSERT_EQ( itemCounts[index], 1U );
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -83,6 +83,11 @@
 /// 'TORQUE_GATHER_METRICS'
 /// When defined, Torque will gather additional performance metrics.
 ///
+/// 'TORQUE_ALLOW_JOURNALING'
+/// When defined, Torque can record a journal of a session with "-jSave" and play it back
+/// with "-jPlay" or, to reproduce performance problems, headless with "-jReplay".
+/// The debug and release builds define it; shipping builds do not.
+///
 /// 'TORQUE_MULTITHREAD'
 /// When defined, Torque will attempt to make select systems thread-safe.  This does not
 /// make the entire engine thread-safe nor is it a magic bullet that will make the engine